@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+import argparse
+from ns3gym import ns3env
+
+__author__ = "Piotr Gawlowicz"
+__copyright__ = "Copyright (c) 2020, Technische Universität Berlin"
+__version__ = "0.1.0"
+__email__ = "gawlowicz@tkn.tu-berlin.de"
+
+
+port = 5555
+env = ns3env.Ns3Env(port=port, startSim=False)
+env.reset()
+
+ob_space = env.observation_space
+ac_space = env.action_space
+print("Observation space: ", ob_space)
+print("Action space: ", ac_space)
+
+
+stepIdx = 0
+
+try:
+    obs = env.reset()
+    print("Step: ", stepIdx)
+    print("---obs: ", obs)
+
+    while True:
+        stepIdx += 1
+        # act only for agents present in the last observation
+        action = {}
+        for agentId in obs:
+            action[agentId] = ac_space[agentId].sample()
+        print("---action: ", action)
+
+        print("Step: ", stepIdx)
+        obs, reward, done, info = env.step(action)
+        print("---obs, reward, done, info: ", obs, reward, done, info)
+
+        if done['__all__']:
+            break
+
+except KeyboardInterrupt:
+    print("Ctrl-C -> Exit")
+finally:
+    env.close()
+    print("Done")
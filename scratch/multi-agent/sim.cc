@@ -36,6 +36,7 @@ main (int argc, char *argv[])
   double envStepTime = 0.1; //seconds, ns3gym env step time interval
   uint32_t openGymPort = 5555;
   uint32_t testArg = 0;
+  bool sharedInterface = false;
 
   CommandLine cmd;
   // required parameters for OpenGym interface
@@ -45,6 +46,7 @@ main (int argc, char *argv[])
   cmd.AddValue ("simTime", "Simulation time in seconds. Default: 10s", simulationTime);
   cmd.AddValue ("stepTime", "Gym Env step time in seconds. Default: 0.1s", envStepTime);
   cmd.AddValue ("testArg", "Extra simulation argument. Default: 0", testArg);
+  cmd.AddValue ("sharedInterface", "Serve both agents by one gateway (agents.py). Default: false", sharedInterface);
   cmd.Parse (argc, argv);
 
   NS_LOG_UNCOND("Ns3Env parameters:");
@@ -57,6 +59,25 @@ main (int argc, char *argv[])
   RngSeedManager::SetSeed (1);
   RngSeedManager::SetRun (simSeed);
 
+  if (sharedInterface)
+    {
+      // both agents behind one gateway, states of the same time stamp travel in one message
+      Ptr<OpenGymInterface> openGymInterface = CreateObject<OpenGymInterface> (openGymPort);
+      Ptr<MyGymEnv> myGymEnv1 = CreateObject<MyGymEnv> (1, Seconds(envStepTime));
+      myGymEnv1->SetOpenGymInterface(openGymInterface, 1);
+      Ptr<MyGymEnv> myGymEnv2 = CreateObject<MyGymEnv> (2, Seconds(envStepTime));
+      myGymEnv2->SetOpenGymInterface(openGymInterface, 2);
+
+      NS_LOG_UNCOND ("Simulation start");
+      Simulator::Stop (Seconds (simulationTime));
+      Simulator::Run ();
+      NS_LOG_UNCOND ("Simulation stop");
+
+      openGymInterface->NotifySimulationEnd();
+      Simulator::Destroy ();
+      return 0;
+    }
+
   // OpenGym Env for agent 1
   uint32_t agentId = 1;
   openGymPort = 5555;
@@ -77,6 +77,10 @@ void
 MyGymEnv::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  m_rngInt = 0;
+  m_obsBox = 0;
+  m_obsDiscrete = 0;
+  m_obsData = 0;
 }
 
 /*
@@ -151,24 +155,29 @@ MyGymEnv::GetObservation()
   uint32_t nodeNum = 5;
   uint32_t low = 0.0;
   uint32_t high = 10.0;
-  Ptr<UniformRandomVariable> rngInt = CreateObject<UniformRandomVariable> ();
 
-  std::vector<uint32_t> shape = {nodeNum,};
-  Ptr<OpenGymBoxContainer<uint32_t> > box = CreateObject<OpenGymBoxContainer<uint32_t> >(shape);
+  if (!m_obsData) {
+    m_rngInt = CreateObject<UniformRandomVariable> ();
+
+    std::vector<uint32_t> shape = {nodeNum,};
+    m_obsBox = CreateObject<OpenGymBoxContainer<uint32_t> >(shape);
+    m_obsDiscrete = CreateObject<OpenGymDiscreteContainer>(nodeNum);
+
+    m_obsData = CreateObject<OpenGymDictContainer> ();
+    m_obsData->Add("myVector",m_obsBox);
+    m_obsData->Add("myValue",m_obsDiscrete);
+  }
 
-  // generate random data
+  // generate random data, values are overwritten in place
   for (uint32_t i = 0; i<nodeNum; i++){
-    uint32_t value = rngInt->GetInteger(low, high);
-    box->AddValue(value);
+    uint32_t value = m_rngInt->GetInteger(low, high);
+    m_obsBox->SetValue(i, value);
   }
 
-  Ptr<OpenGymDiscreteContainer> discrete = CreateObject<OpenGymDiscreteContainer>(nodeNum);
-  uint32_t value = rngInt->GetInteger(low, high);
-  discrete->SetValue(value);
+  uint32_t value = m_rngInt->GetInteger(low, high);
+  m_obsDiscrete->SetValue(value);
 
-  Ptr<OpenGymDictContainer> data = CreateObject<OpenGymDictContainer> ();
-  data->Add("myVector",box);
-  data->Add("myValue",discrete);
+  Ptr<OpenGymDictContainer> data = m_obsData;
 
   // Print data from tuple
   Ptr<OpenGymBoxContainer<uint32_t> > mbox = DynamicCast<OpenGymBoxContainer<uint32_t> >(data->Get("myVector"));
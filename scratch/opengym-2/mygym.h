@@ -24,6 +24,7 @@
 
 #include "ns3/opengym-module.h"
 #include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
 
 namespace ns3 {
 
@@ -48,6 +49,12 @@ private:
   void ScheduleNextStateRead();
 
   Time m_interval;
+
+  // observation containers are created once and refilled every step
+  Ptr<UniformRandomVariable> m_rngInt;
+  Ptr<OpenGymBoxContainer<uint32_t> > m_obsBox;
+  Ptr<OpenGymDiscreteContainer> m_obsDiscrete;
+  Ptr<OpenGymDictContainer> m_obsData;
 };
 
 }
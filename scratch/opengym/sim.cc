@@ -140,6 +140,7 @@ main (int argc, char *argv[])
   double envStepTime = 0.1; //seconds, ns3gym env step time interval
   uint32_t openGymPort = 5555;
   uint32_t testArg = 0;
+  bool forkServer = false;
 
   CommandLine cmd;
   // required parameters for OpenGym interface
@@ -148,6 +149,7 @@ main (int argc, char *argv[])
   // optional parameters
   cmd.AddValue ("simTime", "Simulation time in seconds. Default: 10s", simulationTime);
   cmd.AddValue ("testArg", "Extra simulation argument. Default: 0", testArg);
+  cmd.AddValue ("forkServer", "Fork a new process for every episode instead of restarting the script. Default: false", forkServer);
   cmd.Parse (argc, argv);
 
   NS_LOG_UNCOND("Ns3Env parameters:");
@@ -169,6 +171,9 @@ main (int argc, char *argv[])
   openGym->SetGetRewardCb( MakeCallback (&MyGetReward) );
   openGym->SetGetExtraInfoCb( MakeCallback (&MyGetExtraInfo) );
   openGym->SetExecuteActionsCb( MakeCallback (&MyExecuteActions) );
+  if (forkServer) {
+    openGym->EnableForkServer (Seconds (0.0));
+  }
   Simulator::Schedule (Seconds(0.0), &ScheduleNextStateRead, envStepTime, openGym);
 
   NS_LOG_UNCOND ("Simulation start");
@@ -27,6 +27,7 @@
 #include "ns3/tcp-socket-base.h"
 #include <vector>
 #include <numeric>
+#include <algorithm>
 
 
 namespace ns3 {
@@ -257,6 +258,19 @@ TcpEventGymEnv::SetPenalty(float value)
   m_penalty = value;
 }
 
+void
+TcpEventGymEnv::SetBatchSize(uint32_t batchSize)
+{
+  NS_LOG_FUNCTION (this << batchSize);
+  if (batchSize == 0) {
+    m_batcher = 0;
+    return;
+  }
+  uint32_t parameterNum = 15;
+  m_batcher = CreateObject<OpenGymEventBatcher> (parameterNum, batchSize);
+  m_batcher->SetFlushCallback(MakeCallback(&OpenGymEnv::Notify, this));
+}
+
 /*
 Define observation space
 */
@@ -281,6 +295,9 @@ TcpEventGymEnv::GetObservationSpace()
   uint32_t parameterNum = 15;
   float low = 0.0;
   float high = 1000000000.0;
+  if (m_batcher) {
+    return m_batcher->GetObservationSpace(low, high);
+  }
   std::vector<uint32_t> shape = {parameterNum,};
   std::string dtype = TypeNameGet<uint64_t> ();
 
@@ -295,32 +312,53 @@ Collect observations
 Ptr<OpenGymDataContainer>
 TcpEventGymEnv::GetObservation()
 {
+  if (m_batcher) {
+    // per-event samples are collected by the batcher already
+    return m_batcher->GetObservation();
+  }
+
   uint32_t parameterNum = 15;
   std::vector<uint32_t> shape = {parameterNum,};
 
   Ptr<OpenGymBoxContainer<uint64_t> > box = CreateObject<OpenGymBoxContainer<uint64_t> >(shape);
-
-  box->AddValue(m_socketUuid);
-  box->AddValue(0);
-  box->AddValue(Simulator::Now().GetMicroSeconds ());
-  box->AddValue(m_nodeId);
-  box->AddValue(m_tcb->m_ssThresh);
-  box->AddValue(m_tcb->m_cWnd);
-  box->AddValue(m_tcb->m_segmentSize);
-  box->AddValue(m_segmentsAcked);
-  box->AddValue(m_bytesInFlight);
-  box->AddValue(m_rtt.GetMicroSeconds ());
-  box->AddValue(m_tcb->m_minRtt.GetMicroSeconds ());
-  box->AddValue(m_calledFunc);
-  box->AddValue(m_tcb->m_congState);
-  box->AddValue(m_event);
-  box->AddValue(m_tcb->m_ecnState);
+  CollectSample(m_sample);
+  for (uint32_t i = 0; i < m_sample.size(); i++) {
+    box->AddValue(m_sample[i]);
+  }
 
   // Print data
   NS_LOG_INFO ("MyGetObservation: " << box);
   return box;
 }
 
+void
+TcpEventGymEnv::CollectSample(std::vector<double> &sample)
+{
+  sample.clear();
+  sample.push_back(m_socketUuid);
+  sample.push_back(0);
+  sample.push_back(Simulator::Now().GetMicroSeconds ());
+  sample.push_back(m_nodeId);
+  sample.push_back(m_tcb->m_ssThresh);
+  sample.push_back(m_tcb->m_cWnd);
+  sample.push_back(m_tcb->m_segmentSize);
+  sample.push_back(m_segmentsAcked);
+  sample.push_back(m_bytesInFlight);
+  sample.push_back(m_rtt.GetMicroSeconds ());
+  sample.push_back(m_tcb->m_minRtt.GetMicroSeconds ());
+  sample.push_back(m_calledFunc);
+  sample.push_back(m_tcb->m_congState);
+  sample.push_back(m_event);
+  sample.push_back(m_tcb->m_ecnState);
+}
+
+bool
+TcpEventGymEnv::ExecuteActions(Ptr<OpenGymDataContainer> action)
+{
+  m_actionReceived = true;
+  return TcpGymEnv::ExecuteActions(action);
+}
+
 void
 TcpEventGymEnv::TxPktTrace(Ptr<const Packet>, const TcpHeader&, Ptr<const TcpSocketBase>)
 {
@@ -345,6 +383,15 @@ TcpEventGymEnv::GetSsThresh (Ptr<const TcpSocketState> tcb, uint32_t bytesInFlig
   m_info = "GetSsThresh";
   m_tcb = tcb;
   m_bytesInFlight = bytesInFlight;
+  if (m_batcher) {
+    // notifies the agent once the batch is full
+    CollectSample(m_sample);
+    m_batcher->AddSample(m_sample);
+    if (!m_actionReceived) {
+      return std::max (2 * tcb->m_segmentSize, bytesInFlight / 2);
+    }
+    return m_new_ssThresh;
+  }
   Notify();
   return m_new_ssThresh;
 }
@@ -361,6 +408,14 @@ TcpEventGymEnv::IncreaseWindow (Ptr<TcpSocketState> tcb, uint32_t segmentsAcked)
   m_info = "IncreaseWindow";
   m_tcb = tcb;
   m_segmentsAcked = segmentsAcked;
+  if (m_batcher) {
+    CollectSample(m_sample);
+    m_batcher->AddSample(m_sample);
+    if (m_actionReceived) {
+      tcb->m_cWnd = m_new_cWnd;
+    }
+    return;
+  }
   Notify();
   tcb->m_cWnd = m_new_cWnd;
 }
@@ -110,10 +110,13 @@ public:
 
   void SetReward(float value);
   void SetPenalty(float value);
+  // batch events instead of notifying the agent on every one of them
+  void SetBatchSize(uint32_t batchSize);
 
   // OpenGym interface
   virtual Ptr<OpenGymSpace> GetObservationSpace();
   Ptr<OpenGymDataContainer> GetObservation();
+  virtual bool ExecuteActions(Ptr<OpenGymDataContainer> action);
 
   // trace packets, e.g. for calculating inter tx/rx time
   virtual void TxPktTrace(Ptr<const Packet>, const TcpHeader&, Ptr<const TcpSocketBase>);
@@ -128,6 +131,8 @@ public:
   virtual void CwndEvent (Ptr<TcpSocketState> tcb, const TcpSocketState::TcpCAEvent_t event);
 
 private:
+  void CollectSample(std::vector<double> &sample);
+
   // state
   CalledFunc_t m_calledFunc;
   Ptr<const TcpSocketState> m_tcb;
@@ -140,6 +145,11 @@ private:
   // reward
   float m_reward;
   float m_penalty;
+
+  // batched mode, actions apply until the agent answers the next batch
+  Ptr<OpenGymEventBatcher> m_batcher;
+  std::vector<double> m_sample;
+  bool m_actionReceived {false};
 };
 
 
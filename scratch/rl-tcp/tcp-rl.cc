@@ -271,6 +271,10 @@ TcpRl::GetTypeId (void)
                    DoubleValue (-10.0),
                    MakeDoubleAccessor (&TcpRl::m_penalty),
                    MakeDoubleChecker<double> ())
+    .AddAttribute ("BatchSize", "Number of events batched into one step, zero notifies the agent on every event.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TcpRl::m_batchSize),
+                   MakeUintegerChecker<uint32_t> ())
   ;
   return tid;
 }
@@ -305,6 +309,7 @@ TcpRl::CreateGymEnv()
   env->SetSocketUuid(TcpRlBase::GenerateUuid());
   env->SetReward(m_reward);
   env->SetPenalty(m_penalty);
+  env->SetBatchSize(m_batchSize);
   m_tcpGymEnv = env;
 
   ConnectSocketCallbacks();
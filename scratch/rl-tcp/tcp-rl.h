@@ -99,6 +99,7 @@ private:
   // OpenGymEnv env
   float m_reward {1.0};
   float m_penalty {-100.0};
+  uint32_t m_batchSize {0};
 };
 
 
@@ -2,6 +2,7 @@
 # -*- coding: utf-8 -*-
 
 import argparse
+import numpy as np
 from ns3gym import ns3env
 from tcp_base import TcpTimeBased
 from tcp_newreno import TcpNewReno
@@ -45,6 +46,14 @@ print("Action space: ", ac_space, ac_space.dtype)
 stepIdx = 0
 currIt = 0
 
+def latest_sample(obs):
+    # batched event-based env (ns3::TcpRl::BatchSize > 0), act on the newest event
+    if isinstance(obs, dict):
+        samples = np.asarray(obs['samples']).reshape(-1, len(obs['min']))
+        rows = min(int(obs['count'][0]), len(samples))
+        return samples[max(rows - 1, 0)]
+    return obs
+
 def get_agent(obs):
     socketUuid = obs[0]
     tcpEnvType = obs[1]
@@ -69,7 +78,7 @@ get_agent.ac_space = ac_space
 try:
     while True:
         print("Start iteration: ", currIt)
-        obs = env.reset()
+        obs = latest_sample(env.reset())
         reward = 0
         done = False
         info = None
@@ -86,6 +95,7 @@ try:
 
             print("Step: ", stepIdx)
             obs, reward, done, info = env.step(action)
+            obs = latest_sample(obs)
             print("---obs, reward, done, info: ", obs, reward, done, info)
 
             # get existing agent of create new TCP agent if needed
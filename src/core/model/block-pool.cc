@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "block-pool.h"
+#include <stdint.h>
+#include <new>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::BlockPool implementation.
+ */
+
+namespace ns3 {
+
+namespace {
+
+/** Size classes are multiples of this many bytes. */
+const std::size_t BLOCK_POOL_GRANULE = 16;
+/** Number of size classes, larger blocks use plain new. */
+const std::size_t BLOCK_POOL_CLASSES = 16;
+/** Free blocks a thread keeps per size class before returning them. */
+const uint32_t BLOCK_POOL_MAX_FREE = 4096;
+
+/** A free block, linked through its first bytes. */
+struct FreeBlock
+{
+  FreeBlock *next;  //!< Next free block of the same size class.
+};
+
+/**
+ * Free lists of one thread.
+ *
+ * Zero-initialized and trivially destructible, so it can still be
+ * checked while the thread (or the process) tears down.
+ */
+struct FreeLists
+{
+  FreeBlock *head[BLOCK_POOL_CLASSES];  //!< Free lists per size class.
+  uint32_t free[BLOCK_POOL_CLASSES];    //!< Length of the free lists.
+  bool registered;                      //!< Cleanup at thread exit armed.
+  bool dead;                            //!< Thread exits, no more caching.
+};
+
+thread_local FreeLists t_freeLists;
+
+/** Hands the free blocks back to the system when its thread exits. */
+struct FreeListsCleanup
+{
+  ~FreeListsCleanup ()
+  {
+    for (std::size_t i = 0; i < BLOCK_POOL_CLASSES; ++i)
+      {
+        while (t_freeLists.head[i])
+          {
+            FreeBlock *block = t_freeLists.head[i];
+            t_freeLists.head[i] = block->next;
+            ::operator delete (block);
+          }
+        t_freeLists.free[i] = 0;
+      }
+    t_freeLists.dead = true;
+  }
+};
+
+thread_local FreeListsCleanup t_freeListsCleanup;
+
+/**
+ * Get the free lists of the calling thread.
+ *
+ * \returns The free lists, or 0 if the thread is exiting.
+ */
+FreeLists *
+GetFreeLists (void)
+{
+  FreeLists *lists = &t_freeLists;
+  if (lists->dead)
+    {
+      // thread_local destructors running after the cleanup
+      return 0;
+    }
+  if (!lists->registered)
+    {
+      // first use constructs the cleanup object and registers its destructor
+      (void) &t_freeListsCleanup;
+      lists->registered = true;
+    }
+  return lists;
+}
+
+} // unnamed namespace
+
+void *
+BlockPool::Allocate (std::size_t size)
+{
+  std::size_t cls = (size - 1) / BLOCK_POOL_GRANULE;
+  if (cls >= BLOCK_POOL_CLASSES)
+    {
+      return ::operator new (size);
+    }
+  FreeLists *lists = GetFreeLists ();
+  if (lists && lists->head[cls])
+    {
+      FreeBlock *block = lists->head[cls];
+      lists->head[cls] = block->next;
+      lists->free[cls]--;
+      return block;
+    }
+  // whole size class, so the block can serve any object of that class later
+  return ::operator new ((cls + 1) * BLOCK_POOL_GRANULE);
+}
+
+std::size_t
+BlockPool::GetBlockSize (std::size_t size)
+{
+  std::size_t cls = (size - 1) / BLOCK_POOL_GRANULE;
+  if (cls >= BLOCK_POOL_CLASSES)
+    {
+      return size;
+    }
+  return (cls + 1) * BLOCK_POOL_GRANULE;
+}
+
+uint32_t
+BlockPool::GetCachedBlocks (void)
+{
+  uint32_t n = 0;
+  for (std::size_t i = 0; i < BLOCK_POOL_CLASSES; ++i)
+    {
+      n += t_freeLists.free[i];
+    }
+  return n;
+}
+
+void
+BlockPool::Deallocate (void *ptr, std::size_t size)
+{
+  if (ptr == 0)
+    {
+      return;
+    }
+  std::size_t cls = (size - 1) / BLOCK_POOL_GRANULE;
+  if (cls < BLOCK_POOL_CLASSES)
+    {
+      // blocks freed by another thread than the allocating one just move over
+      FreeLists *lists = GetFreeLists ();
+      if (lists && lists->free[cls] < BLOCK_POOL_MAX_FREE)
+        {
+          FreeBlock *block = static_cast<FreeBlock *> (ptr);
+          block->next = lists->head[cls];
+          lists->head[cls] = block;
+          lists->free[cls]++;
+          return;
+        }
+    }
+  ::operator delete (ptr);
+}
+
+} // namespace ns3
@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::BlockPool declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup core
+ * \brief Per-thread free lists of small fixed-size blocks.
+ *
+ * The blocks are sorted in 16-byte size classes up to 256 bytes;
+ * larger sizes go straight to the global heap. Each thread keeps a
+ * bounded number of free blocks per class, and hands them back to
+ * the system when it exits. A block may be freed by another thread
+ * than the one which allocated it.
+ *
+ * This is meant for the class-level operator new and delete of small
+ * objects allocated and freed at a high rate, such as EventImpl and
+ * CallbackImplBase.
+ */
+class BlockPool
+{
+public:
+  /**
+   * Allocate a block from the free list of its size class.
+   *
+   * \param [in] size The size of the object.
+   * \returns The memory for the object.
+   */
+  static void * Allocate (std::size_t size);
+  /**
+   * Return a block to the free list of its size class.
+   *
+   * \param [in] ptr The memory of the object.
+   * \param [in] size The size of the object, as passed to Allocate().
+   */
+  static void Deallocate (void *ptr, std::size_t size);
+  /**
+   * Get the size of the blocks of a size class.
+   *
+   * Memory obtained from ::operator new with this size can be given
+   * to Deallocate(), and blocks from Allocate() can be released with
+   * ::operator delete.
+   *
+   * \param [in] size The size of the object.
+   * \returns The size of the blocks which hold such objects.
+   */
+  static std::size_t GetBlockSize (std::size_t size);
+  /**
+   * Get the number of free blocks kept by the calling thread.
+   *
+   * \returns The number of blocks in the free lists of this thread.
+   */
+  static uint32_t GetCachedBlocks (void);
+};
+
+} // namespace ns3
+
+#endif /* BLOCK_POOL_H */
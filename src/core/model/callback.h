@@ -28,6 +28,8 @@
 #include "attribute.h"
 #include "attribute-helper.h"
 #include "simple-ref-count.h"
+#include "block-pool.h"
+#include <cstddef>
 #include <typeinfo>
 
 /**
@@ -135,12 +137,36 @@ struct CallbackTraits<T *>
  * \ingroup callbackimpl
  * Abstract base class for CallbackImpl
  * Provides reference counting and equality test.
+ *
+ * The implementations, with the object pointer and the arguments they
+ * bind, are allocated from the BlockPool, so MakeCallback, MakeBoundCallback
+ * and the contexts bound by TracedCallback::Connect do not hit malloc.
  */
 class CallbackImplBase : public SimpleRefCount<CallbackImplBase>
 {
 public:
   /** Virtual destructor */
   virtual ~CallbackImplBase () {}
+  /**
+   * Allocate an implementation from the BlockPool.
+   *
+   * \param [in] size The size of the implementation object.
+   * \returns The memory for the implementation.
+   */
+  static void * operator new (std::size_t size)
+  {
+    return BlockPool::Allocate (size);
+  }
+  /**
+   * Return an implementation to the BlockPool.
+   *
+   * \param [in] ptr The memory of the implementation.
+   * \param [in] size The size of the implementation object.
+   */
+  static void operator delete (void *ptr, std::size_t size)
+  {
+    BlockPool::Deallocate (ptr, size);
+  }
   /**
    * Equality test
    *
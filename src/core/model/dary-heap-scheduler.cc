@@ -0,0 +1,311 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "dary-heap-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+#include <limits>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * Implementation of ns3::DaryHeapScheduler class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DaryHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (DaryHeapScheduler);
+
+namespace {
+
+/** Number of children of a heap node. */
+const std::size_t DARY_HEAP_ARITY = 4;
+/**
+ * Unused keys in front of the root, so that the children of node i,
+ * at heap indexes 4i+1 to 4i+4, start on a multiple of four keys.
+ */
+const std::size_t DARY_HEAP_PAD = DARY_HEAP_ARITY - 1;
+/** Alignment of a group of siblings, a cache line. */
+const std::size_t DARY_HEAP_ALIGN = 64;
+
+} // unnamed namespace
+
+TypeId
+DaryHeapScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DaryHeapScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<DaryHeapScheduler> ()
+  ;
+  return tid;
+}
+
+DaryHeapScheduler::DaryHeapScheduler ()
+  : m_keys (0),
+    m_size (0),
+    m_capacity (0),
+    m_removedMinTs (std::numeric_limits<uint64_t>::max ())
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DaryHeapScheduler::~DaryHeapScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+bool
+DaryHeapScheduler::IsLess (const Key &a, const Key &b)
+{
+  return a.m_ts < b.m_ts || (a.m_ts == b.m_ts && a.m_uid < b.m_uid);
+}
+
+DaryHeapScheduler::Key &
+DaryHeapScheduler::At (std::size_t i)
+{
+  return m_keys[i + DARY_HEAP_PAD];
+}
+
+const DaryHeapScheduler::Key &
+DaryHeapScheduler::At (std::size_t i) const
+{
+  return m_keys[i + DARY_HEAP_PAD];
+}
+
+Scheduler::Event
+DaryHeapScheduler::GetEvent (const Key &key) const
+{
+  const Slot &slot = m_slots[key.m_slot];
+  Scheduler::Event ev;
+  ev.impl = slot.impl;
+  ev.key.m_ts = key.m_ts;
+  ev.key.m_uid = key.m_uid;
+  ev.key.m_context = slot.context;
+  return ev;
+}
+
+void
+DaryHeapScheduler::Grow (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::size_t capacity = std::max<std::size_t> (2 * m_capacity, 64);
+  std::size_t perLine = DARY_HEAP_ALIGN / sizeof (Key);
+  // one extra line of keys to move the start to a line boundary
+  std::vector<Key> storage (capacity + DARY_HEAP_PAD + perLine);
+  uintptr_t address = reinterpret_cast<uintptr_t> (&storage[0]);
+  std::size_t offset = 0;
+  if (address % sizeof (Key) == 0)
+    {
+      offset = ((DARY_HEAP_ALIGN - address % DARY_HEAP_ALIGN) % DARY_HEAP_ALIGN) / sizeof (Key);
+    }
+  Key *keys = &storage[offset];
+  if (m_size > 0)
+    {
+      std::copy (m_keys + DARY_HEAP_PAD, m_keys + DARY_HEAP_PAD + m_size, keys + DARY_HEAP_PAD);
+    }
+  m_storage.swap (storage);
+  m_keys = keys;
+  m_capacity = capacity;
+}
+
+void
+DaryHeapScheduler::SiftUp (std::size_t hole, Key key)
+{
+  NS_LOG_FUNCTION (this << hole);
+  while (hole > 0)
+    {
+      std::size_t parent = (hole - 1) / DARY_HEAP_ARITY;
+      if (!IsLess (key, At (parent)))
+        {
+          break;
+        }
+      At (hole) = At (parent);
+      hole = parent;
+    }
+  At (hole) = key;
+}
+
+void
+DaryHeapScheduler::SiftDown (std::size_t hole, Key key)
+{
+  NS_LOG_FUNCTION (this << hole);
+  while (true)
+    {
+      std::size_t first = hole * DARY_HEAP_ARITY + 1;
+      if (first >= m_size)
+        {
+          break;
+        }
+      std::size_t last = std::min (first + DARY_HEAP_ARITY, m_size);
+      std::size_t smallest = first;
+      for (std::size_t child = first + 1; child < last; child++)
+        {
+          if (IsLess (At (child), At (smallest)))
+            {
+              smallest = child;
+            }
+        }
+      if (!IsLess (At (smallest), key))
+        {
+          break;
+        }
+      At (hole) = At (smallest);
+      hole = smallest;
+    }
+  At (hole) = key;
+}
+
+DaryHeapScheduler::Key
+DaryHeapScheduler::PopRoot (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_size > 0);
+  Key root = At (0);
+  m_size--;
+  if (m_size > 0)
+    {
+      SiftDown (0, At (m_size));
+    }
+  m_freeSlots.push_back (root.m_slot);
+  return root;
+}
+
+void
+DaryHeapScheduler::PurgeRoot (void)
+{
+  NS_LOG_FUNCTION (this);
+  // no hash lookup while the root is earlier than all tombstones
+  while (m_size > 0 && At (0).m_ts >= m_removedMinTs)
+    {
+      std::unordered_set<uint32_t>::iterator it = m_removed.find (At (0).m_uid);
+      if (it == m_removed.end ())
+        {
+          return;
+        }
+      m_removed.erase (it);
+      PopRoot ();
+      if (m_removed.empty ())
+        {
+          m_removedMinTs = std::numeric_limits<uint64_t>::max ();
+        }
+    }
+}
+
+void
+DaryHeapScheduler::Compact (void)
+{
+  NS_LOG_FUNCTION (this << m_size << m_removed.size ());
+  std::size_t live = 0;
+  for (std::size_t i = 0; i < m_size; i++)
+    {
+      if (m_removed.erase (At (i).m_uid))
+        {
+          m_freeSlots.push_back (At (i).m_slot);
+        }
+      else
+        {
+          At (live++) = At (i);
+        }
+    }
+  NS_ASSERT (m_removed.empty ());
+  m_removedMinTs = std::numeric_limits<uint64_t>::max ();
+  m_size = live;
+  // bottom-up heap construction, from the last parent to the root
+  for (std::size_t i = m_size / DARY_HEAP_ARITY + 1; i-- > 0; )
+    {
+      SiftDown (i, At (i));
+    }
+}
+
+void
+DaryHeapScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  Slot slot;
+  slot.impl = ev.impl;
+  slot.context = ev.key.m_context;
+  Key key;
+  key.m_ts = ev.key.m_ts;
+  key.m_uid = ev.key.m_uid;
+  if (m_freeSlots.empty ())
+    {
+      key.m_slot = m_slots.size ();
+      m_slots.push_back (slot);
+    }
+  else
+    {
+      key.m_slot = m_freeSlots.back ();
+      m_freeSlots.pop_back ();
+      m_slots[key.m_slot] = slot;
+    }
+  if (m_size == m_capacity)
+    {
+      Grow ();
+    }
+  m_size++;
+  SiftUp (m_size - 1, key);
+}
+
+bool
+DaryHeapScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  // the root is never a tombstone, so a non-empty heap has a live event
+  return m_size == 0;
+}
+
+Scheduler::Event
+DaryHeapScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_size > 0);
+  return GetEvent (At (0));
+}
+
+Scheduler::Event
+DaryHeapScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  Event next = GetEvent (PopRoot ());
+  PurgeRoot ();
+  return next;
+}
+
+void
+DaryHeapScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_uid);
+  NS_ASSERT (m_size > 0);
+  if (At (0).m_uid == ev.key.m_uid)
+    {
+      PopRoot ();
+      PurgeRoot ();
+      return;
+    }
+  m_removed.insert (ev.key.m_uid);
+  m_removedMinTs = std::min (m_removedMinTs, ev.key.m_ts);
+  if (2 * m_removed.size () > m_size)
+    {
+      Compact ();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DARY_HEAP_SCHEDULER_H
+#define DARY_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+#include <unordered_set>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::DaryHeapScheduler declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a 4-ary heap event scheduler with lazy removal
+ *
+ * Compared to the HeapScheduler, this implementation is tuned for the
+ * memory hierarchy:
+ *  - the heap only moves 16-byte keys (time stamp, uid and the index of
+ *    a slot holding the EventImpl pointer and context), so the four
+ *    children of a node fill exactly one cache line;
+ *  - the key array is aligned such that every group of siblings starts
+ *    on a cache line boundary, so each level of a top-down heapify
+ *    touches a single line;
+ *  - a 4-ary heap is half as deep as a binary one.
+ *
+ * Remove does not search for the event: its uid is recorded as a
+ * tombstone and the key is dropped when it reaches the root. The root
+ * is never a tombstone, so PeekNext and IsEmpty stay exact, and the
+ * heap is rebuilt once tombstones outnumber the live events.
+ */
+class DaryHeapScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  DaryHeapScheduler ();
+  /** Destructor. */
+  virtual ~DaryHeapScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** Heap entry: the ordering part of the EventKey plus a slot index. */
+  struct Key
+  {
+    uint64_t m_ts;         /**< Event time stamp. */
+    uint32_t m_uid;        /**< Event unique id. */
+    uint32_t m_slot;       /**< Index in m_slots. */
+  };
+  /** The rest of the event, which never moves while in the heap. */
+  struct Slot
+  {
+    EventImpl *impl;       /**< Pointer to the event implementation. */
+    uint32_t context;      /**< Event context. */
+  };
+
+  /**
+   * Compare (less than) two keys by time stamp, then uid.
+   *
+   * \param [in] a The first key.
+   * \param [in] b The second key.
+   * \returns \c true if \c a < \c b
+   */
+  static inline bool IsLess (const Key &a, const Key &b);
+  /**
+   * Access the key at a heap index.
+   *
+   * \param [in] i The heap index, the root is 0.
+   * \returns The key.
+   */
+  inline Key & At (std::size_t i);
+  /**
+   * Access the key at a heap index.
+   *
+   * \param [in] i The heap index, the root is 0.
+   * \returns The key.
+   */
+  inline const Key & At (std::size_t i) const;
+  /**
+   * Build the Event stored under a key.
+   *
+   * \param [in] key The key.
+   * \returns The Event.
+   */
+  Scheduler::Event GetEvent (const Key &key) const;
+  /**
+   * Move a key up from a hole to its proper position.
+   *
+   * \param [in] hole The starting heap index.
+   * \param [in] key The key to place.
+   */
+  void SiftUp (std::size_t hole, Key key);
+  /**
+   * Move a key down from a hole to its proper position.
+   *
+   * \param [in] hole The starting heap index.
+   * \param [in] key The key to place.
+   */
+  void SiftDown (std::size_t hole, Key key);
+  /**
+   * Remove the root key and release its slot.
+   *
+   * \returns The root key.
+   */
+  Key PopRoot (void);
+  /** Drop tombstones sitting at the root. */
+  void PurgeRoot (void);
+  /** Drop all tombstones and rebuild the heap. */
+  void Compact (void);
+  /** Make room for one more key, keeping the alignment. */
+  void Grow (void);
+
+  /** Keys storage, over-allocated to align m_keys. */
+  std::vector<Key> m_storage;
+  /** Aligned start of the keys: heap index i is at m_keys[i + 3]. */
+  Key *m_keys;
+  /** Number of keys in the heap, tombstones included. */
+  std::size_t m_size;
+  /** Number of keys m_keys has room for. */
+  std::size_t m_capacity;
+  /** Event slots, indexed by Key::m_slot. */
+  std::vector<Slot> m_slots;
+  /** Unused entries of m_slots. */
+  std::vector<uint32_t> m_freeSlots;
+  /** Uids of the removed events still in the heap. */
+  std::unordered_set<uint32_t> m_removed;
+  /** Lower bound of the time stamps of the removed events. */
+  uint64_t m_removedMinTs;
+};
+
+} // namespace ns3
+
+#endif /* DARY_HEAP_SCHEDULER_H */
@@ -27,8 +27,11 @@
 #include "pointer.h"
 #include "assert.h"
 #include "log.h"
+#include "string.h"
+#include "enum.h"
 
 #include <cmath>
+#include <fstream>
 
 
 /**
@@ -53,11 +56,26 @@ DefaultSimulatorImpl::GetTypeId (void)
     .SetParent<SimulatorImpl> ()
     .SetGroupName ("Core")
     .AddConstructor<DefaultSimulatorImpl> ()
+    .AddAttribute ("ProfileFile",
+                   "The file where the wall clock time spent in each type "
+                   "of event is written at Simulator::Destroy; "
+                   "empty to disable the profiler.",
+                   StringValue (""),
+                   MakeStringAccessor (&DefaultSimulatorImpl::SetProfileFile,
+                                       &DefaultSimulatorImpl::GetProfileFile),
+                   MakeStringChecker ())
+    .AddAttribute ("ProfileFormat",
+                   "The format of the profiler file.",
+                   EnumValue (EventProfiler::CSV),
+                   MakeEnumAccessor (&DefaultSimulatorImpl::m_profileFormat),
+                   MakeEnumChecker (EventProfiler::CSV, "CSV",
+                                    EventProfiler::FOLDED, "Folded"))
   ;
   return tid;
 }
 
 DefaultSimulatorImpl::DefaultSimulatorImpl ()
+  : m_eventsWithContext (4096)
 {
   NS_LOG_FUNCTION (this);
   m_stop = false;
@@ -72,13 +90,15 @@ DefaultSimulatorImpl::DefaultSimulatorImpl ()
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
   m_eventCount = 0;
-  m_eventsWithContextEmpty = true;
   m_main = SystemThread::Self();
+  m_profiler = 0;
+  m_profileFormat = EventProfiler::CSV;
 }
 
 DefaultSimulatorImpl::~DefaultSimulatorImpl ()
 {
   NS_LOG_FUNCTION (this);
+  delete m_profiler;
 }
 
 void
@@ -109,6 +129,38 @@ DefaultSimulatorImpl::Destroy ()
           ev->Invoke ();
         }
     }
+  if (m_profiler != 0)
+    {
+      std::ofstream os (m_profileFile.c_str ());
+      if (!os.is_open ())
+        {
+          NS_FATAL_ERROR ("Cannot open the profiler file " << m_profileFile);
+        }
+      m_profiler->Print (os, m_profileFormat);
+      m_profiler->Clear ();
+    }
+}
+
+void
+DefaultSimulatorImpl::SetProfileFile (std::string file)
+{
+  NS_LOG_FUNCTION (this << file);
+  m_profileFile = file;
+  if (file.empty ())
+    {
+      delete m_profiler;
+      m_profiler = 0;
+    }
+  else if (m_profiler == 0)
+    {
+      m_profiler = new EventProfiler ();
+    }
+}
+
+std::string
+DefaultSimulatorImpl::GetProfileFile (void) const
+{
+  return m_profileFile;
 }
 
 void
@@ -148,7 +200,14 @@ DefaultSimulatorImpl::ProcessOneEvent (void)
   m_currentTs = next.key.m_ts;
   m_currentContext = next.key.m_context;
   m_currentUid = next.key.m_uid;
-  next.impl->Invoke ();
+  if (m_profiler == 0)
+    {
+      next.impl->Invoke ();
+    }
+  else
+    {
+      m_profiler->Invoke (next.impl);
+    }
   next.impl->Unref ();
 
   ProcessEventsWithContext ();
@@ -163,22 +222,14 @@ DefaultSimulatorImpl::IsFinished (void) const
 void
 DefaultSimulatorImpl::ProcessEventsWithContext (void)
 {
-  if (m_eventsWithContextEmpty)
+  if (m_eventsWithContext.IsEmpty ())
     {
       return;
     }
 
-  // swap queues
-  EventsWithContext eventsWithContext;
-  {
-    CriticalSection cs (m_eventsWithContextMutex);
-    m_eventsWithContext.swap(eventsWithContext);
-    m_eventsWithContextEmpty = true;
-  }
-  while (!eventsWithContext.empty ())
+  EventWithContext event;
+  while (m_eventsWithContext.Pop (event))
     {
-       EventWithContext event = eventsWithContext.front ();
-       eventsWithContext.pop_front ();
        Scheduler::Event ev;
        ev.impl = event.event;
        ev.key.m_ts = m_currentTs + event.timestamp;
@@ -243,6 +294,10 @@ DefaultSimulatorImpl::Schedule (Time const &delay, EventImpl *event)
   m_uid++;
   m_unscheduledEvents++;
   m_events->Insert (ev);
+  if (m_profiler != 0)
+    {
+      m_profiler->Scheduled (event, delay.GetTimeStep ());
+    }
   return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
 }
 
@@ -262,6 +317,10 @@ DefaultSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay,
       m_uid++;
       m_unscheduledEvents++;
       m_events->Insert (ev);
+      if (m_profiler != 0)
+        {
+          m_profiler->Scheduled (event, delay.GetTimeStep ());
+        }
     }
   else
     {
@@ -270,11 +329,7 @@ DefaultSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay,
       // Current time added in ProcessEventsWithContext()
       ev.timestamp = delay.GetTimeStep ();
       ev.event = event;
-      {
-        CriticalSection cs (m_eventsWithContextMutex);
-        m_eventsWithContext.push_back(ev);
-        m_eventsWithContextEmpty = false;
-      }
+      m_eventsWithContext.Push (ev);
     }
 }
 
@@ -291,6 +346,10 @@ DefaultSimulatorImpl::ScheduleNow (EventImpl *event)
   m_uid++;
   m_unscheduledEvents++;
   m_events->Insert (ev);
+  if (m_profiler != 0)
+    {
+      m_profiler->Scheduled (event, 0);
+    }
   return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
 }
 
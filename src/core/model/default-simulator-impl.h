@@ -25,11 +25,13 @@
 #include "scheduler.h"
 #include "event-impl.h"
 #include "system-thread.h"
-#include "system-mutex.h"
+#include "mpsc-queue.h"
+#include "event-profiler.h"
 
 #include "ptr.h"
 
 #include <list>
+#include <string>
 
 /**
  * \file
@@ -43,6 +45,10 @@ namespace ns3 {
  * \ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * Setting the "ProfileFile" attribute enables an EventProfiler, which
+ * writes the wall clock time spent in each type of event to that file
+ * at Simulator::Destroy; failing to open the file is a fatal error.
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -86,6 +92,16 @@ private:
   void ProcessOneEvent (void);
   /** Move events from a different context into the main event queue. */
   void ProcessEventsWithContext (void);
+  /**
+   * Set the file the profiler writes, and enable the profiler.
+   * \param [in] file The file name, empty to disable the profiler.
+   */
+  void SetProfileFile (std::string file);
+  /**
+   * Get the file the profiler writes.
+   * \returns The file name.
+   */
+  std::string GetProfileFile (void) const;
  
   /** Wrap an event with its execution context. */
   struct EventWithContext {
@@ -96,17 +112,11 @@ private:
     /** The event implementation. */
     EventImpl *event;
   };
-  /** Container type for the events from a different context. */
-  typedef std::list<struct EventWithContext> EventsWithContext;
-  /** The container of events from a different context. */
-  EventsWithContext m_eventsWithContext;
   /**
-   * Flag \c true if all events with context have been moved to the
-   * primary event queue.
+   * The queue of events from a different thread.  Scheduling threads
+   * push without taking a lock, the main thread drains it.
    */
-  bool m_eventsWithContextEmpty;
-  /** Mutex to control access to the list of events with context. */
-  SystemMutex m_eventsWithContextMutex;
+  MpscQueue<struct EventWithContext> m_eventsWithContext;
 
   /** Container type for the events to run at Simulator::Destroy() */
   typedef std::list<EventId> DestroyEvents;
@@ -135,6 +145,13 @@ private:
 
   /** Main execution thread. */
   SystemThread::ThreadId m_main;
+
+  /** The profiler, if enabled. */
+  EventProfiler *m_profiler;
+  /** The file the profiler writes at Destroy. */
+  std::string m_profileFile;
+  /** The format of the profiler file. */
+  EventProfiler::Format m_profileFormat;
 };
 
 } // namespace ns3
@@ -19,7 +19,9 @@
  */
 
 #include "event-impl.h"
+#include "block-pool.h"
 #include "log.h"
+#include <new>
 
 /**
  * \file
@@ -31,6 +33,42 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+namespace {
+
+/** Whether new events come from the block pool. */
+bool g_eventPoolEnabled = true;
+
+} // unnamed namespace
+
+void *
+EventImpl::operator new (std::size_t size)
+{
+  if (!g_eventPoolEnabled)
+    {
+      // a whole block, as the pool may be enabled again before it is freed
+      return ::operator new (BlockPool::GetBlockSize (size));
+    }
+  return BlockPool::Allocate (size);
+}
+
+void
+EventImpl::operator delete (void *ptr, std::size_t size)
+{
+  if (!g_eventPoolEnabled)
+    {
+      ::operator delete (ptr);
+      return;
+    }
+  BlockPool::Deallocate (ptr, size);
+}
+
+void
+EventImpl::SetPoolEnabled (bool enabled)
+{
+  NS_LOG_FUNCTION (enabled);
+  g_eventPoolEnabled = enabled;
+}
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
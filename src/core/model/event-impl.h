@@ -21,6 +21,7 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
 
 /**
@@ -40,6 +41,11 @@ namespace ns3 {
  * when it reaches the time associated to this event. Most subclasses
  * are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * All subclasses are allocated from the per-thread free lists of
+ * BlockPool, so scheduling an event does not hit malloc once
+ * the simulation reached its steady state. The arguments bound by
+ * MakeEvent() are members of the subclass and live in the same block.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -48,6 +54,29 @@ public:
   EventImpl ();
   /** Destructor. */
   virtual ~EventImpl () = 0;
+  /**
+   * Allocate an event from the free list of its size class.
+   *
+   * \param [in] size The size of the event object.
+   * \returns The memory for the event.
+   */
+  static void * operator new (std::size_t size);
+  /**
+   * Return an event to the free list of its size class.
+   *
+   * \param [in] ptr The memory of the event.
+   * \param [in] size The size of the event object.
+   */
+  static void operator delete (void *ptr, std::size_t size);
+  /**
+   * Enable or disable the free lists, e.g. to compare against plain
+   * new and delete. This can be changed while events are pending:
+   * without the free lists, events still get whole blocks of their
+   * size class, so they can be returned to the free lists later.
+   *
+   * \param [in] enabled Whether new events come from the free lists.
+   */
+  static void SetPoolEnabled (bool enabled);
   /**
    * Called by the simulation engine to notify the event that it is time
    * to execute.
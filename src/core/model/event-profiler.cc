@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#if (__GNUC__ >= 3)
+#include <cxxabi.h>
+#endif
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3 {
+
+namespace {
+
+/**
+ * Order the types of event by decreasing wall time, then by name.
+ *
+ * \param [in] a The name and results of the first type.
+ * \param [in] b The name and results of the second type.
+ * \returns \c true if the first type comes first.
+ */
+template <typename Stats>
+bool
+CompareWallTime (const std::pair<std::string, const Stats *> &a,
+                 const std::pair<std::string, const Stats *> &b)
+{
+  if (a.second->wallNs != b.second->wallNs)
+    {
+      return a.second->wallNs > b.second->wallNs;
+    }
+  return a.first < b.first;
+}
+
+} // unnamed namespace
+
+EventProfiler::Stats::Stats ()
+  : count (0),
+    wallNs (0),
+    scheduled (0)
+{
+  std::fill (delays, delays + DELAY_BUCKETS, 0);
+}
+
+EventProfiler::EventProfiler ()
+{
+}
+
+EventProfiler::Stats &
+EventProfiler::Get (const EventImpl *event)
+{
+  return m_stats[std::type_index (typeid (*event))];
+}
+
+void
+EventProfiler::Scheduled (const EventImpl *event, uint64_t delay)
+{
+  Stats &stats = Get (event);
+  stats.scheduled++;
+  uint32_t bucket = 0;
+  while (delay != 0)
+    {
+      bucket++;
+      delay >>= 1;
+    }
+  stats.delays[bucket]++;
+}
+
+void
+EventProfiler::Invoke (EventImpl *event)
+{
+  if (event->IsCancelled ())
+    {
+      return;
+    }
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  event->Invoke ();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+  Stats &stats = Get (event);
+  stats.count++;
+  stats.wallNs += std::chrono::duration_cast<std::chrono::nanoseconds> (end - start).count ();
+}
+
+std::string
+EventProfiler::GetName (std::type_index type)
+{
+  std::string name = type.name ();
+#if (__GNUC__ >= 3)
+  int status;
+  char *demangled = abi::__cxa_demangle (name.c_str (), NULL, NULL, &status);
+  if (status == 0)
+    {
+      name = demangled;
+    }
+  std::free (demangled);
+#endif
+  // the local classes of the MakeEvent templates repeat their return
+  // type and parameters
+  std::string::size_type make = name.find ("MakeEvent<");
+  std::string::size_type args = name.find (">(");
+  if (make != std::string::npos && args != std::string::npos && args > make)
+    {
+      std::string::size_type start = name.rfind (' ', make);
+      start = (start == std::string::npos) ? 0 : start + 1;
+      name = name.substr (start, args + 1 - start);
+    }
+  return name;
+}
+
+void
+EventProfiler::Print (std::ostream &os, enum Format format) const
+{
+  // the most expensive types first
+  std::vector<std::pair<std::string, const Stats *> > sorted;
+  for (std::unordered_map<std::type_index, Stats>::const_iterator i = m_stats.begin ();
+       i != m_stats.end (); ++i)
+    {
+      sorted.push_back (std::make_pair (GetName (i->first), &i->second));
+    }
+  std::sort (sorted.begin (), sorted.end (), &CompareWallTime<Stats>);
+
+  if (format == CSV)
+    {
+      os << "event,count,wall_ns,mean_ns,scheduled,delay_histogram" << std::endl;
+    }
+  for (std::vector<std::pair<std::string, const Stats *> >::const_iterator i = sorted.begin ();
+       i != sorted.end (); ++i)
+    {
+      const Stats &stats = *i->second;
+      if (format == FOLDED)
+        {
+          if (stats.count != 0)
+            {
+              os << "ns3::Simulator::Run;" << i->first << " " << stats.wallNs << std::endl;
+            }
+          continue;
+        }
+      os << "\"" << i->first << "\"," << stats.count << "," << stats.wallNs << ","
+         << (stats.count == 0 ? 0 : stats.wallNs / stats.count) << "," << stats.scheduled << ",\"";
+      bool first = true;
+      for (uint32_t j = 0; j < DELAY_BUCKETS; j++)
+        {
+          if (stats.delays[j] == 0)
+            {
+              continue;
+            }
+          os << (first ? "" : " ") << (j == 0 ? 0 : (uint64_t) 1 << (j - 1)) << ":" << stats.delays[j];
+          first = false;
+        }
+      os << "\"" << std::endl;
+    }
+}
+
+void
+EventProfiler::Clear (void)
+{
+  m_stats.clear ();
+}
+
+} // namespace ns3
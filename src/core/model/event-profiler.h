@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include "event-impl.h"
+
+#include <stdint.h>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Wall clock time spent in each type of event.
+ *
+ * Unlike DesMetrics, which writes a trace of every event, the profiler
+ * only aggregates, per dynamic type of EventImpl: the number of events
+ * run, the wall clock time they took, and a histogram of the delays
+ * they were scheduled with. The EventImpl type of the events created by
+ * MakeEvent, and thus by Simulator::Schedule, is named after the
+ * function and the object type, e.g.
+ * \c ns3::MakeEvent<void (ns3::TcpSocketBase::*)(), ns3::TcpSocketBase*>,
+ * which identifies the handler unless a class has several of the same
+ * signature.
+ *
+ * The DefaultSimulatorImpl profiles its events when its "ProfileFile"
+ * attribute is set, and writes the results to that file at
+ * Simulator::Destroy:
+ * \code
+ *   Config::SetDefault ("ns3::DefaultSimulatorImpl::ProfileFile",
+ *                       StringValue ("profile.csv"));
+ * \endcode
+ *
+ * Only the events scheduled from the main thread are counted in the
+ * delay histograms.
+ */
+class EventProfiler
+{
+public:
+  /** The output formats. */
+  enum Format
+  {
+    /**
+     * One line per type: name, count, wall time and mean wall time in
+     * nanoseconds, number scheduled, and the delay histogram as
+     * space-separated \c bucket:count pairs, the bucket being the
+     * smallest delay, in time steps, of a power of two range.
+     */
+    CSV,
+    /** The wall time of each type, in the folded stacks of flame graphs. */
+    FOLDED
+  };
+
+  /** Constructor. */
+  EventProfiler ();
+
+  /**
+   * Count an event being scheduled.
+   *
+   * \param [in] event The event.
+   * \param [in] delay Its delay, in time steps.
+   */
+  void Scheduled (const EventImpl *event, uint64_t delay);
+  /**
+   * Run an event and count the time it takes.
+   *
+   * \param [in] event The event.
+   */
+  void Invoke (EventImpl *event);
+
+  /**
+   * Write the results.
+   *
+   * \param [in,out] os The stream.
+   * \param [in] format The format.
+   */
+  void Print (std::ostream &os, enum Format format) const;
+  /** Forget the results so far. */
+  void Clear (void);
+
+private:
+  /** Number of buckets of the delay histograms: 0, then the powers of two. */
+  static const uint32_t DELAY_BUCKETS = 65;
+
+  /** The results for one type of event. */
+  struct Stats
+  {
+    /** Constructor. */
+    Stats ();
+
+    uint64_t count;                   /**< Number of events run. */
+    uint64_t wallNs;                  /**< Wall clock time of these events. */
+    uint64_t scheduled;               /**< Number of events scheduled. */
+    uint64_t delays[DELAY_BUCKETS];   /**< Number of events scheduled per delay bucket. */
+  };
+
+  /**
+   * Get the results of a type of event.
+   *
+   * \param [in] event An event of that type.
+   * \returns The results.
+   */
+  Stats & Get (const EventImpl *event);
+  /**
+   * Get a readable name for a type of event.
+   *
+   * \param [in] type The type.
+   * \returns The name.
+   */
+  static std::string GetName (std::type_index type);
+
+  /** The results, by type of event. */
+  std::unordered_map<std::type_index, Stats> m_stats;
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
@@ -0,0 +1,294 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * Implementation of ns3::LadderScheduler class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (LadderScheduler);
+
+namespace {
+
+/**
+ * Largest bucket moved to Bottom as a whole, and largest Bottom
+ * accepting inserts before it is spread over a new rung.
+ */
+const std::size_t LADDER_THRESHOLD = 50;
+/** Deepest ladder, buckets of the last rung always go to Bottom. */
+const std::size_t LADDER_MAX_RUNGS = 8;
+
+/**
+ * Order Bottom from the latest to the earliest event.
+ *
+ * \param [in] a The first event.
+ * \param [in] b The second event.
+ * \returns \c true if \c a is later than \c b
+ */
+bool
+IsLater (const Scheduler::Event &a, const Scheduler::Event &b)
+{
+  return b.key < a.key;
+}
+
+} // unnamed namespace
+
+TypeId
+LadderScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LadderScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<LadderScheduler> ()
+  ;
+  return tid;
+}
+
+LadderScheduler::LadderScheduler ()
+  : m_topMin (0),
+    m_topMax (0),
+    m_topStart (0),
+    m_nRungs (0),
+    m_count (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LadderScheduler::~LadderScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint64_t
+LadderScheduler::GetRungCurrent (std::size_t rung) const
+{
+  const Rung &r = m_rungs[rung];
+  return r.m_start + r.m_current * r.m_width;
+}
+
+std::size_t
+LadderScheduler::FindRung (uint64_t ts) const
+{
+  // rung i + 1 ends where the current bucket of rung i starts
+  for (std::size_t i = 0; i < m_nRungs; i++)
+    {
+      if (ts >= GetRungCurrent (i))
+        {
+          return i;
+        }
+    }
+  return m_nRungs;
+}
+
+LadderScheduler::Bucket &
+LadderScheduler::GetBucket (std::size_t rung, uint64_t ts)
+{
+  Rung &r = m_rungs[rung];
+  std::size_t index = (ts - r.m_start) / r.m_width;
+  NS_ASSERT (index >= r.m_current && index < r.m_buckets.size ());
+  return r.m_buckets[index];
+}
+
+void
+LadderScheduler::SpawnRung (Bucket &events, uint64_t start, uint64_t end)
+{
+  NS_LOG_FUNCTION (this << events.size () << start << end);
+  NS_ASSERT (!events.empty () && end > start);
+  uint64_t span = end - start;
+  uint64_t n = events.size ();
+  // about one event per bucket
+  uint64_t width = std::max<uint64_t> ((span + n - 1) / n, 1);
+  std::size_t buckets = (span + width - 1) / width;
+
+  if (m_nRungs == m_rungs.size ())
+    {
+      m_rungs.push_back (Rung ());
+    }
+  Rung &rung = m_rungs[m_nRungs++];
+  rung.m_start = start;
+  rung.m_width = width;
+  rung.m_current = 0;
+  rung.m_buckets.resize (buckets);
+  for (Bucket::const_iterator i = events.begin (); i != events.end (); i++)
+    {
+      rung.m_buckets[(i->key.m_ts - start) / width].push_back (*i);
+    }
+  events.clear ();
+}
+
+void
+LadderScheduler::InsertBottom (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.key.m_ts);
+  m_bottom.insert (std::lower_bound (m_bottom.begin (), m_bottom.end (), ev, IsLater), ev);
+  if (m_bottom.size () <= LADDER_THRESHOLD || m_nRungs == LADDER_MAX_RUNGS)
+    {
+      return;
+    }
+  // Bottom covers the time up to the current bucket of the lowest rung;
+  // only spread it if that leaves few events per bucket.
+  uint64_t start = m_bottom.back ().key.m_ts;
+  uint64_t end = m_nRungs > 0 ? GetRungCurrent (m_nRungs - 1) : m_topStart;
+  if (end - start >= m_bottom.size ())
+    {
+      SpawnRung (m_bottom, start, end);
+    }
+}
+
+void
+LadderScheduler::Refill (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (m_bottom.empty () && m_count > 0)
+    {
+      if (m_nRungs == 0)
+        {
+          NS_ASSERT (!m_top.empty ());
+          m_topStart = m_topMax + 1;
+          SpawnRung (m_top, m_topMin, m_topStart);
+        }
+      Rung &rung = m_rungs[m_nRungs - 1];
+      while (rung.m_current < rung.m_buckets.size ()
+             && rung.m_buckets[rung.m_current].empty ())
+        {
+          rung.m_current++;
+        }
+      if (rung.m_current == rung.m_buckets.size ())
+        {
+          m_nRungs--;
+          continue;
+        }
+      std::size_t level = m_nRungs - 1;
+      std::size_t index = rung.m_current++;
+      uint64_t start = rung.m_start + index * rung.m_width;
+      uint64_t width = rung.m_width;
+      Bucket &bucket = rung.m_buckets[index];
+      if (bucket.size () > LADDER_THRESHOLD && width > 1
+          && m_nRungs < LADDER_MAX_RUNGS)
+        {
+          // spawning may reallocate the rungs, so take the events out first
+          Bucket events;
+          events.swap (bucket);
+          SpawnRung (events, start, start + width);
+          m_rungs[level].m_buckets[index].swap (events);
+        }
+      else
+        {
+          m_bottom.swap (bucket);
+          std::sort (m_bottom.begin (), m_bottom.end (), IsLater);
+        }
+    }
+}
+
+void
+LadderScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  uint64_t ts = ev.key.m_ts;
+  m_count++;
+  if (ts >= m_topStart)
+    {
+      if (m_top.empty ())
+        {
+          m_topMin = ts;
+          m_topMax = ts;
+        }
+      m_topMin = std::min (m_topMin, ts);
+      m_topMax = std::max (m_topMax, ts);
+      m_top.push_back (ev);
+    }
+  else
+    {
+      std::size_t rung = FindRung (ts);
+      if (rung < m_nRungs)
+        {
+          GetBucket (rung, ts).push_back (ev);
+        }
+      else
+        {
+          InsertBottom (ev);
+        }
+    }
+  Refill ();
+}
+
+bool
+LadderScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_count == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!m_bottom.empty ());
+  return m_bottom.back ();
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!m_bottom.empty ());
+  Event next = m_bottom.back ();
+  m_bottom.pop_back ();
+  m_count--;
+  Refill ();
+  return next;
+}
+
+void
+LadderScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  uint64_t ts = ev.key.m_ts;
+  std::size_t rung = FindRung (ts);
+  if (ts < m_topStart && rung == m_nRungs)
+    {
+      Bucket::iterator i = std::lower_bound (m_bottom.begin (), m_bottom.end (), ev, IsLater);
+      NS_ASSERT (i != m_bottom.end () && i->key.m_uid == ev.key.m_uid);
+      m_bottom.erase (i);
+    }
+  else
+    {
+      Bucket &events = ts >= m_topStart ? m_top : GetBucket (rung, ts);
+      Bucket::iterator i = events.begin ();
+      while (i != events.end () && i->key.m_uid != ev.key.m_uid)
+        {
+          i++;
+        }
+      NS_ASSERT (i != events.end ());
+      *i = events.back ();
+      events.pop_back ();
+    }
+  m_count--;
+  Refill ();
+}
+
+} // namespace ns3
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::LadderScheduler declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This is the Ladder Queue of W.T. Tang, R.S.M. Goh and I.L.-J. Thng,
+ * "Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation", ACM TOMACS 15(3), 2005.
+ *
+ * Events live in one of three tiers:
+ *  - Top: an unsorted vector of the events later than all the others,
+ *    which is where most new events land;
+ *  - Ladder: rungs of unsorted buckets. When the ladder runs out, Top
+ *    is spread over a new rung with one bucket per event, and a bucket
+ *    holding too many events is spread over a finer child rung;
+ *  - Bottom: a small sorted vector of the earliest events, refilled one
+ *    bucket at a time, and the only tier which is ever sorted.
+ *
+ * Unlike the CalendarScheduler, the structure adapts through the rungs
+ * it spawns for the region being dequeued and never resizes globally.
+ * All tiers are vectors, so a steady-state simulation reuses their
+ * storage instead of allocating nodes. The invariant kept by every
+ * operation is that Bottom is not empty if the scheduler is not, so
+ * PeekNext does not need to touch the ladder.
+ */
+class LadderScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  LadderScheduler ();
+  /** Destructor. */
+  virtual ~LadderScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** A bucket, or any unsorted set of events. */
+  typedef std::vector<Scheduler::Event> Bucket;
+
+  /** One rung of the ladder, covering [m_start, m_start + width * buckets). */
+  struct Rung
+  {
+    uint64_t m_start;              /**< Time stamp of the first bucket. */
+    uint64_t m_width;              /**< Time span of every bucket. */
+    std::size_t m_current;         /**< Next bucket to dequeue. */
+    std::vector<Bucket> m_buckets; /**< The buckets. */
+  };
+
+  /**
+   * Get the start of the next bucket to dequeue in a rung.
+   *
+   * \param [in] rung The rung index.
+   * \returns The time stamp, events before it belong to a lower tier.
+   */
+  uint64_t GetRungCurrent (std::size_t rung) const;
+  /**
+   * Find the rung an event with the given time stamp belongs to.
+   *
+   * \param [in] ts The time stamp.
+   * \returns The rung index, or the number of rungs for Bottom.
+   */
+  std::size_t FindRung (uint64_t ts) const;
+  /**
+   * Get the bucket of a rung an event with the given time stamp belongs to.
+   *
+   * \param [in] rung The rung index.
+   * \param [in] ts The time stamp.
+   * \returns The bucket.
+   */
+  Bucket & GetBucket (std::size_t rung, uint64_t ts);
+  /**
+   * Spread events over a new lowest rung.
+   *
+   * \param [in,out] events The events, cleared on return.
+   * \param [in] start The lowest time stamp of the rung.
+   * \param [in] end The time stamp after the rung.
+   */
+  void SpawnRung (Bucket &events, uint64_t start, uint64_t end);
+  /**
+   * Insert an event in Bottom, keeping it sorted.
+   *
+   * \param [in] ev The event.
+   */
+  void InsertBottom (const Scheduler::Event &ev);
+  /** Move the next events to Bottom, if it is empty. */
+  void Refill (void);
+
+  /** Unsorted events at or after m_topStart. */
+  Bucket m_top;
+  /** Lowest time stamp in Top. */
+  uint64_t m_topMin;
+  /** Highest time stamp in Top. */
+  uint64_t m_topMax;
+  /** Events before this time stamp are on the ladder or in Bottom. */
+  uint64_t m_topStart;
+  /** The rungs, m_rungs[0] is the coarsest one. */
+  std::vector<Rung> m_rungs;
+  /** Number of rungs in use, the others only keep their storage. */
+  std::size_t m_nRungs;
+  /** Earliest events, sorted from the latest to the earliest. */
+  Bucket m_bottom;
+  /** Number of events in the scheduler. */
+  uint32_t m_count;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
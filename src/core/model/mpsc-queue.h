@@ -0,0 +1,279 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include "system-mutex.h"
+#include "assert.h"
+#include <atomic>
+#include <list>
+#include <thread>
+#include <stdint.h>
+
+/**
+ * @file
+ * @ingroup thread
+ * ns3::MpscQueue declaration and template implementation.
+ */
+
+namespace ns3 {
+
+/**
+ * @ingroup thread
+ * @brief A bounded lock-free multi-producer single-consumer queue.
+ *
+ * Any thread can Push; only one thread, the consumer, can call Pop and
+ * IsEmpty. Items are kept in a ring of cells, each with a sequence
+ * number telling whether it holds an item (D. Vyukov's bounded queue),
+ * so a Push is one compare-and-swap and no allocation, and producers
+ * never wait for each other or for the consumer.
+ *
+ * When the ring is full, items go to a list guarded by a SystemMutex
+ * instead, until the consumer has taken that list. The consumer drains
+ * the ring up to the point the list was started before returning the
+ * listed items, so items pushed by one thread are always popped in the
+ * order they were pushed.
+ *
+ * @tparam T \explicit The item type, copied in and out of the queue.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+  /**
+   * Constructor.
+   *
+   * @param [in] capacity The number of cells of the ring, a power of two.
+   */
+  explicit MpscQueue (uint32_t capacity);
+  /** Destructor. */
+  ~MpscQueue ();
+
+  /**
+   * Add an item, from any thread.
+   *
+   * @param [in] item The item.
+   */
+  void Push (const T &item);
+  /**
+   * Take the oldest item, from the consumer thread.
+   *
+   * @param [out] item The item.
+   * @returns \c false if there was no item ready.
+   */
+  bool Pop (T &item);
+  /**
+   * Check for items, from the consumer thread.
+   *
+   * @returns \c true if no item was pushed since the last Pop.
+   */
+  bool IsEmpty (void) const;
+
+private:
+  /** One cell of the ring. */
+  struct Cell
+  {
+    /** Position of the item for the consumer, or of the next one for producers. */
+    std::atomic<uint64_t> sequence;
+    /** The item. */
+    T item;
+  };
+
+  /**
+   * Add an item to the ring.
+   *
+   * @param [in] item The item.
+   * @returns \c false if the ring is full.
+   */
+  bool TryPush (const T &item);
+  /**
+   * Take the item at the head of the ring.
+   *
+   * @param [out] item The item.
+   * @param [in] wait Wait for a producer which took the cell but did not
+   *             fill it yet, instead of returning \c false.
+   * @returns \c false if there was no item ready.
+   */
+  bool TryPop (T &item, bool wait);
+
+  /**
+   * Copy constructor, not implemented.
+   * @param [in] o The queue to copy.
+   */
+  MpscQueue (const MpscQueue &o);
+  /**
+   * Assignment, not implemented.
+   * @param [in] o The queue to copy.
+   * @returns The queue.
+   */
+  MpscQueue & operator = (const MpscQueue &o);
+
+  /** The ring. */
+  Cell *m_cells;
+  /** Cell index mask, the capacity less one. */
+  uint64_t m_mask;
+  /** Keep the producers' position off the cache line of the members above. */
+  char m_pad0[64];
+  /** Position of the next Push. */
+  std::atomic<uint64_t> m_tail;
+  /** Keep the consumer's state off the cache line of m_tail. */
+  char m_pad1[64];
+  /** Position of the next Pop. */
+  uint64_t m_head;
+  /** Items pushed while the ring was full. */
+  std::list<T> m_overflow;
+  /** Flag \c true if m_overflow is not empty. */
+  std::atomic<bool> m_overflowing;
+  /** Mutex to control access to m_overflow. */
+  SystemMutex m_overflowMutex;
+  /** Overflow items taken by the consumer. */
+  std::list<T> m_batch;
+  /** Ring position to reach before returning items from m_batch. */
+  uint64_t m_batchStart;
+};
+
+} // namespace ns3
+
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3 {
+
+template <typename T>
+MpscQueue<T>::MpscQueue (uint32_t capacity)
+  : m_cells (new Cell[capacity]),
+    m_mask (capacity - 1),
+    m_tail (0),
+    m_head (0),
+    m_overflowing (false),
+    m_batchStart (0)
+{
+  NS_ASSERT_MSG (capacity > 0 && (capacity & (capacity - 1)) == 0,
+                 "MpscQueue capacity must be a power of two");
+  for (uint32_t i = 0; i < capacity; i++)
+    {
+      m_cells[i].sequence.store (i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+MpscQueue<T>::~MpscQueue ()
+{
+  delete [] m_cells;
+}
+
+template <typename T>
+bool
+MpscQueue<T>::TryPush (const T &item)
+{
+  uint64_t position = m_tail.load (std::memory_order_relaxed);
+  while (true)
+    {
+      Cell &cell = m_cells[position & m_mask];
+      uint64_t sequence = cell.sequence.load (std::memory_order_acquire);
+      int64_t diff = (int64_t) sequence - (int64_t) position;
+      if (diff == 0)
+        {
+          if (m_tail.compare_exchange_weak (position, position + 1, std::memory_order_relaxed))
+            {
+              cell.item = item;
+              cell.sequence.store (position + 1, std::memory_order_release);
+              return true;
+            }
+        }
+      else if (diff < 0)
+        {
+          // the consumer did not take the item of the previous round yet
+          return false;
+        }
+      else
+        {
+          position = m_tail.load (std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+void
+MpscQueue<T>::Push (const T &item)
+{
+  if (!m_overflowing.load () && TryPush (item))
+    {
+      return;
+    }
+  CriticalSection cs (m_overflowMutex);
+  m_overflow.push_back (item);
+  m_overflowing.store (true);
+}
+
+template <typename T>
+bool
+MpscQueue<T>::TryPop (T &item, bool wait)
+{
+  Cell &cell = m_cells[m_head & m_mask];
+  while (cell.sequence.load (std::memory_order_acquire) != m_head + 1)
+    {
+      if (!wait)
+        {
+          return false;
+        }
+      std::this_thread::yield ();
+    }
+  item = cell.item;
+  cell.sequence.store (m_head + m_mask + 1, std::memory_order_release);
+  m_head++;
+  return true;
+}
+
+template <typename T>
+bool
+MpscQueue<T>::Pop (T &item)
+{
+  if (m_batch.empty () && m_overflowing.load ())
+    {
+      CriticalSection cs (m_overflowMutex);
+      // every ring item pushed before the listed ones is below the tail
+      m_batchStart = m_tail.load ();
+      m_batch.swap (m_overflow);
+      m_overflowing.store (false);
+    }
+  if (!m_batch.empty ())
+    {
+      if (m_head < m_batchStart)
+        {
+          return TryPop (item, true);
+        }
+      item = m_batch.front ();
+      m_batch.pop_front ();
+      return true;
+    }
+  return TryPop (item, false);
+}
+
+template <typename T>
+bool
+MpscQueue<T>::IsEmpty (void) const
+{
+  return m_head == m_tail.load (std::memory_order_acquire)
+         && m_batch.empty () && !m_overflowing.load ();
+}
+
+} // namespace ns3
+
+#endif /* MPSC_QUEUE_H */
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "rollback.h"
+#include "assert.h"
+#include <set>
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::Rollback implementation.
+ */
+
+namespace ns3 {
+
+namespace {
+
+/** The journal of the event run by the calling thread, if it may be rolled back. */
+thread_local Rollback::Journal *g_journal = 0;
+
+/**
+ * Get the types which save their state.
+ *
+ * \returns The types.
+ */
+std::set<TypeId> &
+GetSupported (void)
+{
+  static std::set<TypeId> supported;
+  return supported;
+}
+
+} // unnamed namespace
+
+bool
+Rollback::IsEnabled (void)
+{
+  return g_journal != 0;
+}
+
+void
+Rollback::Save (const Callback<void> &undo)
+{
+  NS_ASSERT_MSG (g_journal != 0, "Rollback::Save outside of an event which may be rolled back");
+  g_journal->push_back (undo);
+}
+
+void
+Rollback::SetJournal (Journal *journal)
+{
+  g_journal = journal;
+}
+
+void
+Rollback::SetSupported (TypeId tid)
+{
+  GetSupported ().insert (tid);
+}
+
+bool
+Rollback::IsSupported (TypeId tid)
+{
+  return GetSupported ().count (tid) != 0;
+}
+
+} // namespace ns3
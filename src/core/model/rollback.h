@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_ROLLBACK_H
+#define NS3_ROLLBACK_H
+
+#include "callback.h"
+#include "type-id.h"
+#include <vector>
+
+/**
+ * \file
+ * \ingroup events
+ * ns3::Rollback declaration and NS_ROLLBACK_SUPPORTED() macro definition.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup events
+ * \brief State saving for simulators which may roll events back.
+ *
+ * An optimistic SimulatorImpl runs events before it knows whether an
+ * earlier event will still arrive, and undoes them when one does. The
+ * simulator undoes its own bookkeeping; models undo theirs: while
+ * IsEnabled, an event must call Save, before it changes the state of
+ * a model, with a callback restoring that state. The callbacks are run
+ * from the latest to the earliest if the event is rolled back, and
+ * dropped once it can no longer be.
+ *
+ * A model declares with NS_ROLLBACK_SUPPORTED that its type does so;
+ * the simulators run the nodes holding any other object conservatively.
+ * Trace sinks are not rolled back: they see the events which are.
+ */
+class Rollback
+{
+public:
+  /** The undo callbacks saved by one event, in the order they were saved. */
+  typedef std::vector<Callback<void> > Journal;
+
+  /**
+   * Check whether the current event may be rolled back.
+   *
+   * \returns \c true if the changes of the state must be saved.
+   */
+  static bool IsEnabled (void);
+  /**
+   * Save how to undo a change the current event is about to make.
+   *
+   * \param [in] undo The callback restoring the state.
+   */
+  static void Save (const Callback<void> &undo);
+  /**
+   * Set where the calling thread saves the undo callbacks; for the
+   * simulators, around the events which may be rolled back.
+   *
+   * \param [in] journal The journal of the event, or 0 to disable saving.
+   */
+  static void SetJournal (Journal *journal);
+
+  /**
+   * Declare that a type saves its state.
+   *
+   * \param [in] tid The type, not its subclasses.
+   */
+  static void SetSupported (TypeId tid);
+  /**
+   * Check whether a type saves its state.
+   *
+   * \param [in] tid The type.
+   * \returns \c true if SetSupported was called for this exact type.
+   */
+  static bool IsSupported (TypeId tid);
+};
+
+} // namespace ns3
+
+/**
+ * \ingroup events
+ * \brief Declare that an Object subclass saves its state with Rollback.
+ *
+ * \param [in] type The class.
+ */
+#define NS_ROLLBACK_SUPPORTED(type)                     \
+  static struct Rollback ## type ## SupportClass        \
+  {                                                     \
+    Rollback ## type ## SupportClass () {               \
+      ns3::Rollback::SetSupported (type::GetTypeId ()); \
+    }                                                   \
+  } Rollback ## type ## SupportVariable
+
+#endif /* NS3_ROLLBACK_H */
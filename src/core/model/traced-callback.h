@@ -22,6 +22,7 @@
 #define TRACED_CALLBACK_H
 
 #include <list>
+#include <vector>
 #include "callback.h"
 
 /**
@@ -222,9 +223,19 @@ public:
 
   
 private:
+  /** Finish an invocation of the chain, compacting it if it was the outermost one. */
+  void EndInvoke (void) const;
+  /** Remove the entries nulled by Disconnect from the chain. */
+  void Compact (void) const;
+
   /**
    * Container type for holding the chain of Callbacks.
    *
+   * The chain is contiguous and walked by index.  A Callback may
+   * connect or disconnect sinks while the chain is invoked: new sinks
+   * are appended, and disconnected ones are nulled in place and only
+   * erased once the outermost invocation returns.
+   *
    * \tparam T1 \deduced Type of the first argument to the functor.
    * \tparam T2 \deduced Type of the second argument to the functor.
    * \tparam T3 \deduced Type of the third argument to the functor.
@@ -234,9 +245,13 @@ private:
    * \tparam T7 \deduced Type of the seventh argument to the functor.
    * \tparam T8 \deduced Type of the eighth argument to the functor.
    */
-  typedef std::list<Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> > CallbackList;
+  typedef std::vector<Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> > CallbackList;
   /** The chain of Callbacks. */
-  CallbackList m_callbackList;
+  mutable CallbackList m_callbackList;
+  /** Number of invocations of the chain in progress. */
+  mutable uint32_t m_depth;
+  /** Whether the chain holds entries nulled by Disconnect. */
+  mutable bool m_erased;
 };
 
 } // namespace ns3
@@ -253,7 +268,9 @@ template<typename T1, typename T2,
          typename T5, typename T6,
          typename T7, typename T8>
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::TracedCallback ()
-  : m_callbackList () 
+  : m_callbackList (),
+    m_depth (0),
+    m_erased (false)
 {
 }
 template<typename T1, typename T2,
@@ -289,17 +306,18 @@ void
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::DisconnectWithoutContext (const CallbackBase & callback)
 {
   for (typename CallbackList::iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); /* empty */)
+       i != m_callbackList.end (); i++)
     {
-      if ((*i).IsEqual (callback))
-        {
-          i = m_callbackList.erase (i);
-        }
-      else
+      if (!(*i).IsNull () && (*i).IsEqual (callback))
         {
-          i++;
+          *i = Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> ();
+          m_erased = true;
         }
     }
+  if (m_depth == 0)
+    {
+      Compact ();
+    }
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -319,13 +337,54 @@ template<typename T1, typename T2,
          typename T5, typename T6,
          typename T7, typename T8>
 void 
-TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (void) const
+TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::EndInvoke (void) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
+  if (--m_depth == 0 && m_erased)
+    {
+      Compact ();
+    }
+}
+template<typename T1, typename T2, 
+         typename T3, typename T4,
+         typename T5, typename T6,
+         typename T7, typename T8>
+void 
+TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::Compact (void) const
+{
+  if (!m_erased)
+    {
+      return;
+    }
+  typename CallbackList::iterator last = m_callbackList.begin ();
+  for (typename CallbackList::iterator i = m_callbackList.begin ();
        i != m_callbackList.end (); i++)
     {
-      (*i)();
+      if (!(*i).IsNull ())
+        {
+          *last++ = *i;
+        }
+    }
+  m_callbackList.erase (last, m_callbackList.end ());
+  m_erased = false;
+}
+template<typename T1, typename T2, 
+         typename T3, typename T4,
+         typename T5, typename T6,
+         typename T7, typename T8>
+void 
+TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (void) const
+{
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
+    {
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb ();
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -334,11 +393,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -347,11 +412,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -360,11 +431,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2, T3 a3) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2, a3);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2, a3);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -373,11 +450,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2, T3 a3, T4 a4) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2, a3, a4);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2, a3, a4);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -386,11 +469,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2, T3 a3, T4 a4, T5 a5) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2, a3, a4, a5);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2, a3, a4, a5);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -399,11 +488,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2, T3 a3, T4 a4, T5 a5, T6 a6) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2, a3, a4, a5, a6);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2, a3, a4, a5, a6);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -412,11 +507,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2, T3 a3, T4 a4, T5 a5, T6 a6, T7 a7) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2, a3, a4, a5, a6, a7);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2, a3, a4, a5, a6, a7);
+        }
     }
+  EndInvoke ();
 }
 template<typename T1, typename T2, 
          typename T3, typename T4,
@@ -425,11 +526,17 @@ template<typename T1, typename T2,
 void 
 TracedCallback<T1,T2,T3,T4,T5,T6,T7,T8>::operator() (T1 a1, T2 a2, T3 a3, T4 a4, T5 a5, T6 a6, T7 a7, T8 a8) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  ++m_depth;
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(a1, a2, a3, a4, a5, a6, a7, a8);
+      // Copy: a Connect from the Callback may reallocate the chain.
+      Callback<void,T1,T2,T3,T4,T5,T6,T7,T8> cb = m_callbackList[i];
+      if (!cb.IsNull ())
+        {
+          cb (a1, a2, a3, a4, a5, a6, a7, a8);
+        }
     }
+  EndInvoke ();
 }
 
 } // namespace ns3
@@ -21,8 +21,21 @@
 #include "ns3/simulator.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/heap-scheduler.h"
+#include "ns3/dary-heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/ladder-scheduler.h"
+#include "ns3/event-profiler.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/string.h"
+#include "ns3/block-pool.h"
+#include "ns3/make-event.h"
+#include <fstream>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <vector>
 
 using namespace ns3;
 
@@ -461,6 +474,424 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SimulatorRemoveTestCase : public TestCase
+{
+public:
+  SimulatorRemoveTestCase (ObjectFactory schedulerFactory);
+  virtual void DoRun (void);
+  void RemovableEvent (uint32_t i);
+  std::vector<EventId> m_ids;
+  std::vector<bool> m_removed;
+  std::vector<uint32_t> m_order;
+  ObjectFactory m_schedulerFactory;
+};
+
+SimulatorRemoveTestCase::SimulatorRemoveTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check that removed events are skipped in order with " +
+              schedulerFactory.GetTypeId ().GetName ()),
+    m_schedulerFactory (schedulerFactory)
+{
+}
+
+void
+SimulatorRemoveTestCase::RemovableEvent (uint32_t i)
+{
+  m_order.push_back (i);
+  // also remove events while the simulation runs
+  uint32_t next = i + 7;
+  if (next < m_ids.size () && !m_removed[next] && !m_ids[next].IsExpired ())
+    {
+      Simulator::Remove (m_ids[next]);
+      m_removed[next] = true;
+    }
+}
+
+void
+SimulatorRemoveTestCase::DoRun (void)
+{
+  const uint32_t n = 2000;
+  Simulator::SetScheduler (m_schedulerFactory);
+
+  m_ids.clear ();
+  m_removed.assign (n, false);
+  m_order.clear ();
+  std::vector<uint64_t> times;
+  uint32_t state = 12345;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      state = state * 1103515245 + 12345;
+      // half of the events crowded in a short interval, many at the
+      // same time, to exercise dense buckets and the uid ordering
+      uint64_t ns = (state >> 8) % (i % 2 ? 300000 : 2000);
+      times.push_back (ns);
+      m_ids.push_back (Simulator::Schedule (NanoSeconds (ns), &SimulatorRemoveTestCase::RemovableEvent, this, i));
+    }
+  for (uint32_t i = 0; i < n; i += 3)
+    {
+      Simulator::Remove (m_ids[i]);
+      m_removed[i] = true;
+    }
+  Simulator::Run ();
+
+  uint32_t expected = 0;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      expected += m_removed[i] ? 0 : 1;
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_order.size (), expected, "Wrong number of events run");
+  for (uint32_t k = 0; k < m_order.size (); k++)
+    {
+      uint32_t i = m_order[k];
+      NS_TEST_EXPECT_MSG_EQ (m_removed[i], false, "Removed event " << i << " did run");
+      if (k > 0)
+        {
+          uint32_t prev = m_order[k - 1];
+          bool inOrder = times[prev] < times[i] || (times[prev] == times[i] && prev < i);
+          NS_TEST_EXPECT_MSG_EQ (inOrder, true, "Event " << i << " run out of order");
+        }
+    }
+  Simulator::Destroy ();
+}
+
+class SchedulerReferenceTestCase : public TestCase
+{
+public:
+  SchedulerReferenceTestCase (ObjectFactory schedulerFactory);
+  virtual void DoRun (void);
+  ObjectFactory m_schedulerFactory;
+};
+
+SchedulerReferenceTestCase::SchedulerReferenceTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check random inserts and removes against a sorted set with " +
+              schedulerFactory.GetTypeId ().GetName ()),
+    m_schedulerFactory (schedulerFactory)
+{
+}
+
+void
+SchedulerReferenceTestCase::DoRun (void)
+{
+  typedef std::pair<uint64_t, uint32_t> Key;
+  // the scheduler only stores the implementation, never runs it
+  EventImpl *impl = reinterpret_cast<EventImpl *> (0x1000);
+  for (uint32_t mode = 0; mode < 4; mode++)
+    {
+      Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+      std::mt19937_64 rng (mode + 1);
+      std::exponential_distribution<double> exponential (0.01);
+      std::set<Key> reference;
+      std::map<uint32_t, uint64_t> live;
+      uint64_t now = 0;
+      uint32_t uid = 1;
+      for (uint32_t i = 0; i < 100000; i++)
+        {
+          uint32_t op = rng () % 10;
+          Scheduler::Event ev;
+          ev.impl = impl;
+          ev.key.m_context = 0;
+          if (op < 5 || reference.empty ())
+            {
+              uint64_t delay;
+              switch (mode)
+                {
+                case 0:
+                  delay = rng () % 1000;
+                  break;
+                case 1:
+                  // mostly simultaneous events
+                  delay = rng () % 2 ? 0 : rng () % 10;
+                  break;
+                case 2:
+                  // a few events far in the future
+                  delay = rng () % 100 == 0 ? rng () % 100000000 : rng () % 50;
+                  break;
+                default:
+                  delay = exponential (rng);
+                  break;
+                }
+              ev.key.m_ts = now + delay;
+              ev.key.m_uid = uid++;
+              scheduler->Insert (ev);
+              reference.insert (Key (ev.key.m_ts, ev.key.m_uid));
+              live[ev.key.m_uid] = ev.key.m_ts;
+            }
+          else if (op < 8)
+            {
+              ev = scheduler->RemoveNext ();
+              NS_TEST_ASSERT_MSG_EQ (ev.key.m_ts, reference.begin ()->first, "Wrong next event, mode " << mode);
+              NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, reference.begin ()->second, "Wrong next event, mode " << mode);
+              now = ev.key.m_ts;
+              reference.erase (reference.begin ());
+              live.erase (ev.key.m_uid);
+            }
+          else
+            {
+              std::map<uint32_t, uint64_t>::iterator it = live.lower_bound (rng () % uid);
+              if (it == live.end ())
+                {
+                  continue;
+                }
+              ev.key.m_ts = it->second;
+              ev.key.m_uid = it->first;
+              scheduler->Remove (ev);
+              reference.erase (Key (it->second, it->first));
+              live.erase (it);
+            }
+          NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), reference.empty (), "Wrong emptiness, mode " << mode);
+        }
+      while (!reference.empty ())
+        {
+          Scheduler::Event ev = scheduler->RemoveNext ();
+          NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, reference.begin ()->second, "Wrong event when draining, mode " << mode);
+          reference.erase (reference.begin ());
+        }
+    }
+}
+
+class SimulatorEventPoolTestCase : public TestCase
+{
+public:
+  SimulatorEventPoolTestCase ();
+  virtual void DoRun (void);
+  void Event1 (uint64_t a);
+  void Event2 (uint64_t a, uint64_t b);
+  void Event3 (uint64_t a, uint64_t b, uint64_t c);
+  void Event4 (uint64_t a, uint64_t b, uint64_t c, uint64_t d);
+  void Event5 (uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e);
+  void Reschedule (uint32_t i);
+  uint64_t m_sum;
+};
+
+SimulatorEventPoolTestCase::SimulatorEventPoolTestCase ()
+  : TestCase ("Check the event pool can be toggled while events are pending"),
+    m_sum (0)
+{
+}
+
+void
+SimulatorEventPoolTestCase::Event1 (uint64_t a)
+{
+  m_sum += a;
+}
+
+void
+SimulatorEventPoolTestCase::Event2 (uint64_t a, uint64_t b)
+{
+  m_sum += a + b;
+}
+
+void
+SimulatorEventPoolTestCase::Event3 (uint64_t a, uint64_t b, uint64_t c)
+{
+  m_sum += a + b + c;
+}
+
+void
+SimulatorEventPoolTestCase::Event4 (uint64_t a, uint64_t b, uint64_t c, uint64_t d)
+{
+  m_sum += a + b + c + d;
+}
+
+void
+SimulatorEventPoolTestCase::Event5 (uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t e)
+{
+  m_sum += a + b + c + d + e;
+}
+
+void
+SimulatorEventPoolTestCase::Reschedule (uint32_t i)
+{
+  // events freed while running are reused by these ones, of other
+  // sizes in the same size classes
+  EventImpl::SetPoolEnabled (i % 2 == 0);
+  Simulator::Schedule (NanoSeconds (1), &SimulatorEventPoolTestCase::Event5, this, i, i, i, i, i);
+  Simulator::Schedule (NanoSeconds (2), &SimulatorEventPoolTestCase::Event3, this, i, i, i);
+  Simulator::Schedule (NanoSeconds (3), &SimulatorEventPoolTestCase::Event1, this, i);
+}
+
+void
+SimulatorEventPoolTestCase::DoRun (void)
+{
+  for (std::size_t size = 1; size <= 256; size++)
+    {
+      std::size_t block = BlockPool::GetBlockSize (size);
+      NS_TEST_ASSERT_MSG_EQ ((block >= size && block % 16 == 0 && block - size < 16), true,
+                             "Wrong block size for " << size);
+    }
+  NS_TEST_ASSERT_MSG_EQ (BlockPool::GetBlockSize (1000), 1000, "Large sizes are not pooled");
+
+  // an event allocated without the pool, freed into it, then reused by
+  // a larger event of the same size class
+  m_sum = 0;
+  EventImpl::SetPoolEnabled (false);
+  EventImpl *small = MakeEvent (&SimulatorEventPoolTestCase::Event2, this, 1, 2);
+  EventImpl::SetPoolEnabled (true);
+  small->Invoke ();
+  small->Unref ();
+  EventImpl *large = MakeEvent (&SimulatorEventPoolTestCase::Event3, this, 3, 4, 5);
+  EventImpl *next = MakeEvent (&SimulatorEventPoolTestCase::Event1, this, 6);
+  large->Invoke ();
+  next->Invoke ();
+  large->Unref ();
+  next->Unref ();
+  NS_TEST_ASSERT_MSG_EQ (m_sum, 21, "Events corrupted");
+
+  m_sum = 0;
+  uint64_t expected = 0;
+  const uint32_t n = 1000;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      // events allocated with the pool disabled are freed with it enabled, and
+      // the other way round
+      EventImpl::SetPoolEnabled (i % 3 != 0);
+      Simulator::Schedule (MicroSeconds (i), &SimulatorEventPoolTestCase::Reschedule, this, i);
+      Simulator::Schedule (MicroSeconds (i), &SimulatorEventPoolTestCase::Event2, this, i, 1);
+      Simulator::Schedule (MicroSeconds (i), &SimulatorEventPoolTestCase::Event4, this, i, 1, 2, 3);
+      expected += 11 * i + 7;
+    }
+  EventImpl::SetPoolEnabled (false);
+  Simulator::Run ();
+  EventImpl::SetPoolEnabled (true);
+  Simulator::Destroy ();
+  NS_TEST_EXPECT_MSG_EQ (m_sum, expected, "Events corrupted");
+}
+
+class SimulatorProfilerTestCase : public TestCase
+{
+public:
+  SimulatorProfilerTestCase ();
+  virtual void DoRun (void);
+  void Profiled (void);
+  uint32_t m_runs;
+};
+
+SimulatorProfilerTestCase::SimulatorProfilerTestCase ()
+  : TestCase ("Check the counts of the event profiler"),
+    m_runs (0)
+{
+}
+
+void
+SimulatorProfilerTestCase::Profiled (void)
+{
+  m_runs++;
+}
+
+void
+SimulatorProfilerTestCase::DoRun (void)
+{
+  EventProfiler profiler;
+  uint64_t delays[] = { 0, 1, 5, 6, 7 };
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      EventImpl *event = MakeEvent (&SimulatorProfilerTestCase::Profiled, this);
+      profiler.Scheduled (event, delays[i]);
+      if (i == 4)
+        {
+          event->Cancel ();
+        }
+      profiler.Invoke (event);
+      event->Unref ();
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_runs, 4, "The cancelled event did run");
+
+  std::ostringstream csv;
+  profiler.Print (csv, EventProfiler::CSV);
+  std::istringstream lines (csv.str ());
+  std::string header;
+  std::string line;
+  std::getline (lines, header);
+  std::getline (lines, line);
+  NS_TEST_ASSERT_MSG_EQ (header, "event,count,wall_ns,mean_ns,scheduled,delay_histogram", "Wrong header");
+  NS_TEST_EXPECT_MSG_NE (line.find ("SimulatorProfilerTestCase"), std::string::npos, "Event type not named");
+  NS_TEST_EXPECT_MSG_EQ (line.substr (line.find ("\",") + 2, 2), "4,", "Wrong count of events run");
+  NS_TEST_EXPECT_MSG_NE (line.find (",5,\"0:1 1:1 4:3\""), std::string::npos, "Wrong delay histogram");
+  NS_TEST_EXPECT_MSG_EQ (lines.peek (), EOF, "More than one type of event");
+
+  std::ostringstream folded;
+  profiler.Print (folded, EventProfiler::FOLDED);
+  NS_TEST_EXPECT_MSG_EQ (folded.str ().find ("ns3::Simulator::Run;"), 0, "Wrong folded stack");
+
+  profiler.Clear ();
+  std::ostringstream empty;
+  profiler.Print (empty, EventProfiler::FOLDED);
+  NS_TEST_EXPECT_MSG_EQ (empty.str (), "", "Results not cleared");
+}
+
+class SimulatorProfileFileTestCase : public TestCase
+{
+public:
+  SimulatorProfileFileTestCase ();
+  virtual void DoRun (void);
+  void Profiled (uint32_t i);
+  void Destroyed (void);
+  uint32_t m_runs;
+};
+
+SimulatorProfileFileTestCase::SimulatorProfileFileTestCase ()
+  : TestCase ("Check the profiler file written at Simulator::Destroy"),
+    m_runs (0)
+{
+}
+
+void
+SimulatorProfileFileTestCase::Profiled (uint32_t i)
+{
+  m_runs++;
+  if (i > 0)
+    {
+      Simulator::Schedule (MicroSeconds (1), &SimulatorProfileFileTestCase::Profiled, this, i - 1);
+    }
+}
+
+void
+SimulatorProfileFileTestCase::Destroyed (void)
+{
+}
+
+void
+SimulatorProfileFileTestCase::DoRun (void)
+{
+  std::string file = CreateTempDirFilename ("simulator-profile.csv");
+  Simulator::Destroy ();
+  Ptr<DefaultSimulatorImpl> impl = CreateObject<DefaultSimulatorImpl> ();
+  impl->SetAttribute ("ProfileFile", StringValue (file));
+  Simulator::SetImplementation (impl);
+
+  // the same type of event as the ones Profiled schedules
+  uint32_t chain = 4;
+  Simulator::Schedule (Seconds (1), &SimulatorProfileFileTestCase::Profiled, this, chain);
+  EventId cancelled = Simulator::Schedule (Seconds (2), &SimulatorProfileFileTestCase::Profiled, this, chain);
+  Simulator::Cancel (cancelled);
+  Simulator::ScheduleDestroy (&SimulatorProfileFileTestCase::Destroyed, this);
+  Simulator::Run ();
+  NS_TEST_ASSERT_MSG_EQ (m_runs, 5, "Wrong number of events run");
+  Simulator::Destroy ();
+
+  std::ifstream is (file.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (is.is_open (), true, "Profiler file not written");
+  std::string header;
+  std::getline (is, header);
+  NS_TEST_ASSERT_MSG_EQ (header, "event,count,wall_ns,mean_ns,scheduled,delay_histogram", "Wrong header");
+  // only the events run by Simulator::Run are profiled, one line per type
+  std::string line;
+  std::getline (is, line);
+  NS_TEST_EXPECT_MSG_NE (line.find ("SimulatorProfileFileTestCase"), std::string::npos, "Event type not named");
+  NS_TEST_EXPECT_MSG_EQ (line.find ("Destroyed"), std::string::npos, "Destroy event profiled");
+  std::istringstream fields (line.substr (line.find ("\",") + 2));
+  uint64_t count;
+  uint64_t wallNs;
+  uint64_t meanNs;
+  uint64_t scheduled;
+  char comma;
+  fields >> count >> comma >> wallNs >> comma >> meanNs >> comma >> scheduled;
+  NS_TEST_ASSERT_MSG_EQ (fields.fail (), false, "Cannot parse the profiler line " << line);
+  NS_TEST_EXPECT_MSG_EQ (count, 5, "Wrong count of events run");
+  NS_TEST_EXPECT_MSG_EQ (meanNs, wallNs / count, "Wrong mean wall clock time");
+  NS_TEST_EXPECT_MSG_EQ (scheduled, 6, "Wrong count of events scheduled");
+  NS_TEST_EXPECT_MSG_EQ (is.peek (), EOF, "More than one type of event");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -475,7 +906,29 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (HeapScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (DaryHeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (LadderScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+
+    std::string schedulerTypes[] = {
+      "ns3::ListScheduler",
+      "ns3::MapScheduler",
+      "ns3::HeapScheduler",
+      "ns3::DaryHeapScheduler",
+      "ns3::CalendarScheduler",
+      "ns3::LadderScheduler"
+    };
+    for (unsigned int i = 0; i < (sizeof (schedulerTypes) / sizeof (schedulerTypes[0])); ++i)
+      {
+        factory.SetTypeId (schedulerTypes[i]);
+        AddTestCase (new SimulatorRemoveTestCase (factory), TestCase::QUICK);
+        AddTestCase (new SchedulerReferenceTestCase (factory), TestCase::QUICK);
+      }
+    AddTestCase (new SimulatorEventPoolTestCase (), TestCase::QUICK);
+    AddTestCase (new SimulatorProfilerTestCase (), TestCase::QUICK);
+    AddTestCase (new SimulatorProfileFileTestCase (), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
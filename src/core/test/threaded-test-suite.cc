@@ -26,12 +26,15 @@
 #include "ns3/config.h"
 #include "ns3/string.h"
 #include "ns3/system-thread.h"
+#include "ns3/mpsc-queue.h"
+#include "ns3/block-pool.h"
 
 #include <chrono>  // seconds, milliseconds
 #include <ctime>
 #include <list>
 #include <thread>  // sleep_for
 #include <utility>
+#include <vector>
 
 using namespace ns3;
 
@@ -226,6 +229,227 @@ ThreadedSimulatorEventsTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ (m_a, m_d, "Bad scheduling");
 }
 
+/**
+ * Many threads scheduling events as fast as they can, enough to fill
+ * the queue of events from other threads: check that none is lost and
+ * that the events of each thread run in the order they were scheduled.
+ */
+class ThreadedSimulatorFloodTestCase : public TestCase
+{
+public:
+  ThreadedSimulatorFloodTestCase (unsigned int threads, unsigned int events);
+  static void SchedulingThread (std::pair<ThreadedSimulatorFloodTestCase *, unsigned int> context);
+  void Received (unsigned int threadno, unsigned int seq);
+  void Poll (void);
+  unsigned int m_threads;
+  unsigned int m_events;
+  std::vector<unsigned int> m_next;
+  unsigned int m_received;
+  std::string m_error;
+
+private:
+  virtual void DoRun (void);
+};
+
+ThreadedSimulatorFloodTestCase::ThreadedSimulatorFloodTestCase (unsigned int threads, unsigned int events)
+  : TestCase ("Check " + std::to_string (events) + " events from each of " +
+              std::to_string (threads) + " threads are all run in order"),
+    m_threads (threads),
+    m_events (events),
+    m_received (0)
+{
+}
+
+void
+ThreadedSimulatorFloodTestCase::SchedulingThread (std::pair<ThreadedSimulatorFloodTestCase *, unsigned int> context)
+{
+  ThreadedSimulatorFloodTestCase *me = context.first;
+  unsigned int threadno = context.second;
+  for (unsigned int seq = 0; seq < me->m_events; ++seq)
+    {
+      Simulator::ScheduleWithContext (threadno, Seconds (0),
+                                      &ThreadedSimulatorFloodTestCase::Received, me, threadno, seq);
+    }
+}
+
+void
+ThreadedSimulatorFloodTestCase::Received (unsigned int threadno, unsigned int seq)
+{
+  if (seq != m_next[threadno] && m_error.empty ())
+    {
+      m_error = "Events of thread " + std::to_string (threadno) + " out of order";
+    }
+  m_next[threadno] = seq + 1;
+  ++m_received;
+}
+
+void
+ThreadedSimulatorFloodTestCase::Poll (void)
+{
+  if (m_received == m_threads * m_events)
+    {
+      Simulator::Stop ();
+      return;
+    }
+  Simulator::Schedule (MicroSeconds (1), &ThreadedSimulatorFloodTestCase::Poll, this);
+}
+
+void
+ThreadedSimulatorFloodTestCase::DoRun (void)
+{
+  m_next.assign (m_threads, 0);
+  m_received = 0;
+  m_error = "";
+  Simulator::Schedule (MicroSeconds (1), &ThreadedSimulatorFloodTestCase::Poll, this);
+
+  std::list<Ptr<SystemThread> > threads;
+  for (unsigned int i = 0; i < m_threads; ++i)
+    {
+      threads.push_back (Create<SystemThread> (MakeBoundCallback (
+          &ThreadedSimulatorFloodTestCase::SchedulingThread,
+              std::pair<ThreadedSimulatorFloodTestCase *, unsigned int> (this, i))));
+      threads.back ()->Start ();
+    }
+
+  Simulator::Run ();
+  for (std::list<Ptr<SystemThread> >::iterator it = threads.begin (); it != threads.end (); ++it)
+    {
+      (*it)->Join ();
+    }
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_error.empty (), true, m_error);
+  NS_TEST_EXPECT_MSG_EQ (m_received, m_threads * m_events, "Events lost");
+}
+
+/**
+ * Producer threads pushing into a queue smaller than what they push,
+ * so they wait for the consumer: check that the items of each producer
+ * are popped in the order they were pushed.
+ */
+class MpscQueueTestCase : public TestCase
+{
+public:
+  MpscQueueTestCase (uint32_t capacity);
+  static void Producer (std::pair<MpscQueueTestCase *, unsigned int> context);
+  MpscQueue<std::pair<unsigned int, unsigned int> > m_queue;
+
+private:
+  virtual void DoRun (void);
+};
+
+static const unsigned int MPSC_PRODUCERS = 4;
+static const unsigned int MPSC_ITEMS = 50000;
+
+MpscQueueTestCase::MpscQueueTestCase (uint32_t capacity)
+  : TestCase ("Check MpscQueue of capacity " + std::to_string (capacity) +
+              " keeps the items of each producer in order"),
+    m_queue (capacity)
+{
+}
+
+void
+MpscQueueTestCase::Producer (std::pair<MpscQueueTestCase *, unsigned int> context)
+{
+  for (unsigned int seq = 0; seq < MPSC_ITEMS; ++seq)
+    {
+      context.first->m_queue.Push (std::make_pair (context.second, seq));
+    }
+}
+
+void
+MpscQueueTestCase::DoRun (void)
+{
+  std::list<Ptr<SystemThread> > threads;
+  for (unsigned int i = 0; i < MPSC_PRODUCERS; ++i)
+    {
+      threads.push_back (Create<SystemThread> (MakeBoundCallback (
+          &MpscQueueTestCase::Producer, std::pair<MpscQueueTestCase *, unsigned int> (this, i))));
+      threads.back ()->Start ();
+    }
+
+  std::vector<unsigned int> next (MPSC_PRODUCERS, 0);
+  bool ordered = true;
+  unsigned int popped = 0;
+  std::pair<unsigned int, unsigned int> item;
+  while (popped < MPSC_PRODUCERS * MPSC_ITEMS)
+    {
+      if (m_queue.Pop (item))
+        {
+          ordered = ordered && item.second == next[item.first];
+          next[item.first] = item.second + 1;
+          ++popped;
+        }
+    }
+  for (std::list<Ptr<SystemThread> >::iterator it = threads.begin (); it != threads.end (); ++it)
+    {
+      (*it)->Join ();
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (ordered, true, "Items of a producer out of order");
+  NS_TEST_EXPECT_MSG_EQ (m_queue.IsEmpty (), true, "Items left in the queue");
+}
+
+/**
+ * A thread_local object whose destructor runs after the cleanup of the
+ * BlockPool free lists of its thread, since it is constructed before
+ * them, and frees a block.
+ */
+struct BlockPoolLateFree
+{
+  ~BlockPoolLateFree ()
+  {
+    if (block)
+      {
+        BlockPool::Deallocate (block, 32);
+        *cached = BlockPool::GetCachedBlocks ();
+      }
+  }
+  void *block = 0;           //!< The block to free.
+  uint32_t *cached = 0;      //!< Where to store the count of cached blocks.
+};
+
+static thread_local BlockPoolLateFree t_blockPoolLateFree;
+
+/**
+ * Blocks freed by thread_local destructors once the free lists of the
+ * thread were handed back must go back to the system, not to free
+ * lists which nobody will drain.
+ */
+class BlockPoolThreadExitTestCase : public TestCase
+{
+public:
+  BlockPoolThreadExitTestCase ();
+  static void Thread (uint32_t *cached);
+
+private:
+  virtual void DoRun (void);
+};
+
+BlockPoolThreadExitTestCase::BlockPoolThreadExitTestCase ()
+  : TestCase ("Check blocks freed after the BlockPool cleanup of a thread are not cached")
+{
+}
+
+void
+BlockPoolThreadExitTestCase::Thread (uint32_t *cached)
+{
+  t_blockPoolLateFree.cached = cached;
+  t_blockPoolLateFree.block = BlockPool::Allocate (32);
+  BlockPool::Deallocate (BlockPool::Allocate (32), 32);
+  *cached = BlockPool::GetCachedBlocks ();
+}
+
+void
+BlockPoolThreadExitTestCase::DoRun (void)
+{
+  uint32_t cached = 0;
+  Ptr<SystemThread> thread = Create<SystemThread> (MakeBoundCallback (&BlockPoolThreadExitTestCase::Thread, &cached));
+  thread->Start ();
+  thread->Join ();
+  NS_TEST_EXPECT_MSG_EQ (cached, 0, "Block cached after the cleanup of its thread");
+}
+
 class ThreadedSimulatorTestSuite : public TestSuite
 {
 public:
@@ -241,8 +465,10 @@ public:
     std::string schedulerTypes[] = {
       "ns3::ListScheduler",
       "ns3::HeapScheduler",
+      "ns3::DaryHeapScheduler",
       "ns3::MapScheduler",
-      "ns3::CalendarScheduler"
+      "ns3::CalendarScheduler",
+      "ns3::LadderScheduler"
     };
     unsigned int threadcounts[] = {
       0,
@@ -263,5 +489,10 @@ public:
               }
           }
       }
+    AddTestCase (new ThreadedSimulatorFloodTestCase (1, 100000), TestCase::QUICK);
+    AddTestCase (new ThreadedSimulatorFloodTestCase (8, 20000), TestCase::QUICK);
+    AddTestCase (new MpscQueueTestCase (2), TestCase::QUICK);
+    AddTestCase (new MpscQueueTestCase (1024), TestCase::QUICK);
+    AddTestCase (new BlockPoolThreadExitTestCase (), TestCase::QUICK);
   }
 } g_threadedSimulatorTestSuite;
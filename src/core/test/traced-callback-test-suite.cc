@@ -113,6 +113,95 @@ BasicTracedCallbackTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (m_two, true, "Callback CbTwo not called");
 }
 
+class ReentrantTracedCallbackTestCase : public TestCase
+{
+public:
+  ReentrantTracedCallbackTestCase ();
+  virtual ~ReentrantTracedCallbackTestCase () {}
+
+private:
+  virtual void DoRun (void);
+
+  void CbOne (uint8_t a, double b);
+  void CbTwo (uint8_t a, double b);
+  void CbThree (uint8_t a, double b);
+
+  TracedCallback<uint8_t, double> m_trace;
+  uint32_t m_one;
+  uint32_t m_two;
+  uint32_t m_three;
+};
+
+ReentrantTracedCallbackTestCase::ReentrantTracedCallbackTestCase ()
+  : TestCase ("Check connecting and disconnecting from inside a TracedCallback")
+{
+}
+
+void
+ReentrantTracedCallbackTestCase::CbOne (uint8_t a, double b)
+{
+  NS_UNUSED (a);
+  NS_UNUSED (b);
+  m_one++;
+  //
+  // Disconnect ourselves, and connect enough sinks to make the chain grow
+  // while it is being invoked.
+  //
+  m_trace.DisconnectWithoutContext (MakeCallback (&ReentrantTracedCallbackTestCase::CbOne, this));
+  for (uint32_t i = 0; i < 32; i++)
+    {
+      m_trace.ConnectWithoutContext (MakeCallback (&ReentrantTracedCallbackTestCase::CbThree, this));
+    }
+}
+
+void
+ReentrantTracedCallbackTestCase::CbTwo (uint8_t a, double b)
+{
+  NS_UNUSED (a);
+  NS_UNUSED (b);
+  m_two++;
+}
+
+void
+ReentrantTracedCallbackTestCase::CbThree (uint8_t a, double b)
+{
+  NS_UNUSED (a);
+  NS_UNUSED (b);
+  m_three++;
+}
+
+void
+ReentrantTracedCallbackTestCase::DoRun (void)
+{
+  m_one = 0;
+  m_two = 0;
+  m_three = 0;
+  m_trace.ConnectWithoutContext (MakeCallback (&ReentrantTracedCallbackTestCase::CbOne, this));
+  m_trace.ConnectWithoutContext (MakeCallback (&ReentrantTracedCallbackTestCase::CbTwo, this));
+
+  //
+  // CbOne removes itself: CbTwo must not be skipped, and the sinks it
+  // appends are called by the same invocation.
+  //
+  m_trace (1, 2);
+  NS_TEST_ASSERT_MSG_EQ (m_one, 1, "Callback CbOne not called once");
+  NS_TEST_ASSERT_MSG_EQ (m_two, 1, "Callback CbTwo skipped");
+  NS_TEST_ASSERT_MSG_EQ (m_three, 32, "Appended callbacks not called");
+
+  m_trace (1, 2);
+  NS_TEST_ASSERT_MSG_EQ (m_one, 1, "Callback CbOne called after its disconnection");
+  NS_TEST_ASSERT_MSG_EQ (m_two, 2, "Callback CbTwo not called");
+  NS_TEST_ASSERT_MSG_EQ (m_three, 64, "Appended callbacks not called");
+
+  //
+  // Removing all the CbThree copies leaves CbTwo alone in the chain.
+  //
+  m_trace.DisconnectWithoutContext (MakeCallback (&ReentrantTracedCallbackTestCase::CbThree, this));
+  m_trace (1, 2);
+  NS_TEST_ASSERT_MSG_EQ (m_two, 3, "Callback CbTwo not called");
+  NS_TEST_ASSERT_MSG_EQ (m_three, 64, "Callback CbThree called after its disconnection");
+}
+
 class TracedCallbackTestSuite : public TestSuite
 {
 public:
@@ -123,6 +212,7 @@ TracedCallbackTestSuite::TracedCallbackTestSuite ()
   : TestSuite ("traced-callback", UNIT)
 {
   AddTestCase (new BasicTracedCallbackTestCase, TestCase::QUICK);
+  AddTestCase (new ReentrantTracedCallbackTestCase, TestCase::QUICK);
 }
 
 static TracedCallbackTestSuite tracedCallbackTestSuite;
@@ -0,0 +1,417 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "partition-helper.h"
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+#include <ns3/node-list.h>
+#include <ns3/uinteger.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::PartitionHelper implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("PartitionHelper");
+
+PartitionHelper::PartitionHelper ()
+  : m_imbalance (1.05),
+    m_lookAhead (Time::Max ()),
+    m_cut (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+PartitionHelper::SetNodeWeight (Ptr<Node> node, double weight)
+{
+  NS_LOG_FUNCTION (this << node << weight);
+  NS_ABORT_MSG_IF (weight < 0, "PartitionHelper: negative node weight");
+  uint32_t id = node->GetId ();
+  if (id >= m_weights.size ())
+    {
+      m_weights.resize (id + 1, 1.0);
+    }
+  m_weights[id] = weight;
+}
+
+void
+PartitionHelper::SetNodeWeight (NodeContainer nodes, double weight)
+{
+  NS_LOG_FUNCTION (this << weight);
+  for (NodeContainer::Iterator i = nodes.Begin (); i != nodes.End (); ++i)
+    {
+      SetNodeWeight (*i, weight);
+    }
+}
+
+void
+PartitionHelper::AddLink (Ptr<Node> a, Ptr<Node> b, Time delay, double traffic)
+{
+  NS_LOG_FUNCTION (this << a << b << delay << traffic);
+  NS_ABORT_MSG_IF (delay.IsStrictlyNegative (), "PartitionHelper: negative link delay");
+  Link link;
+  link.a = a->GetId ();
+  link.b = b->GetId ();
+  link.delay = delay.GetTimeStep ();
+  link.traffic = traffic;
+  m_links.push_back (link);
+}
+
+void
+PartitionHelper::SetImbalance (double imbalance)
+{
+  NS_LOG_FUNCTION (this << imbalance);
+  NS_ABORT_MSG_IF (imbalance < 1, "PartitionHelper: the imbalance must be at least 1");
+  m_imbalance = imbalance;
+}
+
+uint32_t
+PartitionHelper::Group (int64_t delay, std::vector<uint32_t> &group) const
+{
+  NS_LOG_FUNCTION (this << delay);
+  uint32_t n = NodeList::GetNNodes ();
+  std::vector<uint32_t> parent (n);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      parent[i] = i;
+    }
+  for (std::vector<Link>::const_iterator l = m_links.begin (); l != m_links.end (); ++l)
+    {
+      if (l->delay >= delay)
+        {
+          continue;
+        }
+      uint32_t a = l->a;
+      while (parent[a] != a)
+        {
+          a = parent[a] = parent[parent[a]];
+        }
+      uint32_t b = l->b;
+      while (parent[b] != b)
+        {
+          b = parent[b] = parent[parent[b]];
+        }
+      parent[std::max (a, b)] = std::min (a, b);
+    }
+
+  // number the groups in the order of their first node
+  uint32_t nGroups = 0;
+  group.assign (n, 0);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      uint32_t root = i;
+      while (parent[root] != root)
+        {
+          root = parent[root];
+        }
+      group[i] = root == i ? nGroups++ : group[root];
+    }
+  return nGroups;
+}
+
+double
+PartitionHelper::Assign (uint32_t nGroups, const std::vector<uint32_t> &group,
+                         uint32_t systemCount, std::vector<uint32_t> &rank) const
+{
+  NS_LOG_FUNCTION (this << nGroups << systemCount);
+
+  std::vector<double> weight (nGroups, 0);
+  double total = 0;
+  for (uint32_t i = 0; i < group.size (); ++i)
+    {
+      weight[group[i]] += m_weights[i];
+      total += m_weights[i];
+    }
+  std::vector<std::map<uint32_t, double> > traffic (nGroups);
+  for (std::vector<Link>::const_iterator l = m_links.begin (); l != m_links.end (); ++l)
+    {
+      uint32_t a = group[l->a];
+      uint32_t b = group[l->b];
+      if (a != b)
+        {
+          traffic[a][b] += l->traffic;
+          traffic[b][a] += l->traffic;
+        }
+    }
+
+  // Grow each rank from its first free group, always adding the free
+  // group with the most traffic towards the rank, until the rank holds
+  // its share of the load left.
+  rank.assign (nGroups, systemCount);
+  std::vector<double> load (systemCount, 0);
+  std::vector<uint32_t> size (systemCount, 0);
+  uint32_t free = nGroups;
+  uint32_t first = 0;
+  double left = total;
+  for (uint32_t r = 0; r < systemCount; ++r)
+    {
+      double share = left / (systemCount - r);
+      std::vector<double> gain (nGroups, 0);
+      std::set<std::pair<double, uint32_t> > frontier;
+      while (free > systemCount - 1 - r)
+        {
+          uint32_t g;
+          if (!frontier.empty ())
+            {
+              g = frontier.begin ()->second;
+            }
+          else
+            {
+              while (rank[first] != systemCount)
+                {
+                  ++first;
+                }
+              g = first;
+            }
+          if (r + 1 < systemCount && size[r] > 0
+              && load[r] + weight[g] - share > share - load[r])
+            {
+              break;
+            }
+          frontier.erase (std::make_pair (-gain[g], g));
+          rank[g] = r;
+          load[r] += weight[g];
+          size[r]++;
+          free--;
+          for (std::map<uint32_t, double>::const_iterator t = traffic[g].begin (); t != traffic[g].end (); ++t)
+            {
+              if (rank[t->first] == systemCount)
+                {
+                  frontier.erase (std::make_pair (-gain[t->first], t->first));
+                  gain[t->first] += t->second;
+                  frontier.insert (std::make_pair (-gain[t->first], t->first));
+                }
+            }
+          if (r + 1 < systemCount && load[r] >= share)
+            {
+              break;
+            }
+        }
+      left -= load[r];
+    }
+
+  // Move groups to the rank they exchange the most traffic with, if
+  // that rank has room, or to any lighter rank if theirs is overloaded.
+  double capacity = m_imbalance * total / systemCount;
+  std::vector<double> towards (systemCount);
+  for (uint32_t pass = 0; pass < 8; ++pass)
+    {
+      bool moved = false;
+      for (uint32_t g = 0; g < nGroups; ++g)
+        {
+          uint32_t own = rank[g];
+          if (size[own] == 1)
+            {
+              continue;
+            }
+          std::fill (towards.begin (), towards.end (), 0);
+          for (std::map<uint32_t, double>::const_iterator t = traffic[g].begin (); t != traffic[g].end (); ++t)
+            {
+              towards[rank[t->first]] += t->second;
+            }
+          bool overloaded = load[own] > capacity;
+          uint32_t best = own;
+          double bestGain = 0;
+          for (uint32_t r = 0; r < systemCount; ++r)
+            {
+              if (r == own)
+                {
+                  continue;
+                }
+              double after = load[r] + weight[g];
+              if (after > capacity && !(overloaded && after < load[own]))
+                {
+                  continue;
+                }
+              double gain = towards[r] - towards[own];
+              if (best == own ? (gain > 0 || overloaded) : gain > bestGain)
+                {
+                  best = r;
+                  bestGain = gain;
+                }
+            }
+          if (best != own)
+            {
+              rank[g] = best;
+              load[own] -= weight[g];
+              load[best] += weight[g];
+              size[own]--;
+              size[best]++;
+              moved = true;
+            }
+        }
+      if (!moved)
+        {
+          break;
+        }
+    }
+  return *std::max_element (load.begin (), load.end ());
+}
+
+void
+PartitionHelper::Partition (uint32_t systemCount)
+{
+  NS_LOG_FUNCTION (this << systemCount);
+  NS_ABORT_MSG_IF (systemCount == 0, "PartitionHelper: no rank");
+  uint32_t n = NodeList::GetNNodes ();
+  m_weights.resize (n, 1.0);
+  for (std::vector<Link>::const_iterator l = m_links.begin (); l != m_links.end (); ++l)
+    {
+      NS_ABORT_MSG_IF (l->a >= n || l->b >= n, "PartitionHelper: link to an unknown node");
+    }
+  double total = 0;
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      total += m_weights[i];
+    }
+
+  // Larger delays give a larger lookahead but coarser groups: try the
+  // delays from the largest one, cutting only the links at least that
+  // long, and keep the first assignment within the allowed imbalance,
+  // or the best balanced one if none is.
+  std::vector<int64_t> delays;
+  for (std::vector<Link>::const_iterator l = m_links.begin (); l != m_links.end (); ++l)
+    {
+      if (l->delay > 0)
+        {
+          delays.push_back (l->delay);
+        }
+    }
+  std::sort (delays.begin (), delays.end ());
+  delays.erase (std::unique (delays.begin (), delays.end ()), delays.end ());
+  std::reverse (delays.begin (), delays.end ());
+  if (delays.empty ())
+    {
+      // only zero-delay links, which can never be cut
+      delays.push_back (std::numeric_limits<int64_t>::max ());
+    }
+
+  std::vector<uint32_t> group;
+  std::vector<uint32_t> rank;
+  std::vector<uint32_t> bestGroup (n, 0);
+  std::vector<uint32_t> bestRank (1, 0);
+  double bestLoad = std::numeric_limits<double>::max ();
+  double capacity = m_imbalance * total / systemCount;
+  for (std::vector<int64_t>::const_iterator d = delays.begin (); d != delays.end (); ++d)
+    {
+      uint32_t nGroups = Group (*d, group);
+      double load = Assign (nGroups, group, systemCount, rank);
+      NS_LOG_LOGIC ("delay " << *d << " groups " << nGroups << " largest load " << load);
+      if (load < bestLoad)
+        {
+          bestLoad = load;
+          bestGroup.swap (group);
+          bestRank.swap (rank);
+        }
+      if (bestLoad <= capacity)
+        {
+          break;
+        }
+    }
+  if (bestLoad > capacity)
+    {
+      NS_LOG_WARN ("PartitionHelper: could not balance the load of " << systemCount << " ranks");
+    }
+
+  m_systemIds.resize (n);
+  m_loads.assign (systemCount, 0);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      m_systemIds[i] = bestRank[bestGroup[i]];
+      m_loads[m_systemIds[i]] += m_weights[i];
+      NodeList::GetNode (i)->SetAttribute ("SystemId", UintegerValue (m_systemIds[i]));
+    }
+  m_lookAhead = Time::Max ();
+  m_cut = 0;
+  for (std::vector<Link>::const_iterator l = m_links.begin (); l != m_links.end (); ++l)
+    {
+      if (m_systemIds[l->a] != m_systemIds[l->b])
+        {
+          m_lookAhead = std::min (m_lookAhead, TimeStep (l->delay));
+          m_cut += l->traffic;
+        }
+    }
+}
+
+uint32_t
+PartitionHelper::GetSystemId (Ptr<Node> node) const
+{
+  NS_ASSERT_MSG (node->GetId () < m_systemIds.size (), "PartitionHelper: node not partitioned");
+  return m_systemIds[node->GetId ()];
+}
+
+double
+PartitionHelper::GetLoad (uint32_t systemId) const
+{
+  NS_ASSERT (systemId < m_loads.size ());
+  return m_loads[systemId];
+}
+
+Time
+PartitionHelper::GetLookAhead (void) const
+{
+  return m_lookAhead;
+}
+
+double
+PartitionHelper::GetCutTraffic (void) const
+{
+  return m_cut;
+}
+
+void
+PartitionHelper::Print (std::ostream &os) const
+{
+  std::vector<uint32_t> nodes (m_loads.size (), 0);
+  double total = 0;
+  for (uint32_t i = 0; i < m_systemIds.size (); ++i)
+    {
+      nodes[m_systemIds[i]]++;
+      total += m_weights[i];
+    }
+  os << m_loads.size () << " ranks, lookahead ";
+  if (m_lookAhead == Time::Max ())
+    {
+      os << "unlimited";
+    }
+  else
+    {
+      os << m_lookAhead.As (Time::MS);
+    }
+  os << ", traffic cut " << m_cut << std::endl;
+  for (uint32_t r = 0; r < m_loads.size (); ++r)
+    {
+      os << "  rank " << r << ": " << nodes[r] << " nodes, load " << m_loads[r];
+      if (total > 0)
+        {
+          os << " (" << 100 * m_loads[r] / total << "%)";
+        }
+      os << std::endl;
+    }
+}
+
+} // namespace ns3
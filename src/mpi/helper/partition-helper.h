@@ -0,0 +1,205 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PARTITION_HELPER_H
+#define PARTITION_HELPER_H
+
+#include <ns3/node.h>
+#include <ns3/node-container.h>
+#include <ns3/nstime.h>
+#include <ns3/ptr.h>
+
+#include <ostream>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::PartitionHelper declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup mpi
+ * \brief Assign the nodes of a distributed simulation to the MPI ranks.
+ *
+ * Instead of choosing the system id of every node by hand, create the
+ * nodes with the default system id, describe the links which will be
+ * installed between them with AddLink and the expected load of the
+ * nodes with SetNodeWeight, then call Partition: it sets the
+ * "SystemId" attribute of every node of the NodeList.
+ *
+ * Partition must be called before the devices and channels are
+ * installed, since helpers like PointToPointHelper use the system ids
+ * of the nodes to choose between local and remote channels, and before
+ * Simulator::Run, where the lookahead is computed. Every rank builds the
+ * same topology and computes the same, deterministic, assignment.
+ *
+ * The lookahead of the simulation is the smallest delay of the links
+ * between ranks, so the partitioner first looks for the largest delay
+ * such that merging the nodes linked by shorter links still leaves
+ * groups small enough to balance the ranks. The groups are then grown
+ * into ranks along the links carrying the most traffic, and moved
+ * between ranks as long as this lowers the traffic cut without
+ * exceeding the load allowed by SetImbalance.
+ *
+ * \code
+ *   NodeContainer nodes;
+ *   nodes.Create (4);
+ *   PartitionHelper partition;
+ *   partition.AddLink (nodes.Get (0), nodes.Get (1), MilliSeconds (1));
+ *   partition.AddLink (nodes.Get (1), nodes.Get (2), MilliSeconds (10));
+ *   partition.AddLink (nodes.Get (2), nodes.Get (3), MilliSeconds (1));
+ *   partition.Partition (MpiInterface::GetSize ());
+ *   if (MpiInterface::GetSystemId () == 0)
+ *     {
+ *       partition.Print (std::cout);
+ *     }
+ *   // install the point-to-point links here
+ * \endcode
+ */
+class PartitionHelper
+{
+public:
+  /** Constructor. */
+  PartitionHelper ();
+
+  /**
+   * Set the expected load of a node, 1 by default, in any unit
+   * proportional to its number of events.
+   *
+   * \param [in] node The node.
+   * \param [in] weight The load.
+   */
+  void SetNodeWeight (Ptr<Node> node, double weight);
+  /**
+   * Set the expected load of a set of nodes.
+   *
+   * \param [in] nodes The nodes.
+   * \param [in] weight The load of each node.
+   */
+  void SetNodeWeight (NodeContainer nodes, double weight);
+  /**
+   * Declare a link which will be installed between two nodes.
+   *
+   * \param [in] a The first node.
+   * \param [in] b The second node.
+   * \param [in] delay The propagation delay of the link.
+   * \param [in] traffic The expected traffic on the link, the cost of
+   *             cutting it.
+   */
+  void AddLink (Ptr<Node> a, Ptr<Node> b, Time delay, double traffic = 1.0);
+  /**
+   * Set the largest load allowed on a rank.
+   *
+   * \param [in] imbalance The largest load of a rank over the mean
+   *             load, 1.05 by default.
+   */
+  void SetImbalance (double imbalance);
+
+  /**
+   * Assign the nodes to the ranks and set their system id.
+   *
+   * \param [in] systemCount The number of ranks, usually
+   *             MpiInterface::GetSize.
+   */
+  void Partition (uint32_t systemCount);
+
+  /**
+   * Get the rank a node was assigned to.
+   *
+   * \param [in] node The node.
+   * \returns The system id.
+   */
+  uint32_t GetSystemId (Ptr<Node> node) const;
+  /**
+   * Get the predicted load of a rank.
+   *
+   * \param [in] systemId The rank.
+   * \returns The sum of the weights of its nodes.
+   */
+  double GetLoad (uint32_t systemId) const;
+  /**
+   * Get the predicted lookahead.
+   *
+   * \returns The smallest delay of the links between ranks, or
+   *          Time::Max if no link was cut.
+   */
+  Time GetLookAhead (void) const;
+  /**
+   * Get the traffic between ranks.
+   *
+   * \returns The sum of the traffic of the links between ranks.
+   */
+  double GetCutTraffic (void) const;
+  /**
+   * Print the predicted load of each rank, the lookahead and the
+   * traffic cut.
+   *
+   * \param [in,out] os The stream.
+   */
+  void Print (std::ostream &os) const;
+
+private:
+  /** A link declared with AddLink. */
+  struct Link
+  {
+    uint32_t a;       /**< Id of the first node. */
+    uint32_t b;       /**< Id of the second node. */
+    int64_t delay;    /**< Delay, in time steps. */
+    double traffic;   /**< Cost of cutting the link. */
+  };
+
+  /**
+   * Group the nodes linked by links shorter than a delay.
+   *
+   * \param [in] delay The delay.
+   * \param [out] group The group index of each node.
+   * \returns The number of groups.
+   */
+  uint32_t Group (int64_t delay, std::vector<uint32_t> &group) const;
+  /**
+   * Assign groups of nodes to the ranks.
+   *
+   * \param [in] nGroups The number of groups.
+   * \param [in] group The group index of each node.
+   * \param [in] systemCount The number of ranks.
+   * \param [out] rank The rank of each group.
+   * \returns The largest load of a rank.
+   */
+  double Assign (uint32_t nGroups, const std::vector<uint32_t> &group,
+                 uint32_t systemCount, std::vector<uint32_t> &rank) const;
+
+  /** Load of each node, by node id. */
+  std::vector<double> m_weights;
+  /** The links. */
+  std::vector<Link> m_links;
+  /** Largest load of a rank over the mean. */
+  double m_imbalance;
+  /** Rank of each node, by node id. */
+  std::vector<uint32_t> m_systemIds;
+  /** Load of each rank. */
+  std::vector<double> m_loads;
+  /** Smallest delay of the links cut. */
+  Time m_lookAhead;
+  /** Traffic of the links cut. */
+  double m_cut;
+};
+
+} // namespace ns3
+
+#endif /* PARTITION_HELPER_H */
@@ -44,6 +44,23 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("GrantedTimeWindowMpiInterface");
 
+/**
+ * Size of the header of each packet in a batch: the receive time,
+ * the destination node and device, the packet size and padding.
+ * Packets are padded to 8 bytes, so every header stays aligned.
+ */
+static const uint32_t MPI_RECORD_HEADER_SIZE = 24;
+
+/**
+ * \param serializedSize size of the serialized packet
+ * \return size of the packet and its header in a batch
+ */
+static uint32_t
+GetRecordSize (uint32_t serializedSize)
+{
+  return MPI_RECORD_HEADER_SIZE + ((serializedSize + 7) & ~7U);
+}
+
 SentBuffer::SentBuffer ()
 {
   m_buffer = 0;
@@ -86,6 +103,9 @@ std::list<SentBuffer> GrantedTimeWindowMpiInterface::m_pendingTx;
 #ifdef NS3_MPI
 MPI_Request* GrantedTimeWindowMpiInterface::m_requests;
 char**       GrantedTimeWindowMpiInterface::m_pRxBuffers;
+uint8_t**    GrantedTimeWindowMpiInterface::m_pTxBatches;
+uint32_t*    GrantedTimeWindowMpiInterface::m_txBatchSizes;
+std::vector<uint8_t*> GrantedTimeWindowMpiInterface::m_freeTxBuffers;
 #endif
 
 TypeId 
@@ -106,11 +126,23 @@ GrantedTimeWindowMpiInterface::Destroy ()
 #ifdef NS3_MPI
   for (uint32_t i = 0; i < GetSize (); ++i)
     {
+      // Release the persistent receives
+      MPI_Cancel (&m_requests[i]);
+      MPI_Wait (&m_requests[i], MPI_STATUS_IGNORE);
+      MPI_Request_free (&m_requests[i]);
       delete [] m_pRxBuffers[i];
+      delete [] m_pTxBatches[i];
     }
   delete [] m_pRxBuffers;
   delete [] m_requests;
+  delete [] m_pTxBatches;
+  delete [] m_txBatchSizes;
 
+  for (std::vector<uint8_t*>::iterator i = m_freeTxBuffers.begin (); i != m_freeTxBuffers.end (); ++i)
+    {
+      delete [] *i;
+    }
+  m_freeTxBuffers.clear ();
   m_pendingTx.clear ();
 #endif
 }
@@ -173,14 +205,20 @@ GrantedTimeWindowMpiInterface::Enable (int* pargc, char*** pargv)
   MPI_Comm_size (MPI_COMM_WORLD, reinterpret_cast <int *> (&m_size));
   m_enabled = true;
   m_initialized = true;
-  // Post a non-blocking receive for all peers
+  // Post a persistent non-blocking receive for all peers, restarted
+  // after each message
   m_pRxBuffers = new char*[m_size];
   m_requests = new MPI_Request[m_size];
+  m_pTxBatches = new uint8_t*[m_size];
+  m_txBatchSizes = new uint32_t[m_size];
   for (uint32_t i = 0; i < GetSize (); ++i)
     {
-      m_pRxBuffers[i] = new char[MAX_MPI_MSG_SIZE];
-      MPI_Irecv (m_pRxBuffers[i], MAX_MPI_MSG_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
-                 MPI_COMM_WORLD, &m_requests[i]);
+      m_pRxBuffers[i] = new char[MAX_MPI_BATCH_SIZE];
+      MPI_Recv_init (m_pRxBuffers[i], MAX_MPI_BATCH_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
+                     MPI_COMM_WORLD, &m_requests[i]);
+      MPI_Start (&m_requests[i]);
+      m_pTxBatches[i] = 0;
+      m_txBatchSizes[i] = 0;
     }
 #else
   NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
@@ -193,30 +231,84 @@ GrantedTimeWindowMpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, ui
   NS_LOG_FUNCTION (this << p << rxTime.GetTimeStep () << node << dev);
 
 #ifdef NS3_MPI
-  SentBuffer sendBuf;
-  m_pendingTx.push_back (sendBuf);
-  std::list<SentBuffer>::reverse_iterator i = m_pendingTx.rbegin (); // Points to the last element
+  // Find the system id for the destination node
+  Ptr<Node> destNode = NodeList::GetNode (node);
+  uint32_t nodeSysId = destNode->GetSystemId ();
 
+  // The packet is only sent by SendMessages, before the next
+  // synchronization: it can not be received earlier than that anyway.
   uint32_t serializedSize = p->GetSerializedSize ();
-  uint8_t* buffer =  new uint8_t[serializedSize + 16];
-  i->SetBuffer (buffer);
-  // Add the time, dest node and dest device
+  uint32_t recordSize = GetRecordSize (serializedSize);
+  NS_ABORT_MSG_IF (recordSize > MAX_MPI_BATCH_SIZE,
+                   "Packet of " << serializedSize << " bytes too large for an MPI message");
+  if (m_txBatchSizes[nodeSysId] + recordSize > MAX_MPI_BATCH_SIZE)
+    {
+      SendBatch (nodeSysId);
+    }
+  if (m_pTxBatches[nodeSysId] == 0)
+    {
+      if (m_freeTxBuffers.empty ())
+        {
+          m_pTxBatches[nodeSysId] = new uint8_t[MAX_MPI_BATCH_SIZE];
+        }
+      else
+        {
+          m_pTxBatches[nodeSysId] = m_freeTxBuffers.back ();
+          m_freeTxBuffers.pop_back ();
+        }
+    }
+  uint8_t* buffer = m_pTxBatches[nodeSysId] + m_txBatchSizes[nodeSysId];
+  // Add the time, dest node, dest device and packet size
   uint64_t t = rxTime.GetInteger ();
   uint64_t* pTime = reinterpret_cast <uint64_t *> (buffer);
   *pTime++ = t;
   uint32_t* pData = reinterpret_cast<uint32_t *> (pTime);
   *pData++ = node;
   *pData++ = dev;
+  *pData++ = serializedSize;
+  *pData++ = 0;
   // Serialize the packet
   p->Serialize (reinterpret_cast<uint8_t *> (pData), serializedSize);
+  m_txBatchSizes[nodeSysId] += recordSize;
+  m_txCount++;
+#else
+  NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
+#endif
+}
 
-  // Find the system id for the destination node
-  Ptr<Node> destNode = NodeList::GetNode (node);
-  uint32_t nodeSysId = destNode->GetSystemId ();
+void
+GrantedTimeWindowMpiInterface::SendBatch (uint32_t rank)
+{
+  NS_LOG_FUNCTION (rank << m_txBatchSizes[rank]);
 
-  MPI_Isend (reinterpret_cast<void *> (i->GetBuffer ()), serializedSize + 16, MPI_CHAR, nodeSysId,
+#ifdef NS3_MPI
+  SentBuffer sendBuf;
+  m_pendingTx.push_back (sendBuf);
+  std::list<SentBuffer>::reverse_iterator i = m_pendingTx.rbegin (); // Points to the last element
+  i->SetBuffer (m_pTxBatches[rank]);
+
+  MPI_Isend (reinterpret_cast<void *> (i->GetBuffer ()), m_txBatchSizes[rank], MPI_CHAR, rank,
              0, MPI_COMM_WORLD, (i->GetRequest ()));
-  m_txCount++;
+  m_pTxBatches[rank] = 0;
+  m_txBatchSizes[rank] = 0;
+#else
+  NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
+#endif
+}
+
+void
+GrantedTimeWindowMpiInterface::SendMessages ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+#ifdef NS3_MPI
+  for (uint32_t rank = 0; rank < m_size; ++rank)
+    {
+      if (m_txBatchSizes[rank] > 0)
+        {
+          SendBatch (rank);
+        }
+    }
 #else
   NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
 #endif
@@ -228,58 +320,67 @@ GrantedTimeWindowMpiInterface::ReceiveMessages ()
   NS_LOG_FUNCTION_NOARGS ();
 
 #ifdef NS3_MPI
+  std::vector<int> indices (m_size);
+  std::vector<MPI_Status> statuses (m_size);
   // Poll the non-block reads to see if data arrived
   while (true)
     {
-      int flag = 0;
-      int index = 0;
-      MPI_Status status;
-
-      MPI_Testany (MpiInterface::GetSize (), m_requests, &index, &flag, &status);
-      if (!flag)
+      int completed = 0;
+      MPI_Testsome (m_size, m_requests, &completed, &indices[0], &statuses[0]);
+      if (completed == 0 || completed == MPI_UNDEFINED)
         {
           break;        // No more messages
         }
-      int count;
-      MPI_Get_count (&status, MPI_CHAR, &count);
-      m_rxCount++; // Count this receive
-
-      // Get the meta data first
-      uint64_t* pTime = reinterpret_cast<uint64_t *> (m_pRxBuffers[index]);
-      uint64_t time = *pTime++;
-      uint32_t* pData = reinterpret_cast<uint32_t *> (pTime);
-      uint32_t node = *pData++;
-      uint32_t dev  = *pData++;
-
-      Time rxTime (time);
-
-      count -= sizeof (time) + sizeof (node) + sizeof (dev);
-
-      Ptr<Packet> p = Create<Packet> (reinterpret_cast<uint8_t *> (pData), count, true);
-
-      // Find the correct node/device to schedule receive event
-      Ptr<Node> pNode = NodeList::GetNode (node);
-      Ptr<MpiReceiver> pMpiRec = 0;
-      uint32_t nDevices = pNode->GetNDevices ();
-      for (uint32_t i = 0; i < nDevices; ++i)
+      for (int k = 0; k < completed; ++k)
         {
-          Ptr<NetDevice> pThisDev = pNode->GetDevice (i);
-          if (pThisDev->GetIfIndex () == dev)
+          int index = indices[k];
+          int count;
+          MPI_Get_count (&statuses[k], MPI_CHAR, &count);
+
+          uint8_t* record = reinterpret_cast<uint8_t *> (m_pRxBuffers[index]);
+          uint8_t* end = record + count;
+          while (record < end)
             {
-              pMpiRec = pThisDev->GetObject<MpiReceiver> ();
-              break;
+              m_rxCount++; // Count this receive
+
+              // Get the meta data first
+              uint64_t* pTime = reinterpret_cast<uint64_t *> (record);
+              uint64_t time = *pTime++;
+              uint32_t* pData = reinterpret_cast<uint32_t *> (pTime);
+              uint32_t node = *pData++;
+              uint32_t dev  = *pData++;
+              uint32_t size = *pData++;
+              pData++;
+
+              Time rxTime (time);
+
+              Ptr<Packet> p = Create<Packet> (reinterpret_cast<uint8_t *> (pData), size, true);
+              record += GetRecordSize (size);
+
+              // Find the correct node/device to schedule receive event
+              Ptr<Node> pNode = NodeList::GetNode (node);
+              Ptr<MpiReceiver> pMpiRec = 0;
+              uint32_t nDevices = pNode->GetNDevices ();
+              for (uint32_t i = 0; i < nDevices; ++i)
+                {
+                  Ptr<NetDevice> pThisDev = pNode->GetDevice (i);
+                  if (pThisDev->GetIfIndex () == dev)
+                    {
+                      pMpiRec = pThisDev->GetObject<MpiReceiver> ();
+                      break;
+                    }
+                }
+
+              NS_ASSERT (pNode && pMpiRec);
+
+              // Schedule the rx event
+              Simulator::ScheduleWithContext (pNode->GetId (), rxTime - Simulator::Now (),
+                                              &MpiReceiver::Receive, pMpiRec, p);
             }
-        }
-
-      NS_ASSERT (pNode && pMpiRec);
 
-      // Schedule the rx event
-      Simulator::ScheduleWithContext (pNode->GetId (), rxTime - Simulator::Now (),
-                                      &MpiReceiver::Receive, pMpiRec, p);
-
-      // Re-queue the next read
-      MPI_Irecv (m_pRxBuffers[index], MAX_MPI_MSG_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
-                 MPI_COMM_WORLD, &m_requests[index]);
+          // Re-queue the next read
+          MPI_Start (&m_requests[index]);
+        }
     }
 #else
   NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
@@ -301,7 +402,9 @@ GrantedTimeWindowMpiInterface::TestSendComplete ()
       std::list<SentBuffer>::iterator current = i; // Save current for erasing
       i++;                                    // Advance to next
       if (flag)
-        { // This message is complete
+        { // This message is complete, keep its buffer for the next batches
+          m_freeTxBuffers.push_back (current->GetBuffer ());
+          current->SetBuffer (0);
           m_pendingTx.erase (current);
         }
     }
@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 #include <list>
+#include <vector>
 
 #include "ns3/nstime.h"
 #include "ns3/buffer.h"
@@ -45,6 +46,12 @@ namespace ns3 {
  */
 const uint32_t MAX_MPI_MSG_SIZE = 2000;
 
+/**
+ * size of the MPI messages batching the packets sent to one
+ * system, and of the buffers receiving them
+ */
+const uint32_t MAX_MPI_BATCH_SIZE = 65536;
+
 /**
  * \ingroup mpi
  *
@@ -131,6 +138,11 @@ public:
    * Serialize and send a packet to the specified node and net device
    */
   virtual void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
+  /**
+   * Send the packets batched by SendPacket since the last call,
+   * one message per destination system
+   */
+  static void SendMessages ();
   /**
    * Check for received messages complete
    */
@@ -149,6 +161,13 @@ public:
   static uint32_t GetTxCount ();
 
 private:
+  /**
+   * \param rank destination system
+   *
+   * Post a non-blocking send of the packets batched for a system
+   */
+  static void SendBatch (uint32_t rank);
+
   static uint32_t m_sid;
   static uint32_t m_size;
 
@@ -166,6 +185,15 @@ private:
   // Data buffers for non-blocking reads
   static char**   m_pRxBuffers;
 
+  // Packets batched for each system, not sent yet
+  static uint8_t** m_pTxBatches;
+
+  // Bytes used in each batch
+  static uint32_t* m_txBatchSizes;
+
+  // Buffers of completed sends, reused for the next batches
+  static std::vector<uint8_t*> m_freeTxBuffers;
+
   // List of pending non-blocking sends
   static std::list<SentBuffer> m_pendingTx;
 };
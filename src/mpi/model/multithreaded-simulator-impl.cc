@@ -0,0 +1,678 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "multithreaded-simulator-impl.h"
+#include "thread-partitioner.h"
+
+#include <ns3/simulator.h>
+#include <ns3/scheduler.h>
+#include <ns3/event-impl.h>
+#include <ns3/make-event.h>
+#include <ns3/nstime.h>
+#include <ns3/uinteger.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * \file
+ * \ingroup mpi
+ * Implementation of ns3::MultithreadedSimulatorImpl class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED (MultithreadedSimulatorImpl);
+
+namespace {
+
+/** Largest time stamp, for "no event". */
+const uint64_t MT_NO_TS = std::numeric_limits<uint64_t>::max ();
+/** Sender index of the events scheduled by threads running no partition. */
+const uint32_t MT_FOREIGN = std::numeric_limits<uint32_t>::max ();
+/** Capacity of the queue of events sent to a partition. */
+const uint32_t MT_INBOX_CAPACITY = 4096;
+
+} // unnamed namespace
+
+thread_local MultithreadedSimulatorImpl::Lp *MultithreadedSimulatorImpl::g_lp = 0;
+
+bool
+MultithreadedSimulatorImpl::RemoteEvent::operator < (const RemoteEvent &o) const
+{
+  if (ts != o.ts)
+    {
+      return ts < o.ts;
+    }
+  if (source != o.source)
+    {
+      return source < o.source;
+    }
+  return sequence < o.sequence;
+}
+
+MultithreadedSimulatorImpl::Lp::Lp (uint32_t id)
+  : m_id (id),
+    m_events (0),
+    // uids are allocated from 4.
+    // uid 0 is "invalid" events
+    // uid 1 is "now" events
+    // uid 2 is "destroy" events
+    m_uid (4),
+    // before ::Run is entered, the m_currentUid will be zero
+    m_currentUid (0),
+    m_currentTs (0),
+    m_currentContext (Simulator::NO_CONTEXT),
+    m_eventCount (0),
+    m_sent (0),
+    m_inbox (MT_INBOX_CAPACITY)
+{
+}
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::MultithreadedSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .SetGroupName ("Mpi")
+    .AddConstructor<MultithreadedSimulatorImpl> ()
+    .AddAttribute ("MaxThreads",
+                   "Maximum number of partitions, each run by one thread; "
+                   "0 for the number of cores.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_maxThreads),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl ()
+  : m_global (new Lp (0)),
+    m_maxThreads (0),
+    m_lookAhead (MT_NO_TS),
+    m_windowEnd (0),
+    m_stop (false),
+    m_main (SystemThread::Self ()),
+    m_foreignSent (0),
+    m_window (0),
+    m_busy (0),
+    m_exit (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  StopThreads ();
+  m_lps.push_back (m_global);
+  for (std::vector<Lp *>::iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      Lp *lp = *i;
+      RemoteEvent remote;
+      while (lp->m_inbox.Pop (remote))
+        {
+          remote.impl->Unref ();
+        }
+      while (lp->m_events != 0 && !lp->m_events->IsEmpty ())
+        {
+          Scheduler::Event next = lp->m_events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      delete lp;
+    }
+  m_lps.clear ();
+  m_nodeLp.clear ();
+  m_global = 0;
+  SimulatorImpl::DoDispose ();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  StopThreads ();
+  while (!m_destroyEvents.empty ())
+    {
+      Ptr<EventImpl> ev = m_destroyEvents.front ().PeekEventImpl ();
+      m_destroyEvents.pop_front ();
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  m_schedulerFactory = schedulerFactory;
+  std::vector<Lp *> lps = m_lps;
+  lps.push_back (m_global);
+  for (std::vector<Lp *>::iterator i = lps.begin (); i != lps.end (); ++i)
+    {
+      Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler> ();
+      if ((*i)->m_events != 0)
+        {
+          while (!(*i)->m_events->IsEmpty ())
+            {
+              scheduler->Insert ((*i)->m_events->RemoveNext ());
+            }
+        }
+      (*i)->m_events = scheduler;
+    }
+}
+
+MultithreadedSimulatorImpl::Lp *
+MultithreadedSimulatorImpl::GetCurrentLp (void) const
+{
+  return g_lp != 0 ? g_lp : m_global;
+}
+
+MultithreadedSimulatorImpl::Lp *
+MultithreadedSimulatorImpl::GetLp (uint32_t context) const
+{
+  if (context < m_nodeLp.size ())
+    {
+      return m_lps[m_nodeLp[context]];
+    }
+  return m_global;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::Insert (Lp *lp, uint64_t ts, uint32_t context, EventImpl *event)
+{
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = ts;
+  ev.key.m_context = context;
+  ev.key.m_uid = lp->m_uid;
+  lp->m_uid++;
+  lp->m_events->Insert (ev);
+  return ev.key.m_uid;
+}
+
+void
+MultithreadedSimulatorImpl::Partition (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::vector<ThreadPartitioner::Cuttable> cuttable;
+  uint32_t nLps = ThreadPartitioner::Partition (m_maxThreads, false, m_nodeLp, cuttable);
+
+  m_lookAhead = MT_NO_TS;
+  for (std::vector<ThreadPartitioner::Cuttable>::const_iterator i = cuttable.begin ();
+       i != cuttable.end (); ++i)
+    {
+      if (ThreadPartitioner::IsCut (*i, m_nodeLp))
+        {
+          i->channel->SetCrossThread (true);
+          m_lookAhead = std::min (m_lookAhead, i->delay);
+        }
+    }
+
+  for (uint32_t i = 0; i < nLps; i++)
+    {
+      Lp *partition = new Lp (i);
+      partition->m_events = m_schedulerFactory.Create<Scheduler> ();
+      partition->m_uid = m_global->m_uid;
+      partition->m_currentTs = m_global->m_currentTs;
+      m_lps.push_back (partition);
+    }
+  m_global->m_id = nLps;
+  NS_LOG_INFO (nLps << " partitions, lookahead " << GetLookAhead ());
+
+  // hand the events scheduled so far to their partition
+  std::vector<Scheduler::Event> events;
+  while (!m_global->m_events->IsEmpty ())
+    {
+      events.push_back (m_global->m_events->RemoveNext ());
+    }
+  for (std::vector<Scheduler::Event>::const_iterator i = events.begin (); i != events.end (); ++i)
+    {
+      GetLp (i->key.m_context)->m_events->Insert (*i);
+    }
+
+  for (uint32_t i = 1; i < nLps; i++)
+    {
+      Ptr<SystemThread> thread = Create<SystemThread> (MakeBoundCallback (
+                                                         &MultithreadedSimulatorImpl::DoWork,
+                                                         std::make_pair (this, i)));
+      thread->Start ();
+      m_threads.push_back (thread);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StopThreads (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_exit.store (true);
+  for (std::vector<Ptr<SystemThread> >::iterator i = m_threads.begin (); i != m_threads.end (); ++i)
+    {
+      (*i)->Join ();
+    }
+  m_threads.clear ();
+}
+
+void
+MultithreadedSimulatorImpl::DoWork (std::pair<MultithreadedSimulatorImpl *, uint32_t> worker)
+{
+  MultithreadedSimulatorImpl *self = worker.first;
+  g_lp = self->m_lps[worker.second];
+  // the threads are started by Partition, before the first window
+  uint32_t window = 0;
+  while (true)
+    {
+      uint32_t spins = 0;
+      while (self->m_window.load () == window && !self->m_exit.load ())
+        {
+          ThreadPartitioner::Backoff (spins);
+        }
+      if (self->m_window.load () == window)
+        {
+          return;
+        }
+      window++;
+      self->ProcessWindow (g_lp);
+      self->m_busy--;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent (Lp *lp)
+{
+  Scheduler::Event next = lp->m_events->RemoveNext ();
+
+  NS_ASSERT (next.key.m_ts >= lp->m_currentTs);
+  lp->m_eventCount++;
+
+  NS_LOG_LOGIC ("handle " << next.key.m_ts);
+  lp->m_currentTs = next.key.m_ts;
+  lp->m_currentContext = next.key.m_context;
+  lp->m_currentUid = next.key.m_uid;
+  next.impl->Invoke ();
+  next.impl->Unref ();
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow (Lp *lp)
+{
+  // Stop does not interrupt a window: which events of the other
+  // partitions ran would then depend on the thread timing.
+  while (!lp->m_events->IsEmpty ()
+         && lp->m_events->PeekNext ().key.m_ts < m_windowEnd)
+    {
+      ProcessOneEvent (lp);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::DeliverRemoteEvents (void)
+{
+  std::vector<Lp *> lps = m_lps;
+  lps.push_back (m_global);
+  for (std::vector<Lp *>::iterator i = lps.begin (); i != lps.end (); ++i)
+    {
+      Lp *lp = *i;
+      if (lp->m_inbox.IsEmpty ())
+        {
+          continue;
+        }
+      RemoteEvent remote;
+      while (lp->m_inbox.Pop (remote))
+        {
+          if (remote.source == MT_FOREIGN)
+            {
+              // not earlier than what any partition ran already
+              remote.ts = std::max (remote.ts, std::max (m_windowEnd, lp->m_currentTs));
+            }
+          m_arrived.push_back (remote);
+        }
+      std::sort (m_arrived.begin (), m_arrived.end ());
+      for (std::vector<RemoteEvent>::const_iterator j = m_arrived.begin (); j != m_arrived.end (); ++j)
+        {
+          Insert (lp, j->ts, j->context, j->impl);
+        }
+      m_arrived.clear ();
+    }
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetNextTs (void) const
+{
+  uint64_t next = MT_NO_TS;
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      if (!(*i)->m_events->IsEmpty ())
+        {
+          next = std::min (next, (*i)->m_events->PeekNext ().key.m_ts);
+        }
+    }
+  return next;
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished (void) const
+{
+  if (m_stop.load ())
+    {
+      return true;
+    }
+  return m_global->m_events->IsEmpty () && GetNextTs () == MT_NO_TS;
+}
+
+void
+MultithreadedSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (SystemThread::Equals (m_main), "Simulator::Run Thread-unsafe invocation!");
+  if (m_lps.empty ())
+    {
+      Partition ();
+    }
+  m_stop.store (false);
+
+  while (true)
+    {
+      DeliverRemoteEvents ();
+      // the events without a node context run first, alone
+      uint64_t next = GetNextTs ();
+      while (!m_stop.load () && !m_global->m_events->IsEmpty ()
+             && m_global->m_events->PeekNext ().key.m_ts <= next)
+        {
+          ProcessOneEvent (m_global);
+          next = GetNextTs ();
+        }
+      if (m_stop.load () || next == MT_NO_TS)
+        {
+          break;
+        }
+
+      // no partition can send an event earlier than the end of the window
+      uint64_t end = m_lookAhead > MT_NO_TS - next ? MT_NO_TS : next + m_lookAhead;
+      if (!m_global->m_events->IsEmpty ())
+        {
+          end = std::min (end, m_global->m_events->PeekNext ().key.m_ts);
+        }
+      m_windowEnd = end;
+      m_busy.store (m_lps.size () - 1);
+      m_window++;
+      g_lp = m_lps[0];
+      ProcessWindow (g_lp);
+      g_lp = 0;
+      uint32_t spins = 0;
+      while (m_busy.load () != 0)
+        {
+          ThreadPartitioner::Backoff (spins);
+        }
+    }
+
+  // Now () is the time of the last event run
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      m_global->m_currentTs = std::max (m_global->m_currentTs, (*i)->m_currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stop.store (true);
+}
+
+void
+MultithreadedSimulatorImpl::Stop (const Time &delay)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep ());
+  Lp *lp = GetCurrentLp ();
+  uint64_t ts = lp->m_currentTs + delay.GetTimeStep ();
+  EventImpl *event = MakeEvent (&Simulator::Stop);
+  if (lp == m_global)
+    {
+      Insert (m_global, ts, Simulator::NO_CONTEXT, event);
+      return;
+    }
+  // within the window, this stops the simulation at the end of the window
+  RemoteEvent remote = {std::max (ts, m_windowEnd), Simulator::NO_CONTEXT, lp->m_id, lp->m_sent++, event};
+  m_global->m_inbox.Push (remote);
+}
+
+EventId
+MultithreadedSimulatorImpl::Schedule (const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep () << event);
+  NS_ASSERT_MSG (g_lp != 0 || SystemThread::Equals (m_main),
+                 "Simulator::Schedule Thread-unsafe invocation!");
+  NS_ASSERT_MSG (delay.IsPositive (), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+
+  Lp *lp = GetCurrentLp ();
+  uint64_t ts = lp->m_currentTs + delay.GetTimeStep ();
+  uint32_t uid = Insert (lp, ts, lp->m_currentContext, event);
+  return EventId (event, ts, lp->m_currentContext, uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+  NS_ASSERT_MSG (delay.IsPositive (), "MultithreadedSimulatorImpl::ScheduleWithContext(): Negative delay");
+
+  Lp *source = GetCurrentLp ();
+  uint64_t ts = source->m_currentTs + delay.GetTimeStep ();
+  Lp *target = GetLp (context);
+  if (g_lp == 0 && !SystemThread::Equals (m_main))
+    {
+      // a thread running no partition, as the DefaultSimulatorImpl allows
+      RemoteEvent remote = {ts, context, MT_FOREIGN, m_foreignSent++, event};
+      target->m_inbox.Push (remote);
+      return;
+    }
+  if (target == source || source == m_global)
+    {
+      // the other partitions only run within windows, when the global
+      // events do not
+      Insert (target, ts, context, event);
+      return;
+    }
+  if (ts < m_windowEnd)
+    {
+      NS_FATAL_ERROR ("Event for context " << context << " at " << TimeStep (ts) <<
+                      " from partition " << source->m_id << " is within the lookahead " <<
+                      GetLookAhead () << "; it must go through a channel with a larger delay");
+    }
+  RemoteEvent remote = {ts, context, source->m_id, source->m_sent++, event};
+  target->m_inbox.Push (remote);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << event);
+  return Schedule (Time (0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << event);
+  EventId id (Ptr<EventImpl> (event, false), GetCurrentLp ()->m_currentTs, 0xffffffff, 2);
+  CriticalSection cs (m_destroyMutex);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  return TimeStep (GetCurrentLp ()->m_currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  return TimeStep (id.GetTs () - GetCurrentLp ()->m_currentTs);
+}
+
+void
+MultithreadedSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  if (IsExpired (id))
+    {
+      return;
+    }
+  Lp *lp = GetLp (id.GetContext ());
+  NS_ASSERT_MSG (lp == GetCurrentLp () || GetCurrentLp () == m_global,
+                 "Simulator::Remove of an event of another partition");
+  Scheduler::Event event;
+  event.impl = id.PeekEventImpl ();
+  event.key.m_ts = id.GetTs ();
+  event.key.m_context = id.GetContext ();
+  event.key.m_uid = id.GetUid ();
+  lp->m_events->Remove (event);
+  event.impl->Cancel ();
+  // whenever we remove an event from the event list, we have to unref it.
+  event.impl->Unref ();
+}
+
+void
+MultithreadedSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!IsExpired (id))
+    {
+      id.PeekEventImpl ()->Cancel ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired (const EventId &id) const
+{
+  if (id.GetUid () == 2)
+    {
+      if (id.PeekEventImpl () == 0
+          || id.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (m_destroyMutex);
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+  // the clock of the partition which runs the event
+  const Lp *lp = GetLp (id.GetContext ());
+  if (id.PeekEventImpl () == 0
+      || id.GetTs () < lp->m_currentTs
+      || (id.GetTs () == lp->m_currentTs && id.GetUid () <= lp->m_currentUid)
+      || id.PeekEventImpl ()->IsCancelled ())
+    {
+      return true;
+    }
+  return false;
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId (void) const
+{
+  // the global events run on the thread of partition 0
+  Lp *lp = GetCurrentLp ();
+  return lp == m_global ? 0 : lp->m_id;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext (void) const
+{
+  return GetCurrentLp ()->m_currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount (void) const
+{
+  uint64_t count = m_global->m_eventCount;
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      count += (*i)->m_eventCount;
+    }
+  return count;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetNPartitions (void) const
+{
+  return m_lps.size ();
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartition (uint32_t node) const
+{
+  NS_ASSERT (node < m_nodeLp.size ());
+  return m_nodeLp[node];
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookAhead (void) const
+{
+  if (m_lookAhead == MT_NO_TS)
+    {
+      return GetMaximumSimulationTime ();
+    }
+  return TimeStep (m_lookAhead);
+}
+
+} // namespace ns3
@@ -0,0 +1,271 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include <ns3/simulator-impl.h>
+#include <ns3/scheduler.h>
+#include <ns3/event-impl.h>
+#include <ns3/object-factory.h>
+#include <ns3/mpsc-queue.h>
+#include <ns3/system-mutex.h>
+#include <ns3/system-thread.h>
+#include <ns3/ptr.h>
+
+#include <atomic>
+#include <list>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup mpi
+ * \brief Simulator implementation running partitions of the nodes on
+ * the threads of one process, with a conservative synchronization.
+ *
+ * Unlike DistributedSimulatorImpl and NullMessageSimulatorImpl, this
+ * simulator needs neither MPI nor nodes created with a system id: when
+ * the simulation starts, the nodes are partitioned automatically from
+ * the NodeList and ChannelList topology, and each partition (logical
+ * process) is run by one thread with its own scheduler. An event
+ * belongs to the partition of the node its context refers to; events
+ * without a node context are run between the windows by the thread
+ * which called Simulator::Run.
+ *
+ * Partitions are separated by channels with a positive "Delay"
+ * attribute which support Channel::SetCrossThread; the nodes linked by
+ * any other channel end up in the same partition. As with
+ * PointToPointRemoteChannel, the smallest delay of the channels cut is
+ * the lookahead: windows of simulated time of that length are run in
+ * parallel, and the events a partition schedules for another one go
+ * through a lock-free queue, to be inserted in the target scheduler
+ * at the end of the window in an order which does not depend on the
+ * thread timing. Runs are thus repeatable for a given partitioning,
+ * but events of a node with equal time stamps may run in a different
+ * order than with the DefaultSimulatorImpl.
+ *
+ * The models run by different threads must not share state, which
+ * most ns-3 models do not once the simulation started. Known limits:
+ *  - NS_LOG output of different threads may interleave;
+ *  - the packet metadata, enabled by Packet::EnablePrinting or
+ *    Packet::EnableChecking, is not thread-safe;
+ *  - Stop without a delay, called from an event with a node context,
+ *    only takes effect at the end of the current window.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  MultithreadedSimulatorImpl ();
+  /** Destructor. */
+  ~MultithreadedSimulatorImpl ();
+
+  // virtual from SimulatorImpl
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &id);
+  virtual void Cancel (const EventId &id);
+  virtual bool IsExpired (const EventId &id) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  /**
+   * \copydoc SimulatorImpl::GetSystemId
+   *
+   * This is the index of the thread running the current event, so
+   * that Packet uids stay unique.
+   */
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+  virtual uint64_t GetEventCount (void) const;
+
+  /**
+   * Get the number of partitions.
+   *
+   * \returns The number of partitions, 0 before the simulation started.
+   */
+  uint32_t GetNPartitions (void) const;
+  /**
+   * Get the partition a node was assigned to.
+   *
+   * \param [in] node The node id.
+   * \returns The partition index.
+   */
+  uint32_t GetPartition (uint32_t node) const;
+  /**
+   * Get the lookahead of the partitions.
+   *
+   * \returns The smallest delay of the channels linking partitions.
+   */
+  Time GetLookAhead (void) const;
+
+private:
+  virtual void DoDispose (void);
+
+  /** An event sent to another partition. */
+  struct RemoteEvent
+  {
+    uint64_t ts;         /**< Event time stamp. */
+    uint32_t context;    /**< Event context. */
+    uint32_t source;     /**< Index of the sending partition. */
+    uint64_t sequence;   /**< Rank among the events of the sender. */
+    EventImpl *impl;     /**< The event. */
+
+    /**
+     * Order the events by time stamp, then sender, then sequence,
+     * which does not depend on the order they were pushed.
+     * \param [in] o The other event.
+     * \returns \c true if this event comes first.
+     */
+    bool operator < (const RemoteEvent &o) const;
+  };
+
+  /** A logical process: a scheduler and the clock of its events. */
+  struct Lp
+  {
+    /**
+     * Constructor.
+     * \param [in] id The partition index.
+     */
+    Lp (uint32_t id);
+
+    uint32_t m_id;                      /**< Partition index. */
+    Ptr<Scheduler> m_events;            /**< The events. */
+    uint32_t m_uid;                     /**< Next event unique id. */
+    uint32_t m_currentUid;              /**< Unique id of the current event. */
+    uint64_t m_currentTs;               /**< Time stamp of the current event. */
+    uint32_t m_currentContext;          /**< Context of the current event. */
+    uint64_t m_eventCount;              /**< Number of events run. */
+    uint64_t m_sent;                    /**< Number of events sent to other partitions. */
+    MpscQueue<RemoteEvent> m_inbox;     /**< Events sent by other partitions. */
+  };
+
+  /**
+   * Get the partition of the calling thread.
+   * \returns The partition, the global one outside of the windows.
+   */
+  Lp * GetCurrentLp (void) const;
+  /**
+   * Get the partition an event context belongs to.
+   * \param [in] context The context.
+   * \returns The partition, the global one for contexts which are not nodes.
+   */
+  Lp * GetLp (uint32_t context) const;
+  /**
+   * Insert an event in a partition, from the thread running it or
+   * while no window is running.
+   * \param [in] lp The partition.
+   * \param [in] ts The event time stamp.
+   * \param [in] context The event context.
+   * \param [in] event The event.
+   * \returns The event unique id.
+   */
+  uint32_t Insert (Lp *lp, uint64_t ts, uint32_t context, EventImpl *event);
+  /**
+   * Run the next event of a partition.
+   * \param [in] lp The partition.
+   */
+  void ProcessOneEvent (Lp *lp);
+  /**
+   * Run the events of a partition before the end of the current window.
+   * \param [in] lp The partition.
+   */
+  void ProcessWindow (Lp *lp);
+  /** Move the events sent during the last window to their scheduler. */
+  void DeliverRemoteEvents (void);
+  /**
+   * Get the time stamp of the next event of the partitions.
+   * \returns The time stamp, or the largest one if there is no event.
+   */
+  uint64_t GetNextTs (void) const;
+  /** Assign the nodes to partitions and start the threads. */
+  void Partition (void);
+  /** Stop and join the threads. */
+  void StopThreads (void);
+  /**
+   * Body of the threads.
+   * \param [in] worker The simulator and the partition of the thread.
+   */
+  static void DoWork (std::pair<MultithreadedSimulatorImpl *, uint32_t> worker);
+
+  /** The partitions, each one run by its thread. */
+  std::vector<Lp *> m_lps;
+  /** Events without a node context, run between the windows. */
+  Lp *m_global;
+  /** Partition index of each node. */
+  std::vector<uint32_t> m_nodeLp;
+  /** Factory of the schedulers. */
+  ObjectFactory m_schedulerFactory;
+  /** Maximum number of partitions, 0 for the number of cores. */
+  uint32_t m_maxThreads;
+  /** Smallest delay of the channels linking partitions. */
+  uint64_t m_lookAhead;
+  /** Events before this time stamp may run in the current window. */
+  uint64_t m_windowEnd;
+  /** Flag \c true once Stop was called. */
+  std::atomic<bool> m_stop;
+  /** Main SystemThread. */
+  SystemThread::ThreadId m_main;
+  /** Number of events sent by threads which run no partition. */
+  std::atomic<uint64_t> m_foreignSent;
+
+  /** The threads running partitions 1 and above. */
+  std::vector<Ptr<SystemThread> > m_threads;
+  /** Incremented to start a window. */
+  std::atomic<uint32_t> m_window;
+  /** Number of threads still running the current window. */
+  std::atomic<uint32_t> m_busy;
+  /** Flag \c true to end the threads. */
+  std::atomic<bool> m_exit;
+  /** Events sent to a partition, sorted before insertion. */
+  std::vector<RemoteEvent> m_arrived;
+
+  /** Container type for the events to run at Simulator::Destroy. */
+  typedef std::list<EventId> DestroyEvents;
+  /** The events to run at Simulator::Destroy. */
+  DestroyEvents m_destroyEvents;
+  /** Mutex to control access to m_destroyEvents. */
+  mutable SystemMutex m_destroyMutex;
+
+  /** The partition run by the calling thread, if it runs one. */
+  static thread_local Lp *g_lp;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
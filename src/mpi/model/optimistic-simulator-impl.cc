@@ -0,0 +1,997 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "optimistic-simulator-impl.h"
+#include "thread-partitioner.h"
+
+#include <ns3/simulator.h>
+#include <ns3/scheduler.h>
+#include <ns3/event-impl.h>
+#include <ns3/make-event.h>
+#include <ns3/application.h>
+#include <ns3/channel.h>
+#include <ns3/net-device.h>
+#include <ns3/node.h>
+#include <ns3/node-list.h>
+#include <ns3/nstime.h>
+#include <ns3/uinteger.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * \file
+ * \ingroup mpi
+ * Implementation of ns3::OptimisticSimulatorImpl class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OptimisticSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED (OptimisticSimulatorImpl);
+
+namespace {
+
+/** Largest time stamp, for "no event". */
+const uint64_t OPT_NO_TS = std::numeric_limits<uint64_t>::max ();
+/** Sender index of the events scheduled by threads running no partition. */
+const uint32_t OPT_FOREIGN = std::numeric_limits<uint32_t>::max ();
+/** Capacity of the queue of messages sent to a partition. */
+const uint32_t OPT_INBOX_CAPACITY = 4096;
+
+} // unnamed namespace
+
+thread_local OptimisticSimulatorImpl::Lp *OptimisticSimulatorImpl::g_lp = 0;
+
+bool
+OptimisticSimulatorImpl::Message::operator < (const Message &o) const
+{
+  if (ts != o.ts)
+    {
+      return ts < o.ts;
+    }
+  if (source != o.source)
+    {
+      return source < o.source;
+    }
+  return sequence < o.sequence;
+}
+
+OptimisticSimulatorImpl::Lp::Lp (uint32_t id)
+  : m_id (id),
+    m_events (0),
+    // uids are allocated from 4.
+    // uid 0 is "invalid" events
+    // uid 1 is "now" events
+    // uid 2 is "destroy" events
+    m_uid (4),
+    // before ::Run is entered, the m_currentUid will be zero
+    m_currentUid (0),
+    m_currentTs (0),
+    m_currentContext (Simulator::NO_CONTEXT),
+    m_eventCount (0),
+    m_optimistic (false),
+    m_sent (0),
+    m_entry (0),
+    m_rolledBack (0),
+    m_lookAhead (OPT_NO_TS),
+    m_inbox (OPT_INBOX_CAPACITY)
+{
+  m_committed.m_ts = 0;
+  m_committed.m_uid = 0;
+  m_committed.m_context = Simulator::NO_CONTEXT;
+}
+
+TypeId
+OptimisticSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::OptimisticSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .SetGroupName ("Mpi")
+    .AddConstructor<OptimisticSimulatorImpl> ()
+    .AddAttribute ("MaxThreads",
+                   "Maximum number of partitions, each run by one thread; "
+                   "0 for the number of cores.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&OptimisticSimulatorImpl::m_maxThreads),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("Window",
+                   "How far ahead of the global virtual time the optimistic "
+                   "partitions may run their events.",
+                   TimeValue (MilliSeconds (1)),
+                   MakeTimeAccessor (&OptimisticSimulatorImpl::m_window),
+                   MakeTimeChecker (TimeStep (1)))
+  ;
+  return tid;
+}
+
+OptimisticSimulatorImpl::OptimisticSimulatorImpl ()
+  : m_global (new Lp (0)),
+    m_maxThreads (0),
+    m_gvt (0),
+    m_windowEnd (0),
+    m_globalTs (OPT_NO_TS),
+    m_stop (false),
+    m_main (SystemThread::Self ()),
+    m_foreignSent (0),
+    m_windowCount (0),
+    m_busy (0),
+    m_exit (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+OptimisticSimulatorImpl::~OptimisticSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+OptimisticSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  StopThreads ();
+  m_lps.push_back (m_global);
+  for (std::vector<Lp *>::iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      Lp *lp = *i;
+      Message message;
+      while (lp->m_inbox.Pop (message))
+        {
+          if (message.impl != 0)
+            {
+              message.impl->Unref ();
+            }
+        }
+      for (std::deque<Processed>::iterator j = lp->m_processed.begin (); j != lp->m_processed.end (); ++j)
+        {
+          j->m_event.impl->Unref ();
+        }
+      lp->m_processed.clear ();
+      while (lp->m_events != 0 && !lp->m_events->IsEmpty ())
+        {
+          Scheduler::Event next = lp->m_events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      delete lp;
+    }
+  m_lps.clear ();
+  m_nodeLp.clear ();
+  m_global = 0;
+  SimulatorImpl::DoDispose ();
+}
+
+void
+OptimisticSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  StopThreads ();
+  while (!m_destroyEvents.empty ())
+    {
+      Ptr<EventImpl> ev = m_destroyEvents.front ().PeekEventImpl ();
+      m_destroyEvents.pop_front ();
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+OptimisticSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  m_schedulerFactory = schedulerFactory;
+  std::vector<Lp *> lps = m_lps;
+  lps.push_back (m_global);
+  for (std::vector<Lp *>::iterator i = lps.begin (); i != lps.end (); ++i)
+    {
+      Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler> ();
+      if ((*i)->m_events != 0)
+        {
+          while (!(*i)->m_events->IsEmpty ())
+            {
+              scheduler->Insert ((*i)->m_events->RemoveNext ());
+            }
+        }
+      (*i)->m_events = scheduler;
+    }
+}
+
+OptimisticSimulatorImpl::Lp *
+OptimisticSimulatorImpl::GetCurrentLp (void) const
+{
+  return g_lp != 0 ? g_lp : m_global;
+}
+
+OptimisticSimulatorImpl::Lp *
+OptimisticSimulatorImpl::GetLp (uint32_t context) const
+{
+  if (context < m_nodeLp.size ())
+    {
+      return m_lps[m_nodeLp[context]];
+    }
+  return m_global;
+}
+
+uint32_t
+OptimisticSimulatorImpl::Insert (Lp *lp, uint64_t ts, uint32_t context, EventImpl *event)
+{
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = ts;
+  ev.key.m_context = context;
+  ev.key.m_uid = lp->m_uid;
+  lp->m_uid++;
+  lp->m_events->Insert (ev);
+  if (lp->m_entry != 0)
+    {
+      lp->m_entry->m_inserted.push_back (ev);
+    }
+  return ev.key.m_uid;
+}
+
+void
+OptimisticSimulatorImpl::Send (Lp *source, Lp *target, uint64_t ts, uint32_t context, EventImpl *event)
+{
+  Message message = {ts, context, source->m_id, source->m_sent, source->m_sent, event};
+  source->m_sent++;
+  target->m_inbox.Push (message);
+  if (source->m_entry != 0)
+    {
+      Sent sent = {target->m_id, ts, context, message.id};
+      source->m_entry->m_sent.push_back (sent);
+    }
+}
+
+void
+OptimisticSimulatorImpl::Receive (Lp *lp, const Message &message)
+{
+  std::pair<uint32_t, uint64_t> sender (message.source, message.id);
+  if (message.impl != 0)
+    {
+      if (message.ts < lp->m_currentTs)
+        {
+          if (!lp->m_optimistic)
+            {
+              NS_FATAL_ERROR ("Event for context " << message.context << " at " << TimeStep (message.ts) <<
+                              " in the past of conservative partition " << lp->m_id <<
+                              "; it must go through a channel with a larger delay");
+            }
+          NS_LOG_LOGIC ("straggler at " << message.ts << " for partition " << lp->m_id);
+          RollBack (lp, message.ts + 1, 0);
+        }
+      uint32_t uid = Insert (lp, message.ts, message.context, message.impl);
+      if (message.source != OPT_FOREIGN)
+        {
+          Scheduler::Event ev;
+          ev.impl = message.impl;
+          ev.key.m_ts = message.ts;
+          ev.key.m_context = message.context;
+          ev.key.m_uid = uid;
+          lp->m_received[sender] = ev;
+          lp->m_receivedUids[uid] = sender;
+        }
+      return;
+    }
+
+  std::map<std::pair<uint32_t, uint64_t>, Scheduler::Event>::iterator i = lp->m_received.find (sender);
+  NS_ASSERT_MSG (i != lp->m_received.end (), "Anti-message for an event committed or never sent");
+  Scheduler::Event ev = i->second;
+  if (lp->m_optimistic)
+    {
+      RollBack (lp, ev.key.m_ts, ev.key.m_uid);
+    }
+  NS_ASSERT (ev.key.m_ts > lp->m_currentTs
+             || (ev.key.m_ts == lp->m_currentTs && ev.key.m_uid > lp->m_currentUid));
+  lp->m_events->Remove (ev);
+  lp->m_cancelled.erase (ev.key.m_uid);
+  lp->m_receivedUids.erase (ev.key.m_uid);
+  lp->m_received.erase (i);
+  ev.impl->Unref ();
+}
+
+void
+OptimisticSimulatorImpl::ForgetSender (Lp *lp, uint32_t uid)
+{
+  if (lp->m_receivedUids.empty ())
+    {
+      return;
+    }
+  std::map<uint32_t, std::pair<uint32_t, uint64_t> >::iterator i = lp->m_receivedUids.find (uid);
+  if (i != lp->m_receivedUids.end ())
+    {
+      lp->m_received.erase (i->second);
+      lp->m_receivedUids.erase (i);
+    }
+}
+
+void
+OptimisticSimulatorImpl::UndoLast (Lp *lp)
+{
+  Processed &entry = lp->m_processed.back ();
+  NS_LOG_LOGIC ("roll back " << entry.m_event.key.m_ts << " " << entry.m_event.key.m_uid);
+  for (Rollback::Journal::reverse_iterator i = entry.m_undo.rbegin (); i != entry.m_undo.rend (); ++i)
+    {
+      (*i)();
+    }
+  for (std::vector<uint32_t>::const_iterator i = entry.m_cancelled.begin (); i != entry.m_cancelled.end (); ++i)
+    {
+      lp->m_cancelled.erase (*i);
+    }
+  // the events scheduled after this one were undone first: those it
+  // scheduled are back in the scheduler
+  for (std::vector<Scheduler::Event>::const_iterator i = entry.m_inserted.begin (); i != entry.m_inserted.end (); ++i)
+    {
+      lp->m_events->Remove (*i);
+      lp->m_cancelled.erase (i->key.m_uid);
+      i->impl->Unref ();
+    }
+  for (std::vector<Sent>::const_iterator i = entry.m_sent.begin (); i != entry.m_sent.end (); ++i)
+    {
+      Message anti = {i->ts, i->context, lp->m_id, lp->m_sent, i->id, 0};
+      lp->m_sent++;
+      Lp *target = i->target == m_global->m_id ? m_global : m_lps[i->target];
+      target->m_inbox.Push (anti);
+    }
+  lp->m_events->Insert (entry.m_event);
+  lp->m_eventCount--;
+  lp->m_rolledBack++;
+  lp->m_processed.pop_back ();
+
+  const Scheduler::EventKey &last = lp->m_processed.empty () ? lp->m_committed
+    : lp->m_processed.back ().m_event.key;
+  lp->m_currentTs = last.m_ts;
+  lp->m_currentUid = last.m_uid;
+  lp->m_currentContext = last.m_context;
+}
+
+void
+OptimisticSimulatorImpl::RollBack (Lp *lp, uint64_t ts, uint32_t uid)
+{
+  while (!lp->m_processed.empty ())
+    {
+      const Scheduler::EventKey &last = lp->m_processed.back ().m_event.key;
+      if (last.m_ts < ts || (last.m_ts == ts && last.m_uid < uid))
+        {
+          break;
+        }
+      UndoLast (lp);
+    }
+}
+
+void
+OptimisticSimulatorImpl::Partition (void)
+{
+  NS_LOG_FUNCTION (this);
+  // without lookahead, even channels without delay can be cut
+  std::vector<ThreadPartitioner::Cuttable> cuttable;
+  uint32_t nLps = ThreadPartitioner::Partition (m_maxThreads, true, m_nodeLp, cuttable);
+  uint32_t nNodes = m_nodeLp.size ();
+
+  for (uint32_t i = 0; i < nLps; i++)
+    {
+      Lp *partition = new Lp (i);
+      partition->m_events = m_schedulerFactory.Create<Scheduler> ();
+      partition->m_uid = m_global->m_uid;
+      partition->m_currentTs = m_global->m_currentTs;
+      partition->m_committed.m_ts = m_global->m_currentTs;
+      partition->m_optimistic = true;
+      m_lps.push_back (partition);
+    }
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      if (!IsOptimisticNode (i))
+        {
+          m_lps[m_nodeLp[i]]->m_optimistic = false;
+        }
+    }
+  for (std::vector<ThreadPartitioner::Cuttable>::const_iterator i = cuttable.begin ();
+       i != cuttable.end (); ++i)
+    {
+      if (!ThreadPartitioner::IsCut (*i, m_nodeLp))
+        {
+          continue;
+        }
+      i->channel->SetCrossThread (true);
+      for (std::size_t j = 0; j < i->nodes.size (); j++)
+        {
+          Lp *partition = m_lps[m_nodeLp[i->nodes[j]]];
+          partition->m_lookAhead = std::min (partition->m_lookAhead, i->delay);
+        }
+    }
+  m_global->m_id = nLps;
+  NS_LOG_INFO (nLps << " partitions");
+
+  // hand the events scheduled so far to their partition
+  std::vector<Scheduler::Event> events;
+  while (!m_global->m_events->IsEmpty ())
+    {
+      events.push_back (m_global->m_events->RemoveNext ());
+    }
+  for (std::vector<Scheduler::Event>::const_iterator i = events.begin (); i != events.end (); ++i)
+    {
+      Lp *partition = GetLp (i->key.m_context);
+      partition->m_events->Insert (*i);
+      if (partition != m_global && m_global->m_cancelled.erase (i->key.m_uid) != 0)
+        {
+          partition->m_cancelled.insert (i->key.m_uid);
+        }
+    }
+
+  for (uint32_t i = 1; i < nLps; i++)
+    {
+      Ptr<SystemThread> thread = Create<SystemThread> (MakeBoundCallback (
+                                                         &OptimisticSimulatorImpl::DoWork,
+                                                         std::make_pair (this, i)));
+      thread->Start ();
+      m_threads.push_back (thread);
+    }
+}
+
+bool
+OptimisticSimulatorImpl::IsOptimisticNode (uint32_t id) const
+{
+  Ptr<Node> node = NodeList::GetNode (id);
+  // the aggregates include the node itself
+  Object::AggregateIterator aggregates = node->GetAggregateIterator ();
+  while (aggregates.HasNext ())
+    {
+      if (!Rollback::IsSupported (aggregates.Next ()->GetInstanceTypeId ()))
+        {
+          return false;
+        }
+    }
+  for (uint32_t i = 0; i < node->GetNDevices (); i++)
+    {
+      Ptr<NetDevice> device = node->GetDevice (i);
+      if (!Rollback::IsSupported (device->GetInstanceTypeId ()))
+        {
+          return false;
+        }
+      Ptr<Channel> channel = device->GetChannel ();
+      if (channel != 0 && !Rollback::IsSupported (channel->GetInstanceTypeId ()))
+        {
+          return false;
+        }
+    }
+  for (uint32_t i = 0; i < node->GetNApplications (); i++)
+    {
+      if (!Rollback::IsSupported (node->GetApplication (i)->GetInstanceTypeId ()))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+OptimisticSimulatorImpl::StopThreads (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_exit.store (true);
+  for (std::vector<Ptr<SystemThread> >::iterator i = m_threads.begin (); i != m_threads.end (); ++i)
+    {
+      (*i)->Join ();
+    }
+  m_threads.clear ();
+}
+
+void
+OptimisticSimulatorImpl::DoWork (std::pair<OptimisticSimulatorImpl *, uint32_t> worker)
+{
+  OptimisticSimulatorImpl *self = worker.first;
+  g_lp = self->m_lps[worker.second];
+  // the threads are started by Partition, before the first window
+  uint32_t window = 0;
+  while (true)
+    {
+      uint32_t spins = 0;
+      while (self->m_windowCount.load () == window && !self->m_exit.load ())
+        {
+          ThreadPartitioner::Backoff (spins);
+        }
+      if (self->m_windowCount.load () == window)
+        {
+          return;
+        }
+      window++;
+      self->ProcessWindow (g_lp);
+      self->m_busy--;
+    }
+}
+
+void
+OptimisticSimulatorImpl::ProcessOneEvent (Lp *lp)
+{
+  Scheduler::Event next = lp->m_events->RemoveNext ();
+
+  NS_ASSERT (next.key.m_ts >= lp->m_currentTs);
+  NS_LOG_LOGIC ("handle " << next.key.m_ts);
+  lp->m_currentTs = next.key.m_ts;
+  lp->m_currentContext = next.key.m_context;
+  lp->m_currentUid = next.key.m_uid;
+  lp->m_eventCount++;
+  bool cancelled = lp->m_cancelled.count (next.key.m_uid) != 0;
+
+  if (!lp->m_optimistic)
+    {
+      if (cancelled)
+        {
+          lp->m_cancelled.erase (next.key.m_uid);
+        }
+      else
+        {
+          next.impl->Invoke ();
+        }
+      ForgetSender (lp, next.key.m_uid);
+      next.impl->Unref ();
+      return;
+    }
+
+  // keep the event, and what it did, until it is committed
+  lp->m_processed.push_back (Processed ());
+  Processed &entry = lp->m_processed.back ();
+  entry.m_event = next;
+  entry.m_invoked = !cancelled;
+  if (cancelled)
+    {
+      return;
+    }
+  lp->m_entry = &entry;
+  Rollback::SetJournal (&entry.m_undo);
+  next.impl->Invoke ();
+  Rollback::SetJournal (0);
+  lp->m_entry = 0;
+}
+
+void
+OptimisticSimulatorImpl::ProcessWindow (Lp *lp)
+{
+  uint64_t end = m_windowEnd;
+  if (!lp->m_optimistic)
+    {
+      // the events of the other partitions come through the channels cut
+      uint64_t lookAhead = std::max<uint64_t> (lp->m_lookAhead, 1);
+      end = lookAhead > OPT_NO_TS - m_gvt ? OPT_NO_TS : m_gvt + lookAhead;
+      end = std::min (end, m_globalTs);
+    }
+  while (!lp->m_events->IsEmpty ()
+         && lp->m_events->PeekNext ().key.m_ts < end)
+    {
+      ProcessOneEvent (lp);
+    }
+}
+
+void
+OptimisticSimulatorImpl::DeliverMessages (void)
+{
+  std::vector<Lp *> lps = m_lps;
+  lps.push_back (m_global);
+  // delivering can roll events back, which sends anti-messages
+  bool delivered = true;
+  while (delivered)
+    {
+      delivered = false;
+      for (std::vector<Lp *>::iterator i = lps.begin (); i != lps.end (); ++i)
+        {
+          Lp *lp = *i;
+          if (lp->m_inbox.IsEmpty ())
+            {
+              continue;
+            }
+          Message message;
+          while (lp->m_inbox.Pop (message))
+            {
+              if (message.source == OPT_FOREIGN)
+                {
+                  // not earlier than what any partition committed already
+                  message.ts = std::max (message.ts, m_gvt);
+                  if (!lp->m_optimistic)
+                    {
+                      message.ts = std::max (message.ts, lp->m_currentTs);
+                    }
+                }
+              m_arrived.push_back (message);
+            }
+          std::sort (m_arrived.begin (), m_arrived.end ());
+          for (std::vector<Message>::const_iterator j = m_arrived.begin (); j != m_arrived.end (); ++j)
+            {
+              Receive (lp, *j);
+            }
+          m_arrived.clear ();
+          delivered = true;
+        }
+    }
+}
+
+void
+OptimisticSimulatorImpl::Commit (uint64_t gvt)
+{
+  for (std::vector<Lp *>::iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      Lp *lp = *i;
+      while (!lp->m_processed.empty ()
+             && lp->m_processed.front ().m_event.key.m_ts <= gvt)
+        {
+          Processed &entry = lp->m_processed.front ();
+          uint32_t uid = entry.m_event.key.m_uid;
+          if (!entry.m_invoked)
+            {
+              lp->m_cancelled.erase (uid);
+            }
+          ForgetSender (lp, uid);
+          lp->m_committed = entry.m_event.key;
+          entry.m_event.impl->Unref ();
+          lp->m_processed.pop_front ();
+        }
+    }
+}
+
+uint64_t
+OptimisticSimulatorImpl::GetNextTs (void) const
+{
+  uint64_t next = OPT_NO_TS;
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      if (!(*i)->m_events->IsEmpty ())
+        {
+          next = std::min (next, (*i)->m_events->PeekNext ().key.m_ts);
+        }
+    }
+  return next;
+}
+
+bool
+OptimisticSimulatorImpl::IsFinished (void) const
+{
+  if (m_stop.load ())
+    {
+      return true;
+    }
+  return m_global->m_events->IsEmpty () && GetNextTs () == OPT_NO_TS;
+}
+
+void
+OptimisticSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (SystemThread::Equals (m_main), "Simulator::Run Thread-unsafe invocation!");
+  if (m_lps.empty ())
+    {
+      Partition ();
+    }
+  m_stop.store (false);
+
+  while (true)
+    {
+      DeliverMessages ();
+      if (m_stop.load ())
+        {
+          break;
+        }
+      // no event may arrive before the earliest one left
+      uint64_t next = GetNextTs ();
+      uint64_t global = m_global->m_events->IsEmpty () ? OPT_NO_TS
+        : m_global->m_events->PeekNext ().key.m_ts;
+      m_gvt = std::min (next, global);
+      Commit (m_gvt);
+
+      // the events without a node context run at the GVT, alone
+      if (global <= next)
+        {
+          if (global == OPT_NO_TS)
+            {
+              break;
+            }
+          ProcessOneEvent (m_global);
+          continue;
+        }
+
+      uint64_t window = m_window.GetTimeStep ();
+      m_windowEnd = window > OPT_NO_TS - next ? OPT_NO_TS : next + window;
+      m_windowEnd = std::min (m_windowEnd, global);
+      m_globalTs = global;
+      m_busy.store (m_lps.size () - 1);
+      m_windowCount++;
+      g_lp = m_lps[0];
+      ProcessWindow (g_lp);
+      g_lp = 0;
+      uint32_t spins = 0;
+      while (m_busy.load () != 0)
+        {
+          ThreadPartitioner::Backoff (spins);
+        }
+    }
+
+  if (m_stop.load () && m_gvt != OPT_NO_TS)
+    {
+      // undo the events run past the stop
+      for (std::vector<Lp *>::iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+        {
+          RollBack (*i, m_gvt + 1, 0);
+        }
+      DeliverMessages ();
+      Commit (m_gvt);
+    }
+
+  // Now () is the time of the last event run
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      m_global->m_currentTs = std::max (m_global->m_currentTs, (*i)->m_currentTs);
+    }
+}
+
+void
+OptimisticSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (g_lp != 0)
+    {
+      // the event may be rolled back: the global events stop the simulation
+      Send (g_lp, m_global, g_lp->m_currentTs, Simulator::NO_CONTEXT, MakeEvent (&Simulator::Stop));
+      return;
+    }
+  m_stop.store (true);
+}
+
+void
+OptimisticSimulatorImpl::Stop (const Time &delay)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep ());
+  Lp *lp = GetCurrentLp ();
+  uint64_t ts = lp->m_currentTs + delay.GetTimeStep ();
+  EventImpl *event = MakeEvent (&Simulator::Stop);
+  if (lp == m_global)
+    {
+      Insert (m_global, ts, Simulator::NO_CONTEXT, event);
+      return;
+    }
+  Send (lp, m_global, ts, Simulator::NO_CONTEXT, event);
+}
+
+EventId
+OptimisticSimulatorImpl::Schedule (const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep () << event);
+  NS_ASSERT_MSG (g_lp != 0 || SystemThread::Equals (m_main),
+                 "Simulator::Schedule Thread-unsafe invocation!");
+  NS_ASSERT_MSG (delay.IsPositive (), "OptimisticSimulatorImpl::Schedule(): Negative delay");
+
+  Lp *lp = GetCurrentLp ();
+  uint64_t ts = lp->m_currentTs + delay.GetTimeStep ();
+  uint32_t uid = Insert (lp, ts, lp->m_currentContext, event);
+  return EventId (event, ts, lp->m_currentContext, uid);
+}
+
+void
+OptimisticSimulatorImpl::ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+  NS_ASSERT_MSG (delay.IsPositive (), "OptimisticSimulatorImpl::ScheduleWithContext(): Negative delay");
+
+  Lp *source = GetCurrentLp ();
+  uint64_t ts = source->m_currentTs + delay.GetTimeStep ();
+  Lp *target = GetLp (context);
+  if (g_lp == 0 && !SystemThread::Equals (m_main))
+    {
+      // a thread running no partition, as the DefaultSimulatorImpl allows
+      Message message = {ts, context, OPT_FOREIGN, m_foreignSent++, 0, event};
+      target->m_inbox.Push (message);
+      return;
+    }
+  if (target == source)
+    {
+      Insert (target, ts, context, event);
+      return;
+    }
+  // even the global events send messages: an optimistic partition may
+  // have run past them
+  Send (source, target, ts, context, event);
+}
+
+EventId
+OptimisticSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << event);
+  return Schedule (Time (0), event);
+}
+
+EventId
+OptimisticSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << event);
+  EventId id (Ptr<EventImpl> (event, false), GetCurrentLp ()->m_currentTs, 0xffffffff, 2);
+  CriticalSection cs (m_destroyMutex);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+OptimisticSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  return TimeStep (GetCurrentLp ()->m_currentTs);
+}
+
+Time
+OptimisticSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  return TimeStep (id.GetTs () - GetCurrentLp ()->m_currentTs);
+}
+
+void
+OptimisticSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  // the event stays in the scheduler, in case this is rolled back
+  Cancel (id);
+}
+
+void
+OptimisticSimulatorImpl::Cancel (const EventId &id)
+{
+  if (IsExpired (id))
+    {
+      return;
+    }
+  if (id.GetUid () == 2)
+    {
+      id.PeekEventImpl ()->Cancel ();
+      return;
+    }
+  Lp *lp = GetLp (id.GetContext ());
+  Lp *current = GetCurrentLp ();
+  NS_ASSERT_MSG (lp == current || current == m_global,
+                 "Simulator::Cancel of an event of another partition");
+  if (lp != current && lp->m_optimistic)
+    {
+      // a global event, which the partition may have run past
+      RollBack (lp, id.GetTs (), id.GetUid ());
+    }
+  if (lp->m_cancelled.insert (id.GetUid ()).second && lp->m_entry != 0)
+    {
+      lp->m_entry->m_cancelled.push_back (id.GetUid ());
+    }
+}
+
+bool
+OptimisticSimulatorImpl::IsExpired (const EventId &id) const
+{
+  if (id.GetUid () == 2)
+    {
+      if (id.PeekEventImpl () == 0
+          || id.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (m_destroyMutex);
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+  if (id.PeekEventImpl () == 0)
+    {
+      return true;
+    }
+  const Lp *lp = GetLp (id.GetContext ());
+  const Lp *current = GetCurrentLp ();
+  uint64_t ts = lp->m_currentTs;
+  uint32_t uid = lp->m_currentUid;
+  if (lp != current && lp->m_optimistic)
+    {
+      // what the partition ran past the caller may still be rolled back
+      ts = lp->m_committed.m_ts;
+      uid = lp->m_committed.m_uid;
+    }
+  if (id.GetTs () < ts || (id.GetTs () == ts && id.GetUid () <= uid))
+    {
+      return true;
+    }
+  // the cancelled events of another partition are only known between the windows
+  return (lp == current || current == m_global) && lp->m_cancelled.count (id.GetUid ()) != 0;
+}
+
+Time
+OptimisticSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+OptimisticSimulatorImpl::GetSystemId (void) const
+{
+  // the global events run on the thread of partition 0
+  Lp *lp = GetCurrentLp ();
+  return lp == m_global ? 0 : lp->m_id;
+}
+
+uint32_t
+OptimisticSimulatorImpl::GetContext (void) const
+{
+  return GetCurrentLp ()->m_currentContext;
+}
+
+uint64_t
+OptimisticSimulatorImpl::GetEventCount (void) const
+{
+  uint64_t count = m_global->m_eventCount;
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      count += (*i)->m_eventCount;
+    }
+  return count;
+}
+
+uint32_t
+OptimisticSimulatorImpl::GetNPartitions (void) const
+{
+  return m_lps.size ();
+}
+
+uint32_t
+OptimisticSimulatorImpl::GetPartition (uint32_t node) const
+{
+  NS_ASSERT (node < m_nodeLp.size ());
+  return m_nodeLp[node];
+}
+
+bool
+OptimisticSimulatorImpl::IsOptimistic (uint32_t partition) const
+{
+  NS_ASSERT (partition < m_lps.size ());
+  return m_lps[partition]->m_optimistic;
+}
+
+uint64_t
+OptimisticSimulatorImpl::GetRollbackCount (void) const
+{
+  uint64_t count = 0;
+  for (std::vector<Lp *>::const_iterator i = m_lps.begin (); i != m_lps.end (); ++i)
+    {
+      count += (*i)->m_rolledBack;
+    }
+  return count;
+}
+
+} // namespace ns3
@@ -0,0 +1,375 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OPTIMISTIC_SIMULATOR_IMPL_H
+#define OPTIMISTIC_SIMULATOR_IMPL_H
+
+#include <ns3/simulator-impl.h>
+#include <ns3/scheduler.h>
+#include <ns3/event-impl.h>
+#include <ns3/object-factory.h>
+#include <ns3/mpsc-queue.h>
+#include <ns3/rollback.h>
+#include <ns3/system-mutex.h>
+#include <ns3/system-thread.h>
+#include <ns3/nstime.h>
+#include <ns3/ptr.h>
+
+#include <atomic>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::OptimisticSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup mpi
+ * \brief Experimental simulator implementation running partitions of
+ * the nodes on the threads of one process, with an optimistic (Time
+ * Warp) synchronization.
+ *
+ * The nodes are partitioned as with the MultithreadedSimulatorImpl,
+ * except that any channel supporting Channel::SetCrossThread may be
+ * cut, whatever its delay: there is no lookahead. A partition whose
+ * nodes, devices, channels, applications and aggregated objects all
+ * save their state with Rollback (see NS_ROLLBACK_SUPPORTED) runs its
+ * events optimistically, up to the "Window" attribute ahead of the
+ * global virtual time (GVT), the time stamp of the earliest event left.
+ * When an event sent by another partition arrives in its past, the
+ * events after it are rolled back: the models restore their state, the
+ * events they scheduled are removed, and anti-messages cancel those
+ * they sent to other partitions. The other partitions run their events
+ * conservatively, up to the GVT plus the smallest delay of their
+ * channels which were cut, as the MultithreadedSimulatorImpl does.
+ *
+ * The partitions exchange their events, and the GVT is computed, at
+ * barriers between the windows, so that runs are repeatable for a
+ * given partitioning. Events which can no longer be rolled back, before
+ * the GVT, are committed and their saved state freed. As with the
+ * MultithreadedSimulatorImpl, events of a node with equal time stamps
+ * may run in a different order than with the DefaultSimulatorImpl, and
+ * the models of different partitions must not share state.
+ *
+ * Only Node, SimpleNetDevice, SimpleChannel, PointToPointNetDevice and
+ * PointToPointChannel save their state so far. The other models,
+ * notably CSMA, the Internet stack and the applications, do not: the
+ * partitions holding them always run conservatively, and gain nothing
+ * from this simulator over the MultithreadedSimulatorImpl.
+ *
+ * Besides the limits of the MultithreadedSimulatorImpl:
+ *  - trace sinks and NS_LOG see the events which are later rolled back;
+ *  - events scheduled with Simulator::ScheduleDestroy are not rolled back;
+ *  - Simulator::Remove only cancels the event, which stays in the
+ *    scheduler until its time.
+ */
+class OptimisticSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  OptimisticSimulatorImpl ();
+  /** Destructor. */
+  ~OptimisticSimulatorImpl ();
+
+  // virtual from SimulatorImpl
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &id);
+  virtual void Cancel (const EventId &id);
+  virtual bool IsExpired (const EventId &id) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  /**
+   * \copydoc SimulatorImpl::GetSystemId
+   *
+   * This is the index of the thread running the current event, so
+   * that Packet uids stay unique.
+   */
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+  /**
+   * \copydoc SimulatorImpl::GetEventCount
+   *
+   * The events rolled back are not counted.
+   */
+  virtual uint64_t GetEventCount (void) const;
+
+  /**
+   * Get the number of partitions.
+   *
+   * \returns The number of partitions, 0 before the simulation started.
+   */
+  uint32_t GetNPartitions (void) const;
+  /**
+   * Get the partition a node was assigned to.
+   *
+   * \param [in] node The node id.
+   * \returns The partition index.
+   */
+  uint32_t GetPartition (uint32_t node) const;
+  /**
+   * Check whether a partition runs its events optimistically.
+   *
+   * \param [in] partition The partition index.
+   * \returns \c true if all the models of the partition support Rollback.
+   */
+  bool IsOptimistic (uint32_t partition) const;
+  /**
+   * Get the number of events run, then rolled back.
+   *
+   * \returns The number of events rolled back by all the partitions.
+   */
+  uint64_t GetRollbackCount (void) const;
+
+private:
+  virtual void DoDispose (void);
+
+  /** An event sent to another partition, or its cancellation. */
+  struct Message
+  {
+    uint64_t ts;         /**< Event time stamp. */
+    uint32_t context;    /**< Event context. */
+    uint32_t source;     /**< Index of the sending partition. */
+    uint64_t sequence;   /**< Rank among the messages of the sender. */
+    uint64_t id;         /**< Rank of the event among the messages of the sender. */
+    EventImpl *impl;     /**< The event, 0 for an anti-message. */
+
+    /**
+     * Order the messages by time stamp, then sender, then sequence,
+     * which does not depend on the order they were pushed.
+     * \param [in] o The other message.
+     * \returns \c true if this message comes first.
+     */
+    bool operator < (const Message &o) const;
+  };
+
+  /** An event sent by an event which may be rolled back. */
+  struct Sent
+  {
+    uint32_t target;     /**< Index of the receiving partition. */
+    uint64_t ts;         /**< Event time stamp. */
+    uint32_t context;    /**< Event context. */
+    uint64_t id;         /**< Rank of the event among the messages of the sender. */
+  };
+
+  /** An event run by an optimistic partition, until it is committed. */
+  struct Processed
+  {
+    Scheduler::Event m_event;                  /**< The event, which keeps its reference. */
+    bool m_invoked;                            /**< Flag \c false if it was cancelled. */
+    Rollback::Journal m_undo;                  /**< The state saved by the models. */
+    std::vector<Scheduler::Event> m_inserted;  /**< The events it scheduled in the partition. */
+    std::vector<uint32_t> m_cancelled;         /**< Unique ids of the events it cancelled. */
+    std::vector<Sent> m_sent;                  /**< The events it sent to other partitions. */
+  };
+
+  /** A logical process: a scheduler, the clock of its events and their history. */
+  struct Lp
+  {
+    /**
+     * Constructor.
+     * \param [in] id The partition index.
+     */
+    Lp (uint32_t id);
+
+    uint32_t m_id;                      /**< Partition index. */
+    Ptr<Scheduler> m_events;            /**< The events. */
+    uint32_t m_uid;                     /**< Next event unique id. */
+    uint32_t m_currentUid;              /**< Unique id of the current event. */
+    uint64_t m_currentTs;               /**< Time stamp of the current event. */
+    uint32_t m_currentContext;          /**< Context of the current event. */
+    uint64_t m_eventCount;              /**< Number of events run. */
+    bool m_optimistic;                  /**< Flag \c true to run events ahead of the GVT. */
+    uint64_t m_sent;                    /**< Number of messages sent to other partitions. */
+    std::deque<Processed> m_processed;  /**< The events run but not committed, in order. */
+    Processed *m_entry;                 /**< The history of the current event, if kept. */
+    std::set<uint32_t> m_cancelled;     /**< Unique ids of the events cancelled, but not run. */
+    /** The events received, by sender and rank, until they are committed. */
+    std::map<std::pair<uint32_t, uint64_t>, Scheduler::Event> m_received;
+    /** The sender and rank of the events received, by unique id. */
+    std::map<uint32_t, std::pair<uint32_t, uint64_t> > m_receivedUids;
+    Scheduler::EventKey m_committed;    /**< Key of the last event committed. */
+    uint64_t m_rolledBack;              /**< Number of events rolled back. */
+    uint64_t m_lookAhead;               /**< Smallest delay of the channels cut. */
+    MpscQueue<Message> m_inbox;         /**< Messages sent by other partitions. */
+  };
+
+  /**
+   * Get the partition of the calling thread.
+   * \returns The partition, the global one outside of the windows.
+   */
+  Lp * GetCurrentLp (void) const;
+  /**
+   * Get the partition an event context belongs to.
+   * \param [in] context The context.
+   * \returns The partition, the global one for contexts which are not nodes.
+   */
+  Lp * GetLp (uint32_t context) const;
+  /**
+   * Insert an event in a partition, from the thread running it or
+   * while no window is running.
+   * \param [in] lp The partition.
+   * \param [in] ts The event time stamp.
+   * \param [in] context The event context.
+   * \param [in] event The event.
+   * \returns The event unique id.
+   */
+  uint32_t Insert (Lp *lp, uint64_t ts, uint32_t context, EventImpl *event);
+  /**
+   * Send an event to another partition.
+   * \param [in] source The sending partition.
+   * \param [in] target The receiving partition.
+   * \param [in] ts The event time stamp.
+   * \param [in] context The event context.
+   * \param [in] event The event.
+   */
+  void Send (Lp *source, Lp *target, uint64_t ts, uint32_t context, EventImpl *event);
+  /**
+   * Insert an event sent by another partition, or remove it for an
+   * anti-message, rolling back the events run after it.
+   * \param [in] lp The receiving partition.
+   * \param [in] message The message.
+   */
+  void Receive (Lp *lp, const Message &message);
+  /**
+   * Forget the sender of an event which will no longer be cancelled.
+   * \param [in] lp The partition.
+   * \param [in] uid The event unique id.
+   */
+  void ForgetSender (Lp *lp, uint32_t uid);
+  /**
+   * Run the next event of a partition.
+   * \param [in] lp The partition.
+   */
+  void ProcessOneEvent (Lp *lp);
+  /**
+   * Run the events of a partition allowed in the current window.
+   * \param [in] lp The partition.
+   */
+  void ProcessWindow (Lp *lp);
+  /**
+   * Undo the last event run by a partition.
+   * \param [in] lp The partition.
+   */
+  void UndoLast (Lp *lp);
+  /**
+   * Undo the events run by a partition from an event key on.
+   * \param [in] lp The partition.
+   * \param [in] ts The time stamp of the key.
+   * \param [in] uid The unique id of the key.
+   */
+  void RollBack (Lp *lp, uint64_t ts, uint32_t uid);
+  /** Deliver the messages until no partition has any left. */
+  void DeliverMessages (void);
+  /**
+   * Commit the events run before a time stamp.
+   * \param [in] gvt The time stamp.
+   */
+  void Commit (uint64_t gvt);
+  /**
+   * Get the time stamp of the next event of the partitions.
+   * \returns The time stamp, or the largest one if there is no event.
+   */
+  uint64_t GetNextTs (void) const;
+  /** Assign the nodes to partitions and start the threads. */
+  void Partition (void);
+  /**
+   * Check whether the models of a node all support Rollback.
+   * \param [in] node The node id.
+   * \returns \c true if the node may run its events optimistically.
+   */
+  bool IsOptimisticNode (uint32_t node) const;
+  /** Stop and join the threads. */
+  void StopThreads (void);
+  /**
+   * Body of the threads.
+   * \param [in] worker The simulator and the partition of the thread.
+   */
+  static void DoWork (std::pair<OptimisticSimulatorImpl *, uint32_t> worker);
+
+  /** The partitions, each one run by its thread. */
+  std::vector<Lp *> m_lps;
+  /** Events without a node context, run at the GVT between the windows. */
+  Lp *m_global;
+  /** Partition index of each node. */
+  std::vector<uint32_t> m_nodeLp;
+  /** Factory of the schedulers. */
+  ObjectFactory m_schedulerFactory;
+  /** Maximum number of partitions, 0 for the number of cores. */
+  uint32_t m_maxThreads;
+  /** How far ahead of the GVT the optimistic partitions may run. */
+  Time m_window;
+  /** The global virtual time: no event may arrive before it. */
+  uint64_t m_gvt;
+  /** Optimistic events before this time stamp may run in the current window. */
+  uint64_t m_windowEnd;
+  /** Time stamp of the next event without a node context. */
+  uint64_t m_globalTs;
+  /** Flag \c true once Stop was called. */
+  std::atomic<bool> m_stop;
+  /** Main SystemThread. */
+  SystemThread::ThreadId m_main;
+  /** Number of messages sent by threads which run no partition. */
+  std::atomic<uint64_t> m_foreignSent;
+
+  /** The threads running partitions 1 and above. */
+  std::vector<Ptr<SystemThread> > m_threads;
+  /** Incremented to start a window. */
+  std::atomic<uint32_t> m_windowCount;
+  /** Number of threads still running the current window. */
+  std::atomic<uint32_t> m_busy;
+  /** Flag \c true to end the threads. */
+  std::atomic<bool> m_exit;
+  /** Messages sent to a partition, sorted before delivery. */
+  std::vector<Message> m_arrived;
+
+  /** Container type for the events to run at Simulator::Destroy. */
+  typedef std::list<EventId> DestroyEvents;
+  /** The events to run at Simulator::Destroy. */
+  DestroyEvents m_destroyEvents;
+  /** Mutex to control access to m_destroyEvents. */
+  mutable SystemMutex m_destroyMutex;
+
+  /** The partition run by the calling thread, if it runs one. */
+  static thread_local Lp *g_lp;
+};
+
+} // namespace ns3
+
+#endif /* OPTIMISTIC_SIMULATOR_IMPL_H */
@@ -0,0 +1,221 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "thread-partitioner.h"
+
+#include <ns3/channel-list.h>
+#include <ns3/net-device.h>
+#include <ns3/node.h>
+#include <ns3/node-list.h>
+#include <ns3/nstime.h>
+#include <ns3/log.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <thread>
+
+/**
+ * \file
+ * \ingroup mpi
+ * Implementation of ns3::ThreadPartitioner class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("ThreadPartitioner");
+
+namespace {
+
+/**
+ * Find the cluster of a node, halving the paths on the way.
+ *
+ * \param [in,out] cluster The parent of each node.
+ * \param [in] node The node.
+ * \returns The root node of the cluster.
+ */
+uint32_t
+FindCluster (std::vector<uint32_t> &cluster, uint32_t node)
+{
+  while (cluster[node] != node)
+    {
+      cluster[node] = cluster[cluster[node]];
+      node = cluster[node];
+    }
+  return node;
+}
+
+} // unnamed namespace
+
+uint32_t
+ThreadPartitioner::Partition (uint32_t maxPartitions, bool cutZeroDelay,
+                              std::vector<uint32_t> &nodePartition,
+                              std::vector<Cuttable> &cuttable)
+{
+  NS_LOG_FUNCTION (maxPartitions << cutZeroDelay);
+  uint32_t nNodes = NodeList::GetNNodes ();
+
+  // Nodes linked by a channel which cannot be cut form a cluster,
+  // which is never split over partitions.
+  std::vector<uint32_t> cluster (nNodes);
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      cluster[i] = i;
+    }
+  std::vector<std::vector<uint32_t> > neighbors (nNodes);
+  cuttable.clear ();
+  for (ChannelList::Iterator i = ChannelList::Begin (); i != ChannelList::End (); ++i)
+    {
+      Ptr<Channel> channel = *i;
+      std::vector<uint32_t> nodes;
+      for (std::size_t j = 0; j < channel->GetNDevices (); j++)
+        {
+          Ptr<NetDevice> device = channel->GetDevice (j);
+          if (device != 0 && device->GetNode () != 0)
+            {
+              nodes.push_back (device->GetNode ()->GetId ());
+            }
+        }
+      if (nodes.size () < 2)
+        {
+          continue;
+        }
+      for (std::size_t j = 1; j < nodes.size (); j++)
+        {
+          neighbors[nodes[0]].push_back (nodes[j]);
+          neighbors[nodes[j]].push_back (nodes[0]);
+        }
+      TimeValue delay;
+      uint64_t lookAhead = 0;
+      if (channel->GetAttributeFailSafe ("Delay", delay) && delay.Get ().IsStrictlyPositive ())
+        {
+          lookAhead = delay.Get ().GetTimeStep ();
+        }
+      if ((cutZeroDelay || lookAhead > 0) && channel->SetCrossThread (false))
+        {
+          Cuttable cut;
+          cut.channel = channel;
+          cut.delay = lookAhead;
+          cut.nodes = nodes;
+          cuttable.push_back (cut);
+          continue;
+        }
+      for (std::size_t j = 1; j < nodes.size (); j++)
+        {
+          cluster[FindCluster (cluster, nodes[j])] = FindCluster (cluster, nodes[0]);
+        }
+    }
+
+  std::vector<uint32_t> clusterSize (nNodes, 0);
+  uint32_t nClusters = 0;
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      if (clusterSize[FindCluster (cluster, i)]++ == 0)
+        {
+          nClusters++;
+        }
+    }
+  uint32_t nPartitions = maxPartitions;
+  if (nPartitions == 0)
+    {
+      nPartitions = std::max<uint32_t> (std::thread::hardware_concurrency (), 1);
+    }
+  nPartitions = std::max<uint32_t> (std::min (nPartitions, nClusters), 1);
+
+  // Fill the partitions one after the other with whole clusters, in
+  // breadth-first order, so that each partition is a connected region
+  // of about the same number of nodes and few channels are cut.
+  const uint32_t none = std::numeric_limits<uint32_t>::max ();
+  std::vector<uint32_t> clusterPartition (nNodes, none);
+  std::vector<bool> visited (nNodes, false);
+  uint32_t target = (nNodes + nPartitions - 1) / nPartitions;
+  uint32_t partition = 0;
+  uint32_t load = 0;
+  for (uint32_t start = 0; start < nNodes; start++)
+    {
+      if (visited[start])
+        {
+          continue;
+        }
+      std::deque<uint32_t> queue;
+      queue.push_back (start);
+      visited[start] = true;
+      while (!queue.empty ())
+        {
+          uint32_t node = queue.front ();
+          queue.pop_front ();
+          uint32_t root = FindCluster (cluster, node);
+          if (clusterPartition[root] == none)
+            {
+              if (load >= target && partition + 1 < nPartitions)
+                {
+                  partition++;
+                  load = 0;
+                }
+              clusterPartition[root] = partition;
+              load += clusterSize[root];
+            }
+          for (std::vector<uint32_t>::const_iterator i = neighbors[node].begin ();
+               i != neighbors[node].end (); ++i)
+            {
+              if (!visited[*i])
+                {
+                  visited[*i] = true;
+                  queue.push_back (*i);
+                }
+            }
+        }
+    }
+  nodePartition.resize (nNodes);
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      nodePartition[i] = clusterPartition[FindCluster (cluster, i)];
+    }
+  NS_LOG_INFO (nNodes << " nodes in " << nClusters << " clusters, " <<
+               partition + 1 << " partitions");
+  return partition + 1;
+}
+
+bool
+ThreadPartitioner::IsCut (const Cuttable &channel, const std::vector<uint32_t> &nodePartition)
+{
+  for (std::size_t j = 1; j < channel.nodes.size (); j++)
+    {
+      if (nodePartition[channel.nodes[j]] != nodePartition[channel.nodes[0]])
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+ThreadPartitioner::Backoff (uint32_t &spins)
+{
+  if (++spins < 64)
+    {
+      return;
+    }
+  if (spins < 1024)
+    {
+      std::this_thread::yield ();
+      return;
+    }
+  std::this_thread::sleep_for (std::chrono::microseconds (50));
+}
+
+} // namespace ns3
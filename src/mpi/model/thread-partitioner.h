@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NS3_THREAD_PARTITIONER_H
+#define NS3_THREAD_PARTITIONER_H
+
+#include <ns3/channel.h>
+#include <ns3/ptr.h>
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup mpi
+ * ns3::ThreadPartitioner declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup mpi
+ * \brief Code shared by the simulators running the nodes on threads.
+ *
+ * The MultithreadedSimulatorImpl and the OptimisticSimulatorImpl split
+ * the nodes of the NodeList over partitions the same way, and wait for
+ * each other the same way; they differ in the channels they may cut.
+ */
+class ThreadPartitioner
+{
+public:
+  /** A channel which may be cut between partitions. */
+  struct Cuttable
+  {
+    Ptr<Channel> channel;          /**< The channel. */
+    uint64_t delay;                /**< Its delay, in time steps. */
+    std::vector<uint32_t> nodes;   /**< The ids of the nodes it links. */
+  };
+
+  /**
+   * Assign the nodes of the NodeList to partitions.
+   *
+   * A channel may be cut if Channel::SetCrossThread accepts it and,
+   * unless \p cutZeroDelay, its "Delay" attribute is positive. The
+   * nodes linked by the other channels form a cluster, which is never
+   * split. The partitions are filled one after the other with whole
+   * clusters, in breadth-first order, so that each one is a connected
+   * region of about the same number of nodes and few channels are cut.
+   *
+   * The channels are left within their partition: the caller calls
+   * SetCrossThread (true) on the channels it does cut.
+   *
+   * \param [in] maxPartitions The largest number of partitions, or 0
+   *             for the number of cores.
+   * \param [in] cutZeroDelay Whether channels without delay may be cut.
+   * \param [out] nodePartition The partition of each node.
+   * \param [out] cuttable The channels which may be cut.
+   * \returns The number of partitions.
+   */
+  static uint32_t Partition (uint32_t maxPartitions, bool cutZeroDelay,
+                             std::vector<uint32_t> &nodePartition,
+                             std::vector<Cuttable> &cuttable);
+
+  /**
+   * Check whether the nodes of a channel are in different partitions.
+   *
+   * \param [in] channel The channel.
+   * \param [in] nodePartition The partition of each node.
+   * \returns \c true if the channel must be cut.
+   */
+  static bool IsCut (const Cuttable &channel, const std::vector<uint32_t> &nodePartition);
+
+  /**
+   * Wait for another thread: spin a little, then yield the core, then
+   * sleep, so that idle threads do not steal the cores of busy ones.
+   *
+   * \param [in,out] spins The number of waits so far.
+   */
+  static void Backoff (uint32_t &spins);
+};
+
+} // namespace ns3
+
+#endif /* NS3_THREAD_PARTITIONER_H */
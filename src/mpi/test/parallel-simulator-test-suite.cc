@@ -0,0 +1,323 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/rollback.h"
+#include "ns3/config.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/packet.h"
+#include "ns3/buffer.h"
+#include "ns3/tag.h"
+
+#include <set>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup mpi
+ * \defgroup mpi-test mpi module tests
+ */
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * Number of times a packet was forwarded.
+ */
+class ParallelSimulatorTestTag : public Tag
+{
+public:
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::ParallelSimulatorTestTag")
+      .SetParent<Tag> ()
+      .SetGroupName ("Mpi")
+      .AddConstructor<ParallelSimulatorTestTag> ();
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return 1;
+  }
+  virtual void Serialize (TagBuffer i) const
+  {
+    i.WriteU8 (m_hops);
+  }
+  virtual void Deserialize (TagBuffer i)
+  {
+    m_hops = i.ReadU8 ();
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << "hops=" << (uint32_t) m_hops;
+  }
+  uint8_t m_hops = 0;
+};
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * Run a ring of nodes, some linked without delay, which generate
+ * packets and forward them a few hops, with a parallel simulator and
+ * with the DefaultSimulatorImpl: the packets received by each node and
+ * the time they were received at must be the same, and every event must
+ * run in the context of its node, and the packets created by different
+ * threads must have different uids.
+ */
+class ParallelSimulatorRingTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   *
+   * \param [in] simulatorType The parallel simulator.
+   * \param [in] threads The value of its MaxThreads attribute.
+   * \param [in] stop The duration of the simulation.
+   */
+  ParallelSimulatorRingTestCase (std::string simulatorType, uint32_t threads, Time stop);
+
+private:
+  virtual void DoRun (void);
+
+  /** Per node counters, restored on rollback. */
+  struct State
+  {
+    uint64_t count;   //!< Packets received.
+    uint64_t sum;     //!< Hash of the packets received.
+    /**
+     * Inequality, needed to bind a State to a Callback.
+     *
+     * \param [in] o The other state.
+     * \returns \c true if the states differ.
+     */
+    bool operator != (const State &o) const
+    {
+      return count != o.count || sum != o.sum;
+    }
+  };
+
+  /**
+   * Build the ring and run it.
+   *
+   * \param [in] simulatorType The simulator implementation.
+   * \returns The state of every node at the end of the simulation.
+   */
+  std::vector<State> RunRing (std::string simulatorType);
+  /**
+   * Receive a packet, and forward it on the next device.
+   *
+   * \param [in] dev The device.
+   * \param [in] p The packet.
+   * \param [in] protocol The protocol number.
+   * \param [in] from The sender.
+   * \returns \c true.
+   */
+  bool Receive (Ptr<NetDevice> dev, Ptr<const Packet> p, uint16_t protocol, const Address &from);
+  /**
+   * Send a packet on every device of a node, every 100 us or so.
+   *
+   * \param [in] node The node.
+   * \param [in] seq The number of packets generated so far.
+   */
+  void Generate (Ptr<Node> node, uint32_t seq);
+  /**
+   * Undo the changes of an event to the state of a node.
+   *
+   * \param [in] node The node id.
+   * \param [in] state The state before the event.
+   */
+  void Restore (uint32_t node, State state);
+
+  std::string m_simulatorType;      //!< The parallel simulator.
+  uint32_t m_threads;               //!< Its number of threads.
+  Time m_stop;                      //!< The duration of the simulation.
+  std::vector<State> m_state;       //!< The state of every node.
+  std::vector<uint32_t> m_wrongContext;  //!< Events run out of context, per node.
+  std::vector<std::vector<uint64_t> > m_uids;  //!< Uids of the packets generated, per node.
+};
+
+static const uint32_t RING_NODES = 24;
+
+ParallelSimulatorRingTestCase::ParallelSimulatorRingTestCase (std::string simulatorType, uint32_t threads, Time stop)
+  : TestCase ("Check " + simulatorType + " with " + std::to_string (threads) +
+              " threads runs a ring of nodes like the DefaultSimulatorImpl"),
+    m_simulatorType (simulatorType),
+    m_threads (threads),
+    m_stop (stop)
+{
+}
+
+void
+ParallelSimulatorRingTestCase::Restore (uint32_t node, State state)
+{
+  m_state[node] = state;
+}
+
+bool
+ParallelSimulatorRingTestCase::Receive (Ptr<NetDevice> dev, Ptr<const Packet> p, uint16_t protocol, const Address &from)
+{
+  uint32_t node = dev->GetNode ()->GetId ();
+  if (Simulator::GetContext () != node)
+    {
+      m_wrongContext[node]++;
+    }
+  if (Rollback::IsEnabled ())
+    {
+      Rollback::Save (MakeCallback (&ParallelSimulatorRingTestCase::Restore, this).TwoBind (node, m_state[node]));
+    }
+  ParallelSimulatorTestTag tag;
+  p->PeekPacketTag (tag);
+  uint8_t data[4];
+  p->CopyData (data, 4);
+  uint64_t x = Simulator::Now ().GetTimeStep () * 1000003 + (p->GetSize () * 256 + tag.m_hops) * 7919 + data[0] + data[3];
+  x ^= x >> 31;
+  x *= 0x9e3779b97f4a7c15ULL;
+  x ^= x >> 29;
+  m_state[node].count++;
+  m_state[node].sum += x;
+
+  if (tag.m_hops < 3)
+    {
+      Ptr<Node> n = dev->GetNode ();
+      Ptr<NetDevice> out = n->GetDevice ((dev->GetIfIndex () + 1) % n->GetNDevices ());
+      Ptr<Packet> copy = p->Copy ();
+      copy->RemovePacketTag (tag);
+      tag.m_hops++;
+      copy->AddPacketTag (tag);
+      out->Send (copy, out->GetBroadcast (), 1);
+    }
+  return true;
+}
+
+void
+ParallelSimulatorRingTestCase::Generate (Ptr<Node> node, uint32_t seq)
+{
+  uint8_t data[64];
+  for (uint32_t k = 0; k < 64; k++)
+    {
+      data[k] = (node->GetId () * 7 + seq + k) & 0xff;
+    }
+  for (uint32_t d = 0; d < node->GetNDevices (); d++)
+    {
+      Ptr<Packet> p = Create<Packet> (data, 4 + (node->GetId () + seq + d) % 60);
+      m_uids[node->GetId ()].push_back (p->GetUid ());
+      ParallelSimulatorTestTag tag;
+      p->AddPacketTag (tag);
+      node->GetDevice (d)->Send (p, node->GetDevice (d)->GetBroadcast (), 1);
+    }
+  Simulator::Schedule (MicroSeconds (100 + node->GetId () % 7),
+                       &ParallelSimulatorRingTestCase::Generate, this, node, seq + 1);
+}
+
+std::vector<ParallelSimulatorRingTestCase::State>
+ParallelSimulatorRingTestCase::RunRing (std::string simulatorType)
+{
+  Config::SetGlobal ("SimulatorImplementationType", StringValue (simulatorType));
+  m_state.assign (RING_NODES, State {0, 0});
+  m_wrongContext.assign (RING_NODES, 0);
+  m_uids.assign (RING_NODES, std::vector<uint64_t> ());
+
+  NodeContainer nodes;
+  nodes.Create (RING_NODES);
+  SimpleNetDeviceHelper helper;
+  // every fourth link has no delay, so its nodes cannot run in parallel
+  for (uint32_t i = 0; i < RING_NODES; i++)
+    {
+      Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+      channel->SetAttribute ("Delay", TimeValue (i % 4 == 3 ? Time (0) : MicroSeconds (50 + i % 3 * 10)));
+      NetDeviceContainer devices = helper.Install (nodes.Get (i), channel);
+      devices.Add (helper.Install (nodes.Get ((i + 1) % RING_NODES), channel));
+      for (uint32_t k = 0; k < devices.GetN (); k++)
+        {
+          devices.Get (k)->SetReceiveCallback (MakeCallback (&ParallelSimulatorRingTestCase::Receive, this));
+        }
+    }
+  for (uint32_t i = 0; i < RING_NODES; i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &ParallelSimulatorRingTestCase::Generate,
+                                      this, nodes.Get (i), 0);
+    }
+  Simulator::Stop (m_stop);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::DefaultSimulatorImpl"));
+  return m_state;
+}
+
+void
+ParallelSimulatorRingTestCase::DoRun (void)
+{
+  Config::SetDefault (m_simulatorType + "::MaxThreads", UintegerValue (m_threads));
+  std::vector<State> expected = RunRing ("ns3::DefaultSimulatorImpl");
+  Buffer::PoolStatistics before = Buffer::GetPoolStatistics ();
+  std::vector<State> got = RunRing (m_simulatorType);
+  Buffer::PoolStatistics after = Buffer::GetPoolStatistics ();
+
+  // packets are often freed by another thread than the one which created them
+  NS_TEST_EXPECT_MSG_EQ (after.bytesOutstanding, before.bytesOutstanding, "Buffer memory miscounted");
+  NS_TEST_EXPECT_MSG_LT (after.peakBytesOutstanding, 1 << 30, "Buffer memory peak miscounted");
+
+  // the packets generated again after a rollback have new uids
+  std::set<uint64_t> uids;
+  uint64_t generated = 0;
+  for (uint32_t i = 0; i < RING_NODES; i++)
+    {
+      uids.insert (m_uids[i].begin (), m_uids[i].end ());
+      generated += m_uids[i].size ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (uids.size (), generated, "Packets created by different threads share a uid");
+
+  NS_TEST_ASSERT_MSG_GT (expected[0].count, 0, "No packet received");
+  for (uint32_t i = 0; i < RING_NODES; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_wrongContext[i], 0, "Node " << i << " run events of another node");
+      NS_TEST_EXPECT_MSG_EQ (got[i].count, expected[i].count, "Node " << i << " received other packets");
+      NS_TEST_EXPECT_MSG_EQ (got[i].sum, expected[i].sum, "Node " << i << " received other packets");
+    }
+}
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * The parallel simulators.
+ */
+class ParallelSimulatorTestSuite : public TestSuite
+{
+public:
+  ParallelSimulatorTestSuite ()
+    : TestSuite ("parallel-simulator", UNIT)
+  {
+    AddTestCase (new ParallelSimulatorRingTestCase ("ns3::MultithreadedSimulatorImpl", 1, MilliSeconds (20)), TestCase::QUICK);
+    AddTestCase (new ParallelSimulatorRingTestCase ("ns3::MultithreadedSimulatorImpl", 4, MilliSeconds (20)), TestCase::QUICK);
+    // rollbacks make the optimistic simulator much slower on this ring
+    AddTestCase (new ParallelSimulatorRingTestCase ("ns3::OptimisticSimulatorImpl", 4, MilliSeconds (3)), TestCase::QUICK);
+  }
+};
+
+static ParallelSimulatorTestSuite g_parallelSimulatorTestSuite; //!< Static variable for test initialization
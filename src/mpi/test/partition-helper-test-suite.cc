@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "ns3/node-container.h"
+#include "ns3/partition-helper.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * Partition clusters of nodes linked by short delays, chained by long
+ * delays: each cluster must be kept on one rank, the zero delay links
+ * must not be cut and the load must be balanced.
+ */
+class PartitionHelperTestCase : public TestCase
+{
+public:
+  PartitionHelperTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+PartitionHelperTestCase::PartitionHelperTestCase ()
+  : TestCase ("Check PartitionHelper keeps clusters of nodes together and balances the ranks")
+{
+}
+
+void
+PartitionHelperTestCase::DoRun (void)
+{
+  const uint32_t ranks = 3;
+  const uint32_t clusters = 6;
+  const uint32_t size = 10;
+  PartitionHelper partition;
+  std::vector<NodeContainer> cluster (clusters);
+  for (uint32_t c = 0; c < clusters; c++)
+    {
+      cluster[c].Create (size);
+      for (uint32_t i = 1; i < size; i++)
+        {
+          partition.AddLink (cluster[c].Get (0), cluster[c].Get (i), MicroSeconds (100 + i), 5);
+        }
+      partition.AddLink (cluster[c].Get (1), cluster[c].Get (2), Seconds (0));
+      partition.SetNodeWeight (cluster[c].Get (0), 4);
+    }
+  for (uint32_t c = 0; c < clusters; c++)
+    {
+      partition.AddLink (cluster[c].Get (0), cluster[(c + 1) % clusters].Get (0), MilliSeconds (10 + c % 2), 1);
+    }
+  partition.Partition (ranks);
+
+  for (uint32_t c = 0; c < clusters; c++)
+    {
+      uint32_t systemId = cluster[c].Get (0)->GetSystemId ();
+      NS_TEST_EXPECT_MSG_LT (systemId, ranks, "Node assigned to a missing rank");
+      NS_TEST_EXPECT_MSG_EQ (partition.GetSystemId (cluster[c].Get (0)), systemId, "System id not set");
+      for (uint32_t i = 1; i < size; i++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (cluster[c].Get (i)->GetSystemId (), systemId, "Cluster " << c << " was split");
+        }
+    }
+  for (uint32_t r = 0; r < ranks; r++)
+    {
+      NS_TEST_EXPECT_MSG_EQ_TOL (partition.GetLoad (r), 26, 1e-9, "Rank " << r << " not balanced");
+    }
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (partition.GetLookAhead (), MilliSeconds (10), "Short link cut");
+  NS_TEST_EXPECT_MSG_EQ_TOL (partition.GetCutTraffic (), 3, 1e-9, "Too much traffic cut");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup mpi-test
+ * \ingroup tests
+ *
+ * PartitionHelper TestSuite
+ */
+class PartitionHelperTestSuite : public TestSuite
+{
+public:
+  PartitionHelperTestSuite ()
+    : TestSuite ("partition-helper", UNIT)
+  {
+    AddTestCase (new PartitionHelperTestCase (), TestCase::QUICK);
+  }
+};
+
+static PartitionHelperTestSuite g_partitionHelperTestSuite; //!< Static variable for test initialization
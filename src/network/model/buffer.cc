@@ -20,6 +20,10 @@
 #include "buffer.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/uinteger.h"
+#include "ns3/system-mutex.h"
+#include <atomic>
 
 #define LOG_INTERNAL_STATE(y)                                                                    \
   NS_LOG_LOGIC (y << "start="<<m_start<<", end="<<m_end<<", zero start="<<m_zeroAreaStart<<              \
@@ -50,16 +54,43 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("Buffer");
 
 
-uint32_t Buffer::g_recommendedStart = 0;
+thread_local uint32_t Buffer::g_recommendedStart = 0;
+
+Buffer::PoolStatistics::PoolStatistics ()
+  : requests (0),
+    hits (0),
+    bytesOutstanding (0),
+    peakBytesOutstanding (0),
+    bytesCached (0)
+{
+}
+
+double
+Buffer::PoolStatistics::GetHitRate (void) const
+{
+  return requests == 0 ? 0.0 : static_cast<double> (hits) / requests;
+}
+
+void
+Buffer::PoolStatistics::Print (std::ostream &os) const
+{
+  os << "requests=" << requests
+     << " hits=" << hits
+     << " hit-rate=" << GetHitRate ()
+     << " bytes-outstanding=" << bytesOutstanding
+     << " peak-bytes-outstanding=" << peakBytesOutstanding
+     << " bytes-cached=" << bytesCached;
+}
+
 #ifdef BUFFER_FREE_LIST
 /* The following macros are pretty evil but they are needed to allow us to
- * keep track of 3 possible states for the g_freeList variable:
+ * keep track of 3 possible states for the g_pool variable:
  *  - uninitialized means that no one has created a buffer yet
- *    so no one has created the associated free list (it is created
+ *    so no one has created the associated pool (it is created
  *    on-demand when the first buffer is created)
- *  - initialized means that the free list exists and is valid
- *  - destroyed means that the static destructors of this compilation unit
- *    have run so, the free list has been cleared from its content
+ *  - initialized means that the pool exists and is valid
+ *  - destroyed means that the thread-local destructors of this thread
+ *    have run so, the pool has been cleared from its content
  * The key is that in destroyed state, we are careful not re-create it
  * which is a typical weakness of lazy evaluation schemes which use 
  * '0' as a special value to indicate both un-initialized and destroyed.
@@ -70,27 +101,113 @@ uint32_t Buffer::g_recommendedStart = 0;
  * constructor orderings.
  */
 #define MAGIC_DESTROYED (~(long) 0)
-#define IS_UNINITIALIZED(x) (x == (Buffer::FreeList*)0)
-#define IS_DESTROYED(x) (x == (Buffer::FreeList*)MAGIC_DESTROYED)
+#define IS_UNINITIALIZED(x) (x == (Buffer::Pool*)0)
+#define IS_DESTROYED(x) (x == (Buffer::Pool*)MAGIC_DESTROYED)
 #define IS_INITIALIZED(x) (!IS_UNINITIALIZED (x) && !IS_DESTROYED (x))
-#define DESTROYED ((Buffer::FreeList*)MAGIC_DESTROYED)
-#define UNINITIALIZED ((Buffer::FreeList*)0)
-uint32_t Buffer::g_maxSize = 0;
-Buffer::FreeList *Buffer::g_freeList = 0;
-struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
+#define DESTROYED ((Buffer::Pool*)MAGIC_DESTROYED)
+#define UNINITIALIZED ((Buffer::Pool*)0)
 
-Buffer::LocalStaticDestructor::~LocalStaticDestructor(void)
+/** Log2 of the size of the smallest size class. */
+static const uint32_t POOL_MIN_SHIFT = 6;
+/** Number of size classes, from 64 bytes to 64 KiB. */
+static const uint32_t POOL_CLASSES = 11;
+
+static GlobalValue g_bufferPoolMaxFree = GlobalValue ("BufferPoolMaxFree",
+                                                      "The number of free buffer blocks each thread keeps per size class, "
+                                                      "read by each thread when it creates its first buffer",
+                                                      UintegerValue (1000),
+                                                      MakeUintegerChecker<uint32_t> ());
+
+/**
+ * Bytes of the blocks in use, over all threads: a block may be freed by
+ * another thread than the one which created it.
+ */
+static std::atomic<int64_t> g_bytesOutstanding (0);
+/** Peak of g_bytesOutstanding. */
+static std::atomic<int64_t> g_peakBytesOutstanding (0);
+
+/**
+ * Get the size class of a block.
+ *
+ * \param size the size of the block
+ * \returns the size class, POOL_CLASSES if the block is too large
+ */
+static uint32_t
+GetSizeClass (uint32_t size)
 {
-  NS_LOG_FUNCTION (this);
-  if (IS_INITIALIZED (g_freeList))
+  uint32_t cls = 0;
+  while (cls < POOL_CLASSES && (1U << (cls + POOL_MIN_SHIFT)) < size)
+    {
+      cls++;
+    }
+  return cls;
+}
+
+/**
+ * The free lists and statistics of a thread.
+ */
+struct Buffer::Pool
+{
+  Pool ();
+  ~Pool ();
+
+  FreeList freeLists[POOL_CLASSES];  //!< Free blocks per size class
+  uint32_t maxFree;                  //!< Max free blocks per size class
+  uint32_t maxSize;                  //!< Size of the largest pooled block recycled
+  PoolStatistics stats;              //!< Statistics of this thread
+
+  /// The statistics of the threads which exited
+  struct Exited
+  {
+    SystemMutex mutex;                 //!< Protects the statistics
+    PoolStatistics stats;              //!< Statistics of the threads exited
+  };
+  /**
+   * \returns the statistics of the threads which exited
+   */
+  static Exited & GetExited (void);
+};
+
+Buffer::Pool::Pool ()
+  : maxSize (0)
+{
+  UintegerValue value;
+  g_bufferPoolMaxFree.GetValue (value);
+  maxFree = value.Get ();
+}
+
+Buffer::Pool::~Pool ()
+{
+  for (uint32_t i = 0; i < POOL_CLASSES; i++)
     {
-      for (Buffer::FreeList::iterator i = g_freeList->begin ();
-           i != g_freeList->end (); i++)
+      for (FreeList::iterator j = freeLists[i].begin (); j != freeLists[i].end (); j++)
         {
-          Buffer::Deallocate (*i);
+          Buffer::Deallocate (*j);
         }
-      delete g_freeList;
-      g_freeList = DESTROYED;
+    }
+  Exited &exited = GetExited ();
+  CriticalSection critical (exited.mutex);
+  exited.stats.requests += stats.requests;
+  exited.stats.hits += stats.hits;
+}
+
+Buffer::Pool::Exited &
+Buffer::Pool::GetExited (void)
+{
+  static Exited exited;
+  return exited;
+}
+
+thread_local Buffer::Pool *Buffer::g_pool = 0;
+thread_local struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
+
+Buffer::LocalStaticDestructor::~LocalStaticDestructor(void)
+{
+  NS_LOG_FUNCTION (this);
+  if (IS_INITIALIZED (g_pool))
+    {
+      delete g_pool;
+      g_pool = DESTROYED;
     }
 }
 
@@ -99,19 +216,32 @@ Buffer::Recycle (struct Buffer::Data *data)
 {
   NS_LOG_FUNCTION (data);
   NS_ASSERT (data->m_count == 0);
-  NS_ASSERT (!IS_UNINITIALIZED (g_freeList));
-  g_maxSize = std::max (g_maxSize, data->m_size);
-  /* feed into free list */
-  if (data->m_size < g_maxSize ||
-      IS_DESTROYED (g_freeList) ||
-      g_freeList->size () > 1000)
+  g_bytesOutstanding.fetch_sub (data->m_size, std::memory_order_relaxed);
+  if (IS_UNINITIALIZED (g_pool))
+    {
+      // the data was created by another thread
+      g_pool = new Buffer::Pool ();
+      (void) &g_localStaticDestructor;
+    }
+  if (IS_DESTROYED (g_pool))
     {
       Buffer::Deallocate (data);
+      return;
+    }
+  NS_ASSERT (IS_INITIALIZED (g_pool));
+  /* feed into the free list of its size class */
+  uint32_t cls = GetSizeClass (data->m_size);
+  if (cls < POOL_CLASSES &&
+      data->m_size == (1U << (cls + POOL_MIN_SHIFT)) &&
+      g_pool->freeLists[cls].size () < g_pool->maxFree)
+    {
+      g_pool->freeLists[cls].push_back (data);
+      g_pool->stats.bytesCached += data->m_size;
+      g_pool->maxSize = std::max (g_pool->maxSize, data->m_size);
     }
   else
     {
-      NS_ASSERT (IS_INITIALIZED (g_freeList));
-      g_freeList->push_back (data);
+      Buffer::Deallocate (data);
     }
 }
 
@@ -119,29 +249,67 @@ Buffer::Data *
 Buffer::Create (uint32_t dataSize)
 {
   NS_LOG_FUNCTION (dataSize);
-  /* try to find a buffer correctly sized. */
-  if (IS_UNINITIALIZED (g_freeList))
+  if (IS_UNINITIALIZED (g_pool))
     {
-      g_freeList = new Buffer::FreeList ();
+      g_pool = new Buffer::Pool ();
+      // a thread_local is only constructed, and so destroyed at thread
+      // exit, once used by its thread
+      (void) &g_localStaticDestructor;
     }
-  else if (IS_INITIALIZED (g_freeList))
+  else if (IS_DESTROYED (g_pool))
+    {
+      struct Buffer::Data *data = Buffer::Allocate (dataSize);
+      g_bytesOutstanding.fetch_add (data->m_size, std::memory_order_relaxed);
+      return data;
+    }
+  if (dataSize == 0)
+    {
+      // a new buffer: leave room for the headers and trailers seen so far
+      dataSize = g_pool->maxSize;
+    }
+  g_pool->stats.requests++;
+  uint32_t cls = GetSizeClass (dataSize);
+  struct Buffer::Data *data;
+  if (cls < POOL_CLASSES && !g_pool->freeLists[cls].empty ())
+    {
+      data = g_pool->freeLists[cls].back ();
+      g_pool->freeLists[cls].pop_back ();
+      data->m_count = 1;
+      g_pool->stats.hits++;
+      g_pool->stats.bytesCached -= data->m_size;
+    }
+  else
+    {
+      // whole size class, so the block can serve any buffer of that class later
+      data = Buffer::Allocate (cls < POOL_CLASSES ? 1U << (cls + POOL_MIN_SHIFT) : dataSize);
+    }
+  int64_t outstanding = g_bytesOutstanding.fetch_add (data->m_size, std::memory_order_relaxed) + data->m_size;
+  int64_t peak = g_peakBytesOutstanding.load (std::memory_order_relaxed);
+  while (outstanding > peak &&
+         !g_peakBytesOutstanding.compare_exchange_weak (peak, outstanding, std::memory_order_relaxed))
     {
-      while (!g_freeList->empty ()) 
-        {
-          struct Buffer::Data *data = g_freeList->back ();
-          g_freeList->pop_back ();
-          if (data->m_size >= dataSize) 
-            {
-              data->m_count = 1;
-              return data;
-            }
-          Buffer::Deallocate (data);
-        }
     }
-  struct Buffer::Data *data = Buffer::Allocate (dataSize);
   NS_ASSERT (data->m_count == 1);
   return data;
 }
+
+Buffer::PoolStatistics
+Buffer::GetPoolStatistics (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  Pool::Exited &exited = Pool::GetExited ();
+  CriticalSection critical (exited.mutex);
+  PoolStatistics stats = exited.stats;
+  stats.bytesOutstanding = g_bytesOutstanding.load (std::memory_order_relaxed);
+  stats.peakBytesOutstanding = g_peakBytesOutstanding.load (std::memory_order_relaxed);
+  if (IS_INITIALIZED (g_pool))
+    {
+      stats.requests += g_pool->stats.requests;
+      stats.hits += g_pool->stats.hits;
+      stats.bytesCached += g_pool->stats.bytesCached;
+    }
+  return stats;
+}
 #else /* BUFFER_FREE_LIST */
 void
 Buffer::Recycle (struct Buffer::Data *data)
@@ -157,6 +325,13 @@ Buffer::Create (uint32_t size)
   NS_LOG_FUNCTION (size);
   return Allocate (size);
 }
+
+Buffer::PoolStatistics
+Buffer::GetPoolStatistics (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  return PoolStatistics ();
+}
 #endif /* BUFFER_FREE_LIST */
 
 struct Buffer::Data *
@@ -426,7 +601,65 @@ Buffer::AddAtEnd (const Buffer &o)
       return;
     }
 
-  *this = CreateFullCopy ();
+  uint32_t zeroSize = m_zeroAreaEnd - m_zeroAreaStart;
+  uint32_t oZeroSize = o.m_zeroAreaEnd - o.m_zeroAreaStart;
+  if (zeroSize != 0 || oZeroSize != 0)
+    {
+      /**
+       * A buffer has a single zero area: rather than writing out both
+       * zero areas, rebuild the buffer around the two merged ones if
+       * they are adjacent, or else around the larger one, so that only
+       * the real bytes and the smaller zero area are ever copied.
+       */
+      uint32_t head;
+      uint32_t tail;
+      Buffer::Iterator i;
+      if (m_end == m_zeroAreaEnd && o.m_start == o.m_zeroAreaStart)
+        {
+          Buffer tmp (zeroSize + oZeroSize);
+          head = m_zeroAreaStart - m_start;
+          tail = o.m_end - o.m_zeroAreaEnd;
+          tmp.AddAtStart (head);
+          tmp.Begin ().Write (m_data->m_data + m_start, head);
+          tmp.AddAtEnd (tail);
+          i = tmp.End ();
+          i.Prev (tail);
+          i.Write (o.m_data->m_data + o.m_zeroAreaStart, tail);
+          *this = tmp;
+        }
+      else if (zeroSize >= oZeroSize)
+        {
+          Buffer tmp (zeroSize);
+          head = m_zeroAreaStart - m_start;
+          tail = m_end - m_zeroAreaEnd;
+          tmp.AddAtStart (head);
+          tmp.Begin ().Write (m_data->m_data + m_start, head);
+          tmp.AddAtEnd (tail + o.GetSize ());
+          i = tmp.End ();
+          i.Prev (tail + o.GetSize ());
+          i.Write (m_data->m_data + m_zeroAreaStart, tail);
+          i.Write (o.Begin (), o.End ());
+          *this = tmp;
+        }
+      else
+        {
+          Buffer tmp (oZeroSize);
+          head = o.m_zeroAreaStart - o.m_start;
+          tail = o.m_end - o.m_zeroAreaEnd;
+          tmp.AddAtStart (GetSize () + head);
+          i = tmp.Begin ();
+          i.Write (Begin (), End ());
+          i.Write (o.m_data->m_data + o.m_start, head);
+          tmp.AddAtEnd (tail);
+          i = tmp.End ();
+          i.Prev (tail);
+          i.Write (o.m_data->m_data + o.m_zeroAreaStart, tail);
+          *this = tmp;
+        }
+      NS_ASSERT (CheckInternalState ());
+      return;
+    }
+
   AddAtEnd (o.GetSize ());
   Buffer::Iterator destStart = End ();
   destStart.Prev (o.GetSize ());
@@ -843,27 +1076,32 @@ Buffer::Iterator::Write (Iterator start, Iterator end)
   uint32_t size = end.m_current - start.m_current;
   NS_ASSERT_MSG (CheckNoZero (m_current, m_current + size),
                  GetWriteErrorMessage ());
+  // the written bytes are all on the same side of our zero area
+  uint8_t *to = &m_data[m_current];
+  if (m_current > m_zeroStart)
+    {
+      to -= m_zeroEnd - m_zeroStart;
+    }
+  m_current += size;
   if (start.m_current <= start.m_zeroStart)
     {
       uint32_t toCopy = std::min (size, start.m_zeroStart - start.m_current);
-      memcpy (&m_data[m_current], &start.m_data[start.m_current], toCopy);
+      memcpy (to, &start.m_data[start.m_current], toCopy);
       start.m_current += toCopy;
-      m_current += toCopy;
+      to += toCopy;
       size -= toCopy;
     }
   if (start.m_current <= start.m_zeroEnd)
     {
       uint32_t toCopy = std::min (size, start.m_zeroEnd - start.m_current);
-      memset (&m_data[m_current], 0, toCopy);
+      memset (to, 0, toCopy);
       start.m_current += toCopy;
-      m_current += toCopy;
+      to += toCopy;
       size -= toCopy;
     }
   uint32_t toCopy = std::min (size, start.m_dataEnd - start.m_current);
   uint8_t *from = &start.m_data[start.m_current - (start.m_zeroEnd-start.m_zeroStart)];
-  uint8_t *to = &m_data[m_current];
   memcpy (to, from, toCopy);
-  m_current += toCopy;
 }
 
 void 
@@ -65,9 +65,10 @@ namespace ns3 {
  * contains real data bytes in its BufferData instance but it also
  * contains "virtual zero data" which typically is used to represent
  * application-level payload. No memory is allocated to store the
- * zero bytes of application-level payload unless the user fragments
- * a Buffer: this application-level payload is kept track of with
- * a pair of integers which describe where in the buffer content
+ * zero bytes of application-level payload unless the user peeks at
+ * them, or appends two Buffers which both hold a zero area and real
+ * bytes in between: this application-level payload is kept track of
+ * with a pair of integers which describe where in the buffer content
  * the "virtual zero area" starts and ends.
  *
  * \verbatim
@@ -524,7 +525,10 @@ private:
   /**
    * \param o the buffer to append to the end of this buffer.
    *
-   * Add bytes at the end of the Buffer.
+   * Add bytes at the end of the Buffer. The zero areas of the two
+   * buffers are merged if they are adjacent, e.g. when reassembling
+   * fragments of a payload. Otherwise only the larger one stays
+   * virtual, and the smaller one is written out.
    * Any call to this method invalidates any Iterator
    * pointing to this Buffer.
    */
@@ -642,6 +646,45 @@ private:
    */
   Buffer (uint32_t dataSize, bool initialize);
   ~Buffer ();
+
+  /**
+   * \brief Statistics of the memory of the buffers.
+   *
+   * The Buffer::Data blocks come from per-thread free lists of
+   * power-of-two size classes, from 64 bytes to 64 KiB; larger
+   * blocks are not pooled. The requests, hits and cached bytes are
+   * summed over the calling thread and the threads which already
+   * exited, e.g. the workers of a parallel simulator once
+   * Simulator::Run returned; the outstanding bytes are counted over
+   * all threads.
+   */
+  struct PoolStatistics
+  {
+    PoolStatistics ();
+    /**
+     * \returns the fraction of the requests served by a free list.
+     */
+    double GetHitRate (void) const;
+    /**
+     * \param os the output stream
+     */
+    void Print (std::ostream &os) const;
+
+    uint64_t requests;            //!< Blocks requested.
+    uint64_t hits;                //!< Requests served by a free list.
+    int64_t bytesOutstanding;     //!< Bytes of the blocks in use.
+    int64_t peakBytesOutstanding; //!< Peak of bytesOutstanding.
+    uint64_t bytesCached;         //!< Bytes of the blocks in the free lists.
+  };
+  /**
+   * The number of free blocks each thread keeps per size class is
+   * set by the "BufferPoolMaxFree" GlobalValue. Each thread reads it
+   * when it creates its first buffer, so set it before creating any
+   * Packet.
+   *
+   * \returns the statistics of the memory of the buffers.
+   */
+  static PoolStatistics GetPoolStatistics (void);
 private:
   /**
    * This data structure is variable-sized through its last member whose size
@@ -765,9 +808,9 @@ private:
   /**
    * location in a newly-allocated buffer where you should start
    * writing data. i.e., m_start should be initialized to this 
-   * value.
+   * value. Kept per thread, like the free list.
    */
-  static uint32_t g_recommendedStart;
+  static thread_local uint32_t g_recommendedStart;
 
   /**
    * offset to the start of the virtual zero area from the start
@@ -793,14 +836,20 @@ private:
 #ifdef BUFFER_FREE_LIST
   /// Container for buffer data
   typedef std::vector<struct Buffer::Data*> FreeList;
-  /// Local static destructor structure
+  /// The free lists and statistics of a thread
+  struct Pool;
+  /// Local static destructor structure, run when its thread exits
   struct LocalStaticDestructor 
   {
     ~LocalStaticDestructor ();
   };
-  static uint32_t g_maxSize; //!< Max observed data size
-  static FreeList *g_freeList; //!< Buffer data container
-  static struct LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
+  /*
+   * The pool is per thread: the reference counts are not atomic,
+   * so a Buffer::Data is only shared within a thread, but it may be
+   * freed by another thread than the one which created it.
+   */
+  static thread_local Pool *g_pool; //!< Free lists of this thread
+  static thread_local struct LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
 #endif
 };
 
@@ -51,14 +51,15 @@ struct ByteTagListData {
  *
  * \brief Container class for struct ByteTagListData
  *
- * Internal use only.
+ * Internal use only. Each thread has its own, since the data are
+ * only shared within a thread.
  */
-static class ByteTagListDataFreeList : public std::vector<struct ByteTagListData *>
+static thread_local class ByteTagListDataFreeList : public std::vector<struct ByteTagListData *>
 {
 public:
   ~ByteTagListDataFreeList ();
-} g_freeList; //!< Container for struct ByteTagListData
-static uint32_t g_maxSize = 0; //!< maximum data size (used for allocation)
+} g_freeList; //!< Container for struct ByteTagListData, per thread
+static thread_local uint32_t g_maxSize = 0; //!< maximum data size (used for allocation)
 
 ByteTagListDataFreeList::~ByteTagListDataFreeList ()
 {
@@ -104,11 +105,12 @@ ByteTagList::Iterator::PrepareForNext (void)
   NS_LOG_FUNCTION (this);
   while (m_current < m_end)
     {
-      TagBuffer buf = TagBuffer (m_current, m_end);
-      m_nextTid = buf.ReadU32 ();
-      m_nextSize = buf.ReadU32 ();
-      m_nextStart = buf.ReadU32 () + m_adjustment;
-      m_nextEnd = buf.ReadU32 () + m_adjustment;
+      uint32_t header[4];
+      std::memcpy (header, m_current, sizeof (header));
+      m_nextTid = header[0];
+      m_nextSize = header[1];
+      m_nextStart = header[2] + m_adjustment;
+      m_nextEnd = header[3] + m_adjustment;
       if (m_nextStart >= m_offsetEnd || m_nextEnd <= m_offsetStart)
         {
           m_current += 4 + 4 + 4 + 4 + m_nextSize;
@@ -207,12 +209,12 @@ ByteTagList::Add (TypeId tid, uint32_t bufferSize, int32_t start, int32_t end)
       Deallocate (m_data);
       m_data = newData;
     }
-  TagBuffer tag = TagBuffer (&m_data->data[m_used], 
+  // the header is only read by Iterator::PrepareForNext, in host order
+  uint32_t header[4] = { tid.GetUid (), bufferSize,
+                         (uint32_t)(start - m_adjustment), (uint32_t)(end - m_adjustment) };
+  std::memcpy (&m_data->data[m_used], header, sizeof (header));
+  TagBuffer tag = TagBuffer (&m_data->data[m_used + sizeof (header)],
                              &m_data->data[spaceNeeded]);
-  tag.WriteU32 (tid.GetUid ());
-  tag.WriteU32 (bufferSize);
-  tag.WriteU32 (start - m_adjustment);
-  tag.WriteU32 (end - m_adjustment);
   if (start - m_adjustment < m_minStart)
     {
       m_minStart = start - m_adjustment;
@@ -264,7 +266,10 @@ ByteTagList::Iterator
 ByteTagList::Begin (int32_t offsetStart, int32_t offsetEnd) const
 {
   NS_LOG_FUNCTION (this << offsetStart << offsetEnd);
-  if (m_data == 0)
+  // no need to walk the tags if none of them may overlap the range
+  if (m_data == 0
+      || (int64_t)m_maxEnd + m_adjustment <= offsetStart
+      || (int64_t)m_minStart + m_adjustment >= offsetEnd)
     {
       return Iterator (0, 0, offsetStart, offsetEnd, 0);
     }
@@ -298,10 +303,6 @@ ByteTagList::AddAtEnd (int32_t appendOffset)
         }
       TagBuffer buf = list.Add (item.tid, item.size, item.start, item.end);
       buf.CopyFrom (item.buf);
-      if (item.end > m_maxEnd)
-        {
-          m_maxEnd = item.end;
-        }
     }
   *this = list;
 }
@@ -314,7 +315,6 @@ ByteTagList::AddAtStart (int32_t prependOffset)
     {
       return;
     }
-  m_minStart = INT32_MAX;
   ByteTagList list;
   ByteTagList::Iterator i = BeginAll ();
   while (i.HasNext ())
@@ -331,10 +331,6 @@ ByteTagList::AddAtStart (int32_t prependOffset)
         }
       TagBuffer buf = list.Add (item.tid, item.size, item.start, item.end);
       buf.CopyFrom (item.buf);
-      if (item.start < m_minStart)
-        {
-          m_minStart = item.start;
-        }
     }
   *this = list;
 }
@@ -42,8 +42,8 @@ struct ByteTagListData;
  * of things to keep in mind here:
  *
  *   - It stores all tags in a single byte buffer: each tag is stored
- *     as 4 32bit integers (TypeId, tag data size, start, end) followed 
- *     by the tag data as generated by Tag::Serialize.
+ *     as 4 32bit integers (TypeId, tag data size, start, end), in host
+ *     order, followed by the tag data as generated by Tag::Serialize.
  *
  *   - The struct ByteTagListData structure which contains the tag byte buffer
  *     is shared and, thus, reference-counted. This data structure is unshared
@@ -54,6 +54,11 @@ struct ByteTagListData;
  *     Whenever the origin of the offset changes, the Packet adjusts all
  *     byte tags using ByteTagList::Adjust method.
  *
+ *   - The smallest start and largest end offsets of the tags are kept,
+ *     so that iterating over a range of bytes which none of the tags
+ *     may overlap, such as a fragment or a header without byte tags,
+ *     does not walk the buffer.
+ *
  *   - When packet is reduced in size, byte tags that span outside the packet
  *     boundaries remain in ByteTagList. It is not a problem as iterator fixes
  *     the boundaries before returning item. However, when packet is extending,
@@ -62,4 +62,11 @@ Channel::GetId (void) const
   return m_id;
 }
 
+bool
+Channel::SetCrossThread (bool crossThread)
+{
+  NS_LOG_FUNCTION (this << crossThread);
+  return false;
+}
+
 } // namespace ns3
@@ -74,6 +74,22 @@ public:
    */
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const = 0;
 
+  /**
+   * \brief Let the channel deliver packets to NetDevices run by other
+   * threads, or not.
+   *
+   * Parallel simulators call this before the simulation starts, with
+   * \c true for the channels linking nodes simulated by different
+   * threads. Such a channel must hand receivers a Packet::DeepCopy, and
+   * must not take or release references to the receivers' objects from
+   * the sender's thread, since reference counts are not atomic.
+   *
+   * \param [in] crossThread Whether receivers may be run by other threads.
+   * \returns true if the channel supports it. The default
+   * implementation does not.
+   */
+  virtual bool SetCrossThread (bool crossThread);
+
 private:
   uint32_t m_id; //!< Channel id for this channel
 };
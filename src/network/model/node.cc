@@ -31,12 +31,14 @@
 #include "ns3/assert.h"
 #include "ns3/global-value.h"
 #include "ns3/boolean.h"
+#include "ns3/rollback.h"
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("Node");
 
 NS_OBJECT_ENSURE_REGISTERED (Node);
+NS_ROLLBACK_SUPPORTED (Node);
 
 /**
  * \brief A global switch to enable all checksums for all protocols.
@@ -17,9 +17,12 @@
  *
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
+#include <algorithm>
 #include <utility>
 #include <list>
+#include <new>
 #include "ns3/assert.h"
+#include "ns3/block-pool.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
 #include "packet-metadata.h"
@@ -33,6 +36,7 @@ NS_LOG_COMPONENT_DEFINE ("PacketMetadata");
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
+bool PacketMetadata::m_enableJournal = false;
 bool PacketMetadata::m_metadataSkipped = false;
 uint32_t PacketMetadata::m_maxSize = 0;
 uint16_t PacketMetadata::m_chunkUid = 0;
@@ -70,6 +74,14 @@ PacketMetadata::EnableChecking (void)
   m_enableChecking = true;
 }
 
+void 
+PacketMetadata::EnableJournal (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  Enable ();
+  m_enableJournal = true;
+}
+
 void
 PacketMetadata::ReserveCopy (uint32_t size)
 {
@@ -639,11 +651,134 @@ PacketMetadata::Deallocate (struct PacketMetadata::Data *data)
   delete [] buf;
 }
 
+struct PacketMetadata::Journal *
+PacketMetadata::CreateJournal (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  void *buf = BlockPool::Allocate (sizeof (struct Journal));
+  struct PacketMetadata::Journal *journal = new (buf) Journal;
+  journal->m_count = 1;
+  journal->m_dirtyEnd = 0;
+  return journal;
+}
+void
+PacketMetadata::RecycleJournal (struct PacketMetadata::Journal *journal)
+{
+  NS_LOG_FUNCTION (journal);
+  NS_ASSERT (journal->m_count > 0);
+  journal->m_count--;
+  if (journal->m_count == 0)
+    {
+      journal->~Journal ();
+      BlockPool::Deallocate (journal, sizeof (struct Journal));
+    }
+}
+
+void
+PacketMetadata::Record (enum JournalOp op, uint32_t typeUid, uint32_t size, uint16_t chunkUid)
+{
+  NS_LOG_FUNCTION (this << op << typeUid << size << chunkUid);
+  if (m_journalUsed == PACKET_METADATA_JOURNAL_SIZE)
+    {
+      Compact ();
+    }
+  if (m_journal == 0)
+    {
+      m_journal = CreateJournal ();
+    }
+  else if (m_journal->m_dirtyEnd != m_journalUsed)
+    {
+      // another packet has recorded past our last entry
+      struct PacketMetadata::Journal *journal = CreateJournal ();
+      std::copy (m_journal->m_entries, m_journal->m_entries + m_journalUsed,
+                 journal->m_entries);
+      RecycleJournal (m_journal);
+      m_journal = journal;
+    }
+  struct PacketMetadata::JournalEntry &entry = m_journal->m_entries[m_journalUsed];
+  entry.typeUid = typeUid;
+  entry.size = size;
+  entry.chunkUid = chunkUid;
+  entry.op = op;
+  m_journalUsed++;
+  m_journal->m_dirtyEnd = m_journalUsed;
+}
+bool
+PacketMetadata::Cancel (enum JournalOp op, uint32_t typeUid, uint32_t size)
+{
+  NS_LOG_FUNCTION (this << op << typeUid << size);
+  NS_ASSERT (m_journalUsed > 0);
+  const struct PacketMetadata::JournalEntry &entry = m_journal->m_entries[m_journalUsed - 1];
+  if (entry.op != op || entry.typeUid != typeUid || entry.size != size)
+    {
+      return false;
+    }
+  m_journalUsed--;
+  if (m_journalUsed == 0)
+    {
+      RecycleJournal (m_journal);
+      m_journal = 0;
+    }
+  else if (m_journal->m_count == 1)
+    {
+      // nobody else can see the dropped entry
+      m_journal->m_dirtyEnd = m_journalUsed;
+    }
+  return true;
+}
+void
+PacketMetadata::Compact (void) const
+{
+  if (m_journal == 0)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this << m_journalUsed);
+  // the items change, not the packet they describe
+  PacketMetadata *self = const_cast<PacketMetadata *> (this);
+  struct PacketMetadata::Journal *journal = m_journal;
+  uint16_t used = m_journalUsed;
+  self->m_journal = 0;
+  self->m_journalUsed = 0;
+  for (uint16_t i = 0; i < used; i++)
+    {
+      const struct PacketMetadata::JournalEntry &entry = journal->m_entries[i];
+      switch (entry.op)
+        {
+        case JOURNAL_ADD_HEADER:
+          self->DoAddHeader (entry.typeUid, entry.size, entry.chunkUid);
+          break;
+        case JOURNAL_REMOVE_HEADER:
+          self->DoRemoveHeader (entry.typeUid, entry.size);
+          break;
+        case JOURNAL_ADD_TRAILER:
+          self->DoAddTrailer (entry.typeUid, entry.size, entry.chunkUid);
+          break;
+        case JOURNAL_REMOVE_TRAILER:
+          self->DoRemoveTrailer (entry.typeUid, entry.size);
+          break;
+        case JOURNAL_REMOVE_AT_START:
+          self->DoRemoveAtStart (entry.size);
+          break;
+        case JOURNAL_REMOVE_AT_END:
+          self->DoRemoveAtEnd (entry.size);
+          break;
+        default:
+          NS_ASSERT (false);
+          break;
+        }
+    }
+  RecycleJournal (journal);
+  NS_ASSERT (IsStateOk ());
+}
+
 
 PacketMetadata 
 PacketMetadata::CreateFragment (uint32_t start, uint32_t end) const
 {
   NS_LOG_FUNCTION (this << start << end);
+  // build the items shared by all the fragments only once
+  Compact ();
   PacketMetadata fragment = *this;
   fragment.RemoveAtStart (start);
   fragment.RemoveAtEnd (end);
@@ -656,6 +791,12 @@ PacketMetadata::AddHeader (const Header &header, uint32_t size)
   NS_LOG_FUNCTION (this << &header << size);
   NS_ASSERT (IsStateOk ());
   uint32_t uid = header.GetInstanceTypeId ().GetUid () << 1;
+  if (m_enableJournal)
+    {
+      Record (JOURNAL_ADD_HEADER, uid, size, m_chunkUid);
+      m_chunkUid++;
+      return;
+    }
   DoAddHeader (uid, size);
   NS_ASSERT (IsStateOk ());
 }
@@ -668,14 +809,18 @@ PacketMetadata::DoAddHeader (uint32_t uid, uint32_t size)
       m_metadataSkipped = true;
       return;
     }
-
+  DoAddHeader (uid, size, m_chunkUid);
+  m_chunkUid++;
+}
+void
+PacketMetadata::DoAddHeader (uint32_t uid, uint32_t size, uint16_t chunkUid)
+{
   struct PacketMetadata::SmallItem item;
   item.next = m_head;
   item.prev = 0xffff;
   item.typeUid = uid;
   item.size = size;
-  item.chunkUid = m_chunkUid;
-  m_chunkUid++;
+  item.chunkUid = chunkUid;
   uint16_t written = AddSmall (&item);
   UpdateHead (written);
 }
@@ -690,6 +835,19 @@ PacketMetadata::RemoveHeader (const Header &header, uint32_t size)
       m_metadataSkipped = true;
       return;
     }
+  if (m_journalUsed > 0)
+    {
+      if (!Cancel (JOURNAL_ADD_HEADER, uid, size))
+        {
+          Record (JOURNAL_REMOVE_HEADER, uid, size, 0);
+        }
+      return;
+    }
+  DoRemoveHeader (uid, size);
+}
+void
+PacketMetadata::DoRemoveHeader (uint32_t uid, uint32_t size)
+{
   struct PacketMetadata::SmallItem item;
   struct PacketMetadata::ExtraItem extraItem;
   uint32_t read = ReadItems (m_head, &item, &extraItem);
@@ -738,16 +896,27 @@ PacketMetadata::AddTrailer (const Trailer &trailer, uint32_t size)
       m_metadataSkipped = true;
       return;
     }
+  if (m_enableJournal)
+    {
+      Record (JOURNAL_ADD_TRAILER, uid, size, m_chunkUid);
+      m_chunkUid++;
+      return;
+    }
+  DoAddTrailer (uid, size, m_chunkUid);
+  m_chunkUid++;
+  NS_ASSERT (IsStateOk ());
+}
+void
+PacketMetadata::DoAddTrailer (uint32_t uid, uint32_t size, uint16_t chunkUid)
+{
   struct PacketMetadata::SmallItem item;
   item.next = 0xffff;
   item.prev = m_tail;
   item.typeUid = uid;
   item.size = size;
-  item.chunkUid = m_chunkUid;
-  m_chunkUid++;
+  item.chunkUid = chunkUid;
   uint16_t written = AddSmall (&item);
   UpdateTail (written);
-  NS_ASSERT (IsStateOk ());
 }
 void 
 PacketMetadata::RemoveTrailer (const Trailer &trailer, uint32_t size)
@@ -760,6 +929,19 @@ PacketMetadata::RemoveTrailer (const Trailer &trailer, uint32_t size)
       m_metadataSkipped = true;
       return;
     }
+  if (m_journalUsed > 0)
+    {
+      if (!Cancel (JOURNAL_ADD_TRAILER, uid, size))
+        {
+          Record (JOURNAL_REMOVE_TRAILER, uid, size, 0);
+        }
+      return;
+    }
+  DoRemoveTrailer (uid, size);
+}
+void
+PacketMetadata::DoRemoveTrailer (uint32_t uid, uint32_t size)
+{
   struct PacketMetadata::SmallItem item;
   struct PacketMetadata::ExtraItem extraItem;
   uint32_t read = ReadItems (m_tail, &item, &extraItem);
@@ -807,6 +989,8 @@ PacketMetadata::AddAtEnd (PacketMetadata const&o)
       m_metadataSkipped = true;
       return;
     }
+  Compact ();
+  o.Compact ();
   if (m_tail == 0xffff)
     {
       // We have no items so 'AddAtEnd' is 
@@ -895,6 +1079,19 @@ PacketMetadata::RemoveAtStart (uint32_t start)
       m_metadataSkipped = true;
       return;
     }
+  if (m_enableJournal)
+    {
+      if (start > 0)
+        {
+          Record (JOURNAL_REMOVE_AT_START, 0, start, 0);
+        }
+      return;
+    }
+  DoRemoveAtStart (start);
+}
+void 
+PacketMetadata::DoRemoveAtStart (uint32_t start)
+{
   NS_ASSERT (m_data != 0);
   uint32_t leftToRemove = start;
   uint16_t current = m_head;
@@ -958,6 +1155,19 @@ PacketMetadata::RemoveAtEnd (uint32_t end)
       m_metadataSkipped = true;
       return;
     }
+  if (m_enableJournal)
+    {
+      if (end > 0)
+        {
+          Record (JOURNAL_REMOVE_AT_END, 0, end, 0);
+        }
+      return;
+    }
+  DoRemoveAtEnd (end);
+}
+void 
+PacketMetadata::DoRemoveAtEnd (uint32_t end)
+{
   NS_ASSERT (m_data != 0);
 
   uint32_t leftToRemove = end;
@@ -1046,6 +1256,7 @@ PacketMetadata::ItemIterator
 PacketMetadata::BeginItem (Buffer buffer) const
 {
   NS_LOG_FUNCTION (this << &buffer);
+  Compact ();
   return ItemIterator (this, buffer);
 }
 PacketMetadata::ItemIterator::ItemIterator (const PacketMetadata *metadata, Buffer buffer)
@@ -1133,6 +1344,7 @@ uint32_t
 PacketMetadata::GetSerializedSize (void) const
 {
   NS_LOG_FUNCTION (this);
+  Compact ();
   uint32_t totalSize = 0;
 
   // add 8 bytes for the packet uid
@@ -1178,6 +1390,7 @@ uint32_t
 PacketMetadata::Serialize (uint8_t* buffer, uint32_t maxSize) const
 {
   NS_LOG_FUNCTION (this << &buffer << maxSize);
+  Compact ();
   uint8_t* start = buffer;
 
   buffer = AddToRawU64 (m_packetUid, start, buffer, maxSize);
@@ -1279,6 +1492,12 @@ uint32_t
 PacketMetadata::Deserialize (const uint8_t* buffer, uint32_t size)
 {
   NS_LOG_FUNCTION (this << &buffer << size);
+  if (m_journal != 0)
+    {
+      RecycleJournal (m_journal);
+      m_journal = 0;
+      m_journalUsed = 0;
+    }
   const uint8_t* start = buffer;
   uint32_t desSize = size - 4;
 
@@ -74,6 +74,20 @@ class Trailer;
  * integers, and some others as variable-size 32-bit integers.
  * The variable-size 32 bit integers are stored using the uleb128
  * encoding.
+ *
+ * Encoding the items as they are added, and re-encoding whole lists
+ * when a packet is fragmented, is a significant part of the cost of
+ * packets when printing is enabled. With EnableJournal, the headers and
+ * trailers added and removed, and the bytes removed at either end,
+ * are instead recorded in a small journal of fixed-size entries
+ * (struct PacketMetadata::JournalEntry), which is shared and
+ * reference-counted like the item list. Removing the header or trailer
+ * recorded by the last entry just drops that entry, which is the common
+ * case of a receiver removing the headers added by the sender. The
+ * journal is applied to the item list, in one batch, only when it is
+ * full, when the items are needed (BeginItem, Serialize and
+ * GetSerializedSize), and before AddAtEnd and CreateFragment, so that
+ * the items shared by several packets are built only once.
  */
 class PacketMetadata 
 {
@@ -160,6 +174,11 @@ private:
    * \brief Enable the packet metadata checking
    */
   static void EnableChecking (void);
+  /**
+   * \brief Enable the packet metadata, recording the operations
+   * in a journal which is only applied when the items are needed
+   */
+  static void EnableJournal (void);
 
   /**
    * \brief Constructor
@@ -494,6 +513,51 @@ private:
     uint64_t packetUid;
   };
 
+  /**
+   * the number of entries of PacketMetadata::Journal::m_entries
+   */
+#define PACKET_METADATA_JOURNAL_SIZE 16
+
+  /**
+   * \brief Operations recorded in the journal
+   */
+  enum JournalOp {
+    JOURNAL_ADD_HEADER,       //!< AddHeader
+    JOURNAL_REMOVE_HEADER,    //!< RemoveHeader
+    JOURNAL_ADD_TRAILER,      //!< AddTrailer
+    JOURNAL_REMOVE_TRAILER,   //!< RemoveTrailer
+    JOURNAL_REMOVE_AT_START,  //!< RemoveAtStart
+    JOURNAL_REMOVE_AT_END     //!< RemoveAtEnd
+  };
+
+  /**
+   * \brief An operation recorded in the journal
+   */
+  struct JournalEntry {
+    /** the typeUid of the header or trailer, as in SmallItem */
+    uint32_t typeUid;
+    /** the size of the header or trailer, or the number of
+       bytes removed */
+    uint32_t size;
+    /** the chunkUid given to the header or trailer added */
+    uint16_t chunkUid;
+    /** the operation, a JournalOp */
+    uint8_t op;
+  };
+
+  /**
+   * \brief Journal of the operations not yet applied to the items
+   */
+  struct Journal {
+    /** number of references to this struct Journal instance. */
+    uint32_t m_count;
+    /** max of the m_journalUsed field over all objects which
+     * reference this struct Journal instance */
+    uint16_t m_dirtyEnd;
+    /** the recorded operations, the oldest first */
+    struct JournalEntry m_entries[PACKET_METADATA_JOURNAL_SIZE];
+  };
+
   /**
    * \brief Class to hold all the metadata
    */
@@ -620,6 +684,66 @@ public:
    * \param size header serialized size
    */
   void DoAddHeader (uint32_t uid, uint32_t size);
+  /**
+   * \brief Add an header
+   * \param uid header's uid to add
+   * \param size header serialized size
+   * \param chunkUid header's chunk uid
+   */
+  void DoAddHeader (uint32_t uid, uint32_t size, uint16_t chunkUid);
+  /**
+   * \brief Remove an header
+   * \param uid header's uid to remove
+   * \param size header serialized size
+   */
+  void DoRemoveHeader (uint32_t uid, uint32_t size);
+  /**
+   * \brief Add a trailer
+   * \param uid trailer's uid to add
+   * \param size trailer serialized size
+   * \param chunkUid trailer's chunk uid
+   */
+  void DoAddTrailer (uint32_t uid, uint32_t size, uint16_t chunkUid);
+  /**
+   * \brief Remove a trailer
+   * \param uid trailer's uid to remove
+   * \param size trailer serialized size
+   */
+  void DoRemoveTrailer (uint32_t uid, uint32_t size);
+  /**
+   * \brief Remove a chunk of metadata at the metadata start
+   * \param start the size of metadata to remove
+   */
+  void DoRemoveAtStart (uint32_t start);
+  /**
+   * \brief Remove a chunk of metadata at the metadata end
+   * \param end the size of metadata to remove
+   */
+  void DoRemoveAtEnd (uint32_t end);
+
+  /**
+   * \brief Record an operation in the journal, applying the journal
+   * first if it is full
+   * \param op the operation
+   * \param typeUid the typeUid of the header or trailer
+   * \param size the size of the header or trailer, or of the
+   *        metadata removed
+   * \param chunkUid the chunkUid of the header or trailer added
+   */
+  void Record (enum JournalOp op, uint32_t typeUid, uint32_t size, uint16_t chunkUid);
+  /**
+   * \brief Drop the last entry of the journal if it records the
+   * addition of the header or trailer being removed
+   * \param op the operation which added the header or trailer
+   * \param typeUid the typeUid of the header or trailer
+   * \param size the size of the header or trailer
+   * \returns true if the entry was dropped
+   */
+  bool Cancel (enum JournalOp op, uint32_t typeUid, uint32_t size);
+  /**
+   * \brief Apply the journal to the items, and release it
+   */
+  void Compact (void) const;
   /**
    * \brief Check if the metadata state is ok
    * \returns true if the internal state is ok
@@ -660,10 +784,22 @@ public:
    * \param data the buffer data storage
    */
   static void Deallocate (struct PacketMetadata::Data *data);
+  /**
+   * \brief Allocate an empty journal
+   * \returns a pointer to the journal
+   */
+  static struct PacketMetadata::Journal *CreateJournal (void);
+  /**
+   * \brief Release a reference to a journal, freeing it if it was
+   * the last one
+   * \param journal the journal
+   */
+  static void RecycleJournal (struct PacketMetadata::Journal *journal);
 
   static DataFreeList m_freeList; //!< the metadata data storage
   static bool m_enable; //!< Enable the packet metadata
   static bool m_enableChecking; //!< Enable the packet metadata checking
+  static bool m_enableJournal; //!< Enable the packet metadata journal
 
   /**
    * Set to true when adding metadata to a packet is skipped because
@@ -685,6 +821,8 @@ public:
   uint16_t m_tail; //!< list tail
   uint16_t m_used; //!< used portion
   uint64_t m_packetUid; //!< packet Uid
+  struct Journal *m_journal; //!< Operations not yet applied, or 0
+  uint16_t m_journalUsed; //!< number of entries of m_journal in use
 };
 
 } // namespace ns3
@@ -696,7 +834,9 @@ PacketMetadata::PacketMetadata (uint64_t uid, uint32_t size)
     m_head (0xffff),
     m_tail (0xffff),
     m_used (0),
-    m_packetUid (uid)
+    m_packetUid (uid),
+    m_journal (0),
+    m_journalUsed (0)
 {
   memset (m_data->m_data, 0xff, 4);
   if (size > 0)
@@ -709,11 +849,17 @@ PacketMetadata::PacketMetadata (PacketMetadata const &o)
     m_head (o.m_head),
     m_tail (o.m_tail),
     m_used (o.m_used),
-    m_packetUid (o.m_packetUid)
+    m_packetUid (o.m_packetUid),
+    m_journal (o.m_journal),
+    m_journalUsed (o.m_journalUsed)
 {
   NS_ASSERT (m_data != 0);
   NS_ASSERT (m_data->m_count < std::numeric_limits<uint32_t>::max());
   m_data->m_count++;
+  if (m_journal != 0)
+    {
+      m_journal->m_count++;
+    }
 }
 PacketMetadata &
 PacketMetadata::operator = (PacketMetadata const& o)
@@ -735,6 +881,19 @@ PacketMetadata::operator = (PacketMetadata const& o)
   m_tail = o.m_tail;
   m_used = o.m_used;
   m_packetUid = o.m_packetUid;
+  if (m_journal != o.m_journal)
+    {
+      if (o.m_journal != 0)
+        {
+          o.m_journal->m_count++;
+        }
+      if (m_journal != 0)
+        {
+          PacketMetadata::RecycleJournal (m_journal);
+        }
+      m_journal = o.m_journal;
+    }
+  m_journalUsed = o.m_journalUsed;
   return *this;
 }
 PacketMetadata::~PacketMetadata ()
@@ -745,6 +904,10 @@ PacketMetadata::~PacketMetadata ()
     {
       PacketMetadata::Recycle (m_data);
     }
+  if (m_journal != 0)
+    {
+      PacketMetadata::RecycleJournal (m_journal);
+    }
 }
 
 } // namespace ns3
@@ -20,285 +20,272 @@
 
 /**
 \file   packet-tag-list.cc
-\brief  Implements a linked list of Packet tags, including copy-on-write semantics.
+\brief  Implements a copy-on-write array of Packet tags.
 */
 
 #include "packet-tag-list.h"
 #include "tag-buffer.h"
 #include "tag.h"
+#include "ns3/block-pool.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <new>
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PacketTagList");
 
-PacketTagList::TagData *
-PacketTagList::CreateTagData (size_t dataSize)
-{
-  NS_ASSERT_MSG (dataSize
-                 < std::numeric_limits<decltype(TagData::size)>::max (),
-                 "Requested TagData size " << dataSize
-                 << " exceeds maximum "
-                 << std::numeric_limits<decltype(TagData::size)>::max () );
+namespace {
 
-  void * p = std::malloc (sizeof (TagData) + dataSize - 1);
-  // The matching frees are in RemoveAll and RemoveWriter
+/** Room for tags in the first Block of a list. */
+const uint32_t INITIAL_CAPACITY = 4;
+/** Room for serialized tags, in bytes, in the first Block of a list. */
+const uint32_t INITIAL_DATA_CAPACITY = 64;
 
-  TagData * tag = new (p) TagData;
-  tag->size = dataSize;
-  return tag;
-}
+} // unnamed namespace
 
-bool
-PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
+uint64_t
+PacketTagList::GetFilterBit (TypeId tid)
 {
-  TypeId tid = tag.GetInstanceTypeId ();
-  NS_LOG_FUNCTION (this << tid);
-  NS_LOG_INFO     ("looking for " << tid);
+  return (uint64_t) 1 << (tid.GetUid () % 64);
+}
 
-  // trivial case when list is empty
-  if (m_next == 0)
+struct PacketTagList::Block *
+PacketTagList::Allocate (uint32_t capacity, uint32_t dataCapacity)
+{
+  NS_ASSERT (capacity > 0);
+  // The matching deallocation is in Release
+  void * p = BlockPool::Allocate (offsetof (Block, tags)
+                                  + capacity * sizeof (TagData) + dataCapacity);
+  struct Block * block = new (p) Block;
+  for (uint32_t i = 1; i < capacity; i++)
     {
-      return false;
+      new (&block->tags[i]) TagData;
     }
+  block->filter = 0;
+  block->count = 1;
+  block->size = 0;
+  block->capacity = capacity;
+  block->used = 0;
+  block->dataCapacity = dataCapacity;
+  return block;
+}
 
-  bool found = false;
+void
+PacketTagList::Release (struct Block *block)
+{
+  NS_ASSERT (block->count > 0);
+  block->count--;
+  if (block->count == 0)
+    {
+      std::size_t size = offsetof (Block, tags)
+        + block->capacity * sizeof (TagData) + block->dataCapacity;
+      block->~Block ();
+      BlockPool::Deallocate (block, size);
+    }
+}
 
-  struct TagData ** prevNext = &m_next; // previous node's next pointer
-  struct TagData  * cur      =  m_next; // cursor to current node
-  struct TagData  * it = 0;             // utility
+uint8_t *
+PacketTagList::GetBlockData (const struct Block *block)
+{
+  return (uint8_t *)(block->tags + block->capacity);
+}
 
-  // Search from the head of the list until we find tid or a merge
-  while (cur != 0)
+struct PacketTagList::Block *
+PacketTagList::Unshare (uint32_t tags, uint32_t bytes)
+{
+  NS_LOG_FUNCTION (this << tags << bytes);
+  struct Block * block = m_block;
+  if (block != 0 && block->count == 1
+      && block->size + tags <= block->capacity
+      && block->used + bytes <= block->dataCapacity)
     {
-      if (cur->count > 1)
-        {
-          // found merge
-          NS_LOG_INFO ("found initial merge before tid");
-          break;
-        }
-      else if (cur->tid == tid)
-        {
-          NS_LOG_INFO ("found tid before initial merge, calling writer");
-          found = (this->*Writer)(tag, true, cur, prevNext);
-          break;
-        }
-      else
-        {
-          // no merge or tid found yet, move on
-          prevNext = &cur->next;
-          cur      =  cur->next;
-        }
-    }  // while !found && !cow
+      return block;
+    }
 
-  // did we find it or run out of tags?
-  if (cur == 0 || found)
+  // copy the block, doubling it if it is too small
+  uint32_t capacity = INITIAL_CAPACITY;
+  uint32_t dataCapacity = INITIAL_DATA_CAPACITY;
+  uint32_t size = tags;
+  uint32_t used = bytes;
+  if (block != 0)
     {
-      NS_LOG_INFO ("returning after header with found: " << found);
-      return found;
+      capacity = block->capacity;
+      dataCapacity = block->dataCapacity;
+      size += block->size;
+      used += block->used;
     }
-
-  // From here on out, we have to copy the list
-  // until we find tid, then link past it
-
-  // Before we do all that work, let's make sure tid really exists
-  for (it = cur; it != 0; it = it->next)
+  if (size > capacity)
     {
-      if (it->tid == tid)
-        {
-          break;
-        }
+      capacity = std::max (size, 2 * capacity);
     }
-  if (it == 0)
+  if (used > dataCapacity)
     {
-      // got to end of list without finding tid
-      NS_LOG_INFO ("tid not found after first merge");
-      return found;
+      dataCapacity = std::max (used, 2 * dataCapacity);
     }
-
-  // At this point cur is a merge, but untested for tid
-  NS_ASSERT (cur != 0);
-  NS_ASSERT (cur->count > 1);
-
-  /*
-     Walk the remainder of the list, copying, until we find tid
-     As we put a copy of the cur node onto our list,
-     we move the merge point down the list.
-
-     Starting position                  End position
-       T1 is a merge                     T1.count decremented
-                                         T2 is a merge
-                                         T1' is a copy of T1
-
-          other                             other
-               \                                 \
-      Prev  ->  T1  ->  T2  -> ...                T1  ->  T2  -> ...
-           /   /                                         /|
-      pNext cur                         Prev  ->  T1' --/ |
-                                                     /    |
-                                                pNext   cur
-
-     When we reach tid, we link past it, decrement count, and we're done.
-  */
-
-  // Should normally check for null cur pointer,
-  // but since we know tid exists, we'll skip this test
-  while ( /* cur && */ cur->tid != tid)
+  struct Block * copy = Allocate (capacity, dataCapacity);
+  if (block != 0)
     {
-      NS_ASSERT (cur != 0);
-      NS_ASSERT (cur->count > 1);
-      cur->count--;                       // unmerge cur
-      struct TagData * copy = CreateTagData (cur->size);
-      copy->tid = cur->tid;
-      copy->count = 1;
-      copy->size = cur->size;
-      memcpy (copy->data, cur->data, copy->size);
-      copy->next = cur->next;             // merge into tail
-      copy->next->count++;                // mark new merge
-      *prevNext = copy;                   // point prior list at copy
-      prevNext = &copy->next;             // advance
-      cur      =  copy->next;
+      NS_LOG_INFO ("copying " << block->size << " tags");
+      copy->filter = block->filter;
+      copy->size = block->size;
+      copy->used = block->used;
+      std::copy (block->tags, block->tags + block->size, copy->tags);
+      std::memcpy (GetBlockData (copy), GetBlockData (block), block->used);
+      Release (block);
     }
-  // Sanity check:
-  NS_ASSERT (cur != 0);                 // cur should be non-zero
-  NS_ASSERT (cur->tid == tid);          // cur->tid should be tid
-  NS_ASSERT (cur->count > 1);           // cur should be a merge
-
-  // link around tid, removing it from our list
-  found = (this->*Writer)(tag, false, cur, prevNext);
-  return found;
-
+  m_block = copy;
+  return copy;
 }
 
-bool
-PacketTagList::Remove (Tag & tag)
+int32_t
+PacketTagList::Find (TypeId tid) const
 {
-  return COWTraverse (tag, &PacketTagList::RemoveWriter);
+  if (m_block == 0 || (m_block->filter & GetFilterBit (tid)) == 0)
+    {
+      return -1;
+    }
+  for (int32_t i = m_block->size - 1; i >= 0; i--)
+    {
+      if (m_block->tags[i].tid == tid)
+        {
+          return i;
+        }
+    }
+  return -1;
 }
 
-// COWWriter implementing Remove
-bool
-PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
-                             struct PacketTagList::TagData  * cur,
-                             struct PacketTagList::TagData ** prevNext)
+void
+PacketTagList::Erase (uint32_t index)
 {
-  NS_LOG_FUNCTION_NOARGS ();
-
-  // found tid
-  bool found = true;
-  tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
-  *prevNext = cur->next;            // link around cur
-
-  if (preMerge)
+  NS_LOG_FUNCTION (this << index);
+  NS_ASSERT (m_block != 0 && m_block->count == 1);
+  NS_ASSERT (index < m_block->size);
+  struct TagData removed = m_block->tags[index];
+
+  // close the gap in the data, and in the entries
+  uint8_t * data = GetBlockData (m_block);
+  std::memmove (data + removed.offset, data + removed.offset + removed.size,
+                m_block->used - removed.offset - removed.size);
+  m_block->used -= removed.size;
+  std::copy (m_block->tags + index + 1, m_block->tags + m_block->size,
+             m_block->tags + index);
+  m_block->size--;
+
+  m_block->filter = 0;
+  for (uint32_t i = 0; i < m_block->size; i++)
     {
-      // found tid before first merge, so delete cur
-      cur->~TagData ();
-      std::free (cur);
-    }
-  else
-    {
-      // cur is always a merge at this point
-      // unmerge cur, since we linked around it already
-      cur->count--;
-      if (cur->next != 0)
+      struct TagData &tag = m_block->tags[i];
+      if (tag.offset > removed.offset)
         {
-          // there's a next, so make it a merge
-          cur->next->count++;
+          tag.offset -= removed.size;
         }
+      m_block->filter |= GetFilterBit (tag.tid);
     }
-  return found;
 }
 
 bool
-PacketTagList::Replace (Tag & tag)
+PacketTagList::Remove (Tag & tag)
 {
-  bool found = COWTraverse (tag, &PacketTagList::ReplaceWriter);
-  if (!found)
+  TypeId tid = tag.GetInstanceTypeId ();
+  NS_LOG_FUNCTION (this << tid);
+  int32_t index = Find (tid);
+  if (index < 0)
     {
-      Add (tag);
+      return false;
     }
-  return found;
+  const struct TagData &cur = m_block->tags[index];
+  uint8_t * data = GetBlockData (m_block) + cur.offset;
+  tag.Deserialize (TagBuffer (data, data + cur.size));
+  if (m_block->count > 1 && m_block->size == 1)
+    {
+      // no need to copy a shared block just to empty it
+      RemoveAll ();
+      return true;
+    }
+  Unshare (0, 0);
+  Erase (index);
+  return true;
 }
 
-// COWWriter implementing Replace
 bool
-PacketTagList::ReplaceWriter (Tag & tag, bool preMerge,
-                              struct PacketTagList::TagData  * cur,
-                              struct PacketTagList::TagData ** prevNext)
+PacketTagList::Replace (Tag & tag)
 {
-  NS_LOG_FUNCTION_NOARGS ();
-
-  // found tid
-  bool found = true;
-  if (preMerge)
+  TypeId tid = tag.GetInstanceTypeId ();
+  NS_LOG_FUNCTION (this << tid);
+  int32_t index = Find (tid);
+  if (index < 0)
     {
-      // found tid before first merge, so just rewrite
-      tag.Serialize (TagBuffer (cur->data, cur->data + cur->size));
+      Add (tag);
+      return false;
     }
-  else
+  uint32_t size = tag.GetSerializedSize ();
+  struct Block * block = Unshare (0, 0);
+  const struct TagData &cur = block->tags[index];
+  if (cur.size == size)
     {
-      // cur is always a merge at this point
-      // need to copy, replace, and link past cur
-      cur->count--;                     // unmerge cur
-      struct TagData * copy = CreateTagData (tag.GetSerializedSize ());
-      copy->tid = tag.GetInstanceTypeId ();
-      copy->count = 1;
-      tag.Serialize (TagBuffer (copy->data, copy->data + copy->size));
-      copy->next = cur->next;           // merge into tail
-      if (copy->next != 0)
-        {
-          copy->next->count++;          // mark new merge
-        }
-      *prevNext = copy;                 // point prior list at copy
+      // just rewrite
+      uint8_t * data = GetBlockData (block) + cur.offset;
+      tag.Serialize (TagBuffer (data, data + size));
+      return true;
     }
-  return found;
+  Erase (index);
+  Add (tag);
+  return true;
 }
 
 void 
 PacketTagList::Add (const Tag &tag) const
 {
-  NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ());
+  TypeId tid = tag.GetInstanceTypeId ();
+  NS_LOG_FUNCTION (this << tid);
   // ensure this id was not yet added
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next) 
-    {
-      NS_ASSERT_MSG (cur->tid != tag.GetInstanceTypeId (),
-                     "Error: cannot add the same kind of tag twice.");
-    }
-  struct TagData * head = CreateTagData (tag.GetSerializedSize ());
-  head->count = 1;
-  head->next = 0;
-  head->tid = tag.GetInstanceTypeId ();
-  head->next = m_next;
-  tag.Serialize (TagBuffer (head->data, head->data + head->size));
-
-  const_cast<PacketTagList *> (this)->m_next = head;
+  NS_ASSERT_MSG (Find (tid) < 0, "Error: cannot add the same kind of tag twice.");
+  uint32_t size = tag.GetSerializedSize ();
+  struct Block * block = const_cast<PacketTagList *> (this)->Unshare (1, size);
+
+  struct TagData &cur = block->tags[block->size];
+  cur.tid = tid;
+  cur.size = size;
+  cur.offset = block->used;
+  uint8_t * data = GetBlockData (block) + cur.offset;
+  tag.Serialize (TagBuffer (data, data + size));
+  block->size++;
+  block->used += size;
+  block->filter |= GetFilterBit (tid);
 }
 
 bool
 PacketTagList::Peek (Tag &tag) const
 {
-  NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ());
   TypeId tid = tag.GetInstanceTypeId ();
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next) 
+  NS_LOG_FUNCTION (this << tid);
+  int32_t index = Find (tid);
+  if (index < 0)
     {
-      if (cur->tid == tid) 
-        {
-          /* found tag */
-          tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
-          return true;
-        }
+      /* no tag found */
+      return false;
     }
-  /* no tag found */
-  return false;
+  const struct TagData &cur = m_block->tags[index];
+  uint8_t * data = GetBlockData (m_block) + cur.offset;
+  tag.Deserialize (TagBuffer (data, data + cur.size));
+  return true;
 }
 
-const struct PacketTagList::TagData *
-PacketTagList::Head (void) const
+const struct PacketTagList::TagData &
+PacketTagList::Get (uint32_t i) const
 {
-  return m_next;
+  NS_ASSERT (i < GetSize ());
+  return m_block->tags[m_block->size - 1 - i];
 }
 
-} /* namespace ns3 */
+const uint8_t *
+PacketTagList::GetData (const struct PacketTagList::TagData &tag) const
+{
+  return GetBlockData (m_block) + tag.offset;
+}
 
+} /* namespace ns3 */
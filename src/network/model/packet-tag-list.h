@@ -22,7 +22,7 @@
 
 /**
 \file   packet-tag-list.h
-\brief  Defines a linked list of Packet tags, including copy-on-write semantics.
+\brief  Defines a copy-on-write array of Packet tags.
 */
 
 #include <stdint.h>
@@ -43,108 +43,42 @@ class Tag;
  *
  * \internal
  *
- * The implementation of this class is a bit tricky.  Refer to this
- * diagram in the discussion that follows.
+ *   - Tags are stored in serialized form in a single block of memory:
+ *     a header, an array of TagData entries giving the type, size and
+ *     offset of each tag, then the serialized tags themselves. The
+ *     first block of a list has room for a few small tags, so a packet
+ *     usually carries all its tags in one allocation, which is grown
+ *     by doubling if needed.
  *
- * \dot
- *    digraph {
- *        rankdir = "LR";
- *        clusterrank = local;
- *        node [ shape = record, fontname="FreeSans", fontsize="10" ];
- *        oth  [ label="<l> Other branch | <n> next | <c> ..." ];
- *        PTL1 [ label="<l> PacketTagList A | <n> m_next" , shape=Mrecord];
- *        PTL2 [ label="<l> PacketTagList B | <n> m_next" , shape=Mrecord];
- *        oth:n  -> T7:l ;
- *        PTL2:n -> T6:l ;
- *        PTL1:n -> T5:l ;
- *        T1   [ label="<l> T1  | <n> next | <c> count = 1" ];
- *        T2   [ label="<l> T2  | <n> next | <c> count = 1" ];
- *        T3   [ label="<l> T3  | <n> next | <c> count = 2" ];
- *        T4   [ label="<l> T4  | <n> next | <c> count = 1" ];
- *        T5   [ label="<l> T5  | <n> next | <c> count = 2" ];
- *        T6   [ label="<l> T6  | <n> next | <c> count = 1" ];
- *        T7   [ label="<l> T7  | <n> next | <c> count = 1" ];
- *        NULL [ label="0", shape = ellipse ];
- *        subgraph cluster_list {
- *          penwidth = 0;
- *          T6:n -> T5:l ;
- *          T5:n -> T4:l ;
- *          T4:n -> T3:l ;
- *          T7:n -> T3:l ;
- *          T3:n -> T2:l ;
- *          T2:n -> T1:l ;
- *          T1:n -> NULL ;
- *        };
- *      }
- * \enddot
+ *   - The block is shared and reference-counted. The copy constructor
+ *     and assignment just share the block of the original list; the
+ *     block is copied the first time #Add, #Remove or #Replace
+ *     modifies a shared block, and modified in place otherwise.
  *
- *   - Tags are stored in serialized form in a tree of TagData
- *     structures. (<tt>T1-T7</tt> in the diagram)
+ *   - The block keeps a 64-bit filter with one bit set for the
+ *     TypeId of each tag, indexed by its uid modulo 64. #Peek and
+ *     #Remove of a tag which is not in the list, the common case, thus
+ *     return after a single test, and otherwise scan the contiguous
+ *     array of entries without following pointers.
  *
- *   - Each TagData points (\c next pointers in the diagram)
- *     toward the root of the tree, which is a null pointer.
- *
- *   - \c count is the number of incoming pointers to this
- *     TagData.  Branch points, where branches merge or join, have
- *     <tt>count \> 1</tt> (\c T3, \c T5); successive links along
- *     a branch have <tt>count = 1</tt> (\c T1, \c T2, \c T4, \c T6, \c T7).
- *
- *   - Each PacketTagList points to a specific TagData,
- *     which is the most recent Tag added to the packet. (<tt>T5-T7</tt>)
- *
- *   - Conceptually, therefore, each Packet has a PacketTagList which
- *     points to a singly-linked list of TagData.
- *
- * \par <b> Copy-on-write </b> is implemented as follows:
- *
- *   - #Add prepends the new tag to the list (growing that branch of the tree,
- *     as \c T6). This is a constant time operation, and does not affect
- *     any other #PacketTagList's, hence this is a \c const function.
- *
- *   - Copy constructor (PacketTagList(const PacketTagList & o))
- *     and assignment (#operator=(const PacketTagList & o))
- *     simply join the tree at the same place as the original
- *     PacketTagList \c o, incrementing the \c count.
- *     For assignment, the old branch is deleted, up to
- *     the first branch point, which has its \c count decremented.
- *     (PacketTagList \c B started as a copy of PacketTagList \c A,
- *     before \c T6 was added to \c B).
- *
- *   - #Remove and #Replace are a little tricky, depending on where the
- *     target tag is found relative to the first branch point:
- *     - \e Target before <em> the first branch point: </em> \n
- *       The target is just dealt with in place (linked around and deleted,
- *       in the case of #Remove; rewritten in the case of #Replace).
- *     - \e Target at or after <em> the first branch point: </em> \n
- *       The portion of the list between the first branch and the target is
- *       shared. This portion is copied before the #Remove or #Replace is
- *       performed.
+ *   - The tags are indexed from the most recently added one, as they
+ *     were when the list was a linked list.
  */
 class PacketTagList 
 {
 public:
   /**
-   * Tree node for sharing serialized tags.
-   *
-   * See PacketTagList for a discussion of the data structure.
+   * The location of a serialized tag in the list.
    *
    * \internal
-   * Unfortunately this has to be public, because
-   * PacketTagIterator::Item::GetTag() needs the data and size values.
-   * The Item nested class can't be forward declared, so friending isn't
-   * possible.
-   *
-   * We use placement new so we can allocate enough room for the Tag
-   * type which will be serialized into data.  See Object::Aggregates
-   * for a similar construction.
+   * This has to be public, because PacketTagIterator::Item::GetTag()
+   * needs it.
    */
   struct TagData
   {
-    struct TagData * next;      /**< Pointer to next in list */
-    uint32_t count;             /**< Number of incoming links */
-    TypeId tid;                 /**< Type of the tag serialized into #data */
-    uint32_t size;              /**< Size of the \c data buffer */
-    uint8_t data[1];            /**< Serialization buffer */
+    TypeId tid;                 /**< Type of the tag serialized at #offset */
+    uint32_t size;              /**< Size of the serialized tag */
+    uint32_t offset;            /**< Offset of the serialized tag in the data */
   };  /* struct TagData */
 
   /**
@@ -156,8 +90,7 @@ public:
    *
    * \param [in] o The PacketTagList to copy.
    *
-   * This makes a light-weight copy by #RemoveAll, then
-   * pointing to the same \ref TagData as \pname{o}.
+   * This makes a light-weight copy by sharing the tags of \pname{o}.
    */
   inline PacketTagList (PacketTagList const &o);
   /**
@@ -167,18 +100,18 @@ public:
    * \returns the copied object
    *
    * This makes a light-weight copy by #RemoveAll, then
-   * pointing to the same \ref TagData as \pname{o}.
+   * sharing the tags of \pname{o}.
    */
   inline PacketTagList &operator = (PacketTagList const &o);
   /**
    * Destructor
    *
-   * #RemoveAll's the tags up to the first merge.
+   * #RemoveAll's the tags.
    */
   inline ~PacketTagList ();
 
   /**
-   * Add a tag to the head of this branch.
+   * Add a tag to the list.
    *
    * \param [in] tag The tag to add
    */
@@ -210,78 +143,103 @@ public:
    */
   bool Peek (Tag &tag) const;
   /**
-   * Remove all tags from this list (up to the first merge).
+   * Remove all tags from this list.
    */
   inline void RemoveAll (void);
   /**
-   * \returns pointer to head of tag list
+   * \returns the number of tags in the list
+   */
+  inline uint32_t GetSize (void) const;
+  /**
+   * Get the location of a tag.
+   *
+   * \param [in] i The index of the tag, from 0 for the most recently
+   *          added one to GetSize() - 1.
+   * \returns The location of the tag.
+   */
+  const struct PacketTagList::TagData & Get (uint32_t i) const;
+  /**
+   * Get a serialized tag.
+   *
+   * \param [in] tag The location of the tag, as returned by Get().
+   * \returns The first byte of the serialized tag.
    */
-  const struct PacketTagList::TagData *Head (void) const;
+  const uint8_t * GetData (const struct PacketTagList::TagData &tag) const;
 
 private:
   /**
-   * Allocate and construct a TagData struct, sizing the data area
-   * large enough to serialize dataSize bytes from a Tag.
+   * The reference-counted block of memory which holds the tags.
    *
-   * \param [in] dataSize The serialized size of the Tag.
-   * \returns The newly constructed TagData object.
+   * This is followed in memory by \c capacity - 1 more TagData
+   * entries, then by \c dataCapacity bytes of serialized tags.
    */
-  static
-  TagData * CreateTagData (size_t dataSize);
-  
+  struct Block
+  {
+    uint64_t filter;            /**< Bit uid % 64 set for the TypeId of each tag */
+    uint32_t count;             /**< Number of lists sharing the block */
+    uint32_t size;              /**< Number of tags */
+    uint32_t capacity;          /**< Room for tags */
+    uint32_t used;              /**< Bytes of serialized tags */
+    uint32_t dataCapacity;      /**< Room for serialized tags, in bytes */
+    struct TagData tags[1];     /**< Tags, the oldest first */
+  };  /* struct Block */
+
+  /**
+   * Get the bit of the filter of a type of tag.
+   *
+   * \param [in] tid The type of the tag.
+   * \returns The bit of the filter.
+   */
+  static uint64_t GetFilterBit (TypeId tid);
+  /**
+   * Allocate and construct an empty Block.
+   *
+   * \param [in] capacity The room for tags.
+   * \param [in] dataCapacity The room for serialized tags, in bytes.
+   * \returns The newly constructed Block, with a count of 1.
+   */
+  static struct Block * Allocate (uint32_t capacity, uint32_t dataCapacity);
   /**
-   * Typedef of method function pointer for copy-on-write operations
+   * Release a reference to a Block, freeing it if it was the last one.
    *
-   * \param [in] tag The tag type to operate on.
-   * \param [in] preMerge True if \pname{tag} was found before the first merge,
-   *             false otherwise.
-   * \param [in] cur Pointer to the tag.
-   * \param [in] prevNext Pointer to the struct TagData.next pointer
-   *          pointing to \pname{cur}.
-   * \returns True if operation successful, false otherwise
+   * \param [in] block The Block.
    */
-  typedef bool (PacketTagList::*COWWriter)
-    (Tag       & tag, bool         preMerge,
-    struct TagData * cur, struct TagData ** prevNext);
+  static void Release (struct Block *block);
   /**
-   * Traverse the list implementing copy-on-write, using \pname{Writer}.
+   * Get the serialized tags of a Block.
    *
-   * \param [in] tag The tag type to operate on.
-   * \param [in] Writer The copy-on-write function to use.
-   * \returns True if \pname{tag} found, false otherwise.
+   * \param [in] block The Block.
+   * \returns The first byte after the array of entries.
    */
-  bool COWTraverse   (Tag & tag, PacketTagList::COWWriter Writer);
+  static uint8_t * GetBlockData (const struct Block *block);
   /**
-   * Copy-on-write implementing Remove.
+   * Make sure the list owns its Block alone, copying it if needed,
+   * and that the Block has room for more tags.
    *
-   * \param [in] tag The target tag type to remove.
-   * \param [in] preMerge True if \pname{tag} was found before the first merge,
-   *             false otherwise.
-   * \param [in] cur Pointer to the tag.
-   * \param [in] prevNext Pointer to the struct TagData.next pointer
-   *          pointing to \pname{cur}.
-   * \returns True, since tag will definitely be removed.
+   * \param [in] tags The number of tags to make room for.
+   * \param [in] bytes The number of serialized bytes to make room for.
+   * \returns The Block, which may be written.
    */
-  bool RemoveWriter  (Tag & tag, bool preMerge,
-                      struct TagData * cur, struct TagData ** prevNext);
+  struct Block * Unshare (uint32_t tags, uint32_t bytes);
   /**
-   * Copy-on-write implementing Replace
+   * Find a tag.
    *
-   * \param [in] tag The target tag type to replace
-   * \param [in] preMerge True if \pname{tag} was found before the first merge,
-   *          false otherwise.
-   * \param [in] cur Pointer to the tag
-   * \param [in] prevNext Pointer to the struct TagData.next pointer
-   *          pointing to \pname{cur}.
-   * \returns True, since tag value will definitely be replaced.
+   * \param [in] tid The type of the tag.
+   * \returns The index of the tag in Block::tags,
+   *          or -1 if there is no such tag.
    */
-  bool ReplaceWriter (Tag & tag, bool preMerge,
-                      struct TagData * cur, struct TagData ** prevNext);
+  int32_t Find (TypeId tid) const;
+  /**
+   * Remove a tag from the Block, which must be owned by this list.
+   *
+   * \param [in] index The index of the tag in Block::tags.
+   */
+  void Erase (uint32_t index);
 
   /**
-   * Pointer to first \ref TagData on the list
+   * The Block which holds the tags, or 0 if there is none.
    */
-  struct TagData *m_next;
+  struct Block *m_block;
 };
 
 } // namespace ns3
@@ -293,16 +251,16 @@ private:
 namespace ns3 {
 
 PacketTagList::PacketTagList ()
-  : m_next ()
+  : m_block (0)
 {
 }
 
 PacketTagList::PacketTagList (PacketTagList const &o)
-  : m_next (o.m_next)
+  : m_block (o.m_block)
 {
-  if (m_next != 0)
+  if (m_block != 0)
     {
-      m_next->count++;
+      m_block->count++;
     }
 }
 
@@ -310,15 +268,15 @@ PacketTagList &
 PacketTagList::operator = (PacketTagList const &o)
 {
   // self assignment
-  if (m_next == o.m_next) 
+  if (m_block == o.m_block) 
     {
       return *this;
     }
   RemoveAll ();
-  m_next = o.m_next;
-  if (m_next != 0) 
+  m_block = o.m_block;
+  if (m_block != 0) 
     {
-      m_next->count++;
+      m_block->count++;
     }
   return *this;
 }
@@ -331,27 +289,17 @@ PacketTagList::~PacketTagList ()
 void
 PacketTagList::RemoveAll (void)
 {
-  struct TagData *prev = 0;
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
-    {
-      cur->count--;
-      if (cur->count > 0) 
-        {
-          break;
-        }
-      if (prev != 0) 
-        {
-          prev->~TagData ();
-          std::free (prev);
-        }
-      prev = cur;
-    }
-  if (prev != 0) 
+  if (m_block != 0)
     {
-      prev->~TagData ();
-      std::free (prev);
+      Release (m_block);
+      m_block = 0;
     }
-  m_next = 0;
+}
+
+uint32_t
+PacketTagList::GetSize (void) const
+{
+  return m_block == 0 ? 0 : m_block->size;
 }
 
 } // namespace ns3
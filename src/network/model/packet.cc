@@ -22,13 +22,14 @@
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include <string>
+#include <vector>
 #include <cstdarg>
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("Packet");
 
-uint32_t Packet::m_globalUid = 0;
+thread_local uint32_t Packet::m_globalUid = 0;
 
 TypeId 
 ByteTagIterator::Item::GetTypeId (void) const
@@ -81,39 +82,42 @@ ByteTagIterator::ByteTagIterator (ByteTagList::Iterator i)
 }
 
 
-PacketTagIterator::PacketTagIterator (const struct PacketTagList::TagData *head)
-  : m_current (head)
+PacketTagIterator::PacketTagIterator (const PacketTagList &list)
+  : m_list (list),
+    m_current (0)
 {
 }
 bool
 PacketTagIterator::HasNext (void) const
 {
-  return m_current != 0;
+  return m_current < m_list.GetSize ();
 }
 PacketTagIterator::Item
 PacketTagIterator::Next (void)
 {
   NS_ASSERT (HasNext ());
-  const struct PacketTagList::TagData *prev = m_current;
-  m_current = m_current->next;
-  return PacketTagIterator::Item (prev);
+  const struct PacketTagList::TagData &data = m_list.Get (m_current);
+  m_current++;
+  return PacketTagIterator::Item (data.tid, m_list.GetData (data), data.size);
 }
 
-PacketTagIterator::Item::Item (const struct PacketTagList::TagData *data)
-  : m_data (data)
+PacketTagIterator::Item::Item (TypeId tid, const uint8_t *data, uint32_t size)
+  : m_tid (tid),
+    m_data (data),
+    m_size (size)
 {
 }
 TypeId
 PacketTagIterator::Item::GetTypeId (void) const
 {
-  return m_data->tid;
+  return m_tid;
 }
 void
 PacketTagIterator::Item::GetTag (Tag &tag) const
 {
-  NS_ASSERT (tag.GetInstanceTypeId () == m_data->tid);
-  tag.Deserialize (TagBuffer ((uint8_t*)m_data->data,
-                              (uint8_t*)m_data->data + m_data->size));
+  NS_ASSERT (tag.GetInstanceTypeId () == m_tid);
+  tag.Deserialize (TagBuffer ((uint8_t*)m_data,
+                              (uint8_t*)m_data + m_size));
 }
 
 
@@ -126,6 +130,48 @@ Packet::Copy (void) const
   return Ptr<Packet> (new Packet (*this), false);
 }
 
+Ptr<Packet>
+Packet::DeepCopy (void) const
+{
+  NS_LOG_FUNCTION (this);
+  Buffer buffer;
+  buffer.AddAtStart (m_buffer.GetSize ());
+  buffer.Begin ().Write (m_buffer.Begin (), m_buffer.End ());
+
+  ByteTagList byteTagList;
+  byteTagList.Add (m_byteTagList);
+
+  // add the tags from the oldest one, to keep their order
+  PacketTagList packetTagList;
+  for (uint32_t i = m_packetTagList.GetSize (); i > 0; i--)
+    {
+      const PacketTagList::TagData &data = m_packetTagList.Get (i - 1);
+      Callback<ObjectBase *> constructor = data.tid.GetConstructor ();
+      NS_ASSERT_MSG (!constructor.IsNull (), "No constructor to copy the tag " << data.tid.GetName ());
+      Tag *tag = dynamic_cast<Tag *> (constructor ());
+      NS_ASSERT (tag != 0);
+      const uint8_t *buffer = m_packetTagList.GetData (data);
+      tag->Deserialize (TagBuffer ((uint8_t *)buffer, (uint8_t *)buffer + data.size));
+      packetTagList.Add (*tag);
+      delete tag;
+    }
+
+  // the size given to Deserialize includes the 4-byte length prefix
+  // written by Packet::Serialize
+  uint32_t metaSize = m_metadata.GetSerializedSize ();
+  std::vector<uint8_t> data (metaSize + 4);
+  PacketMetadata metadata (m_metadata.GetUid (), 0);
+  m_metadata.Serialize (&data[0], metaSize);
+  metadata.Deserialize (&data[0], metaSize + 4);
+
+  Ptr<Packet> copy = Ptr<Packet> (new Packet (buffer, byteTagList, packetTagList, metadata), false);
+  if (m_nixVector)
+    {
+      copy->m_nixVector = m_nixVector->Copy ();
+    }
+  return copy;
+}
+
 Packet::Packet ()
   : m_buffer (),
     m_byteTagList (),
@@ -575,6 +621,13 @@ Packet::EnablePrinting (void)
   PacketMetadata::Enable ();
 }
 
+void
+Packet::EnableJournaledPrinting (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  PacketMetadata::EnableJournal ();
+}
+
 void
 Packet::EnableChecking (void)
 {
@@ -909,7 +962,7 @@ Packet::PrintPacketTags (std::ostream &os) const
 PacketTagIterator 
 Packet::GetPacketTagIterator (void) const
 {
-  return PacketTagIterator (m_packetTagList.Head ());
+  return PacketTagIterator (m_packetTagList);
 }
 
 std::ostream& operator<< (std::ostream& os, const Packet &packet)
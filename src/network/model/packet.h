@@ -155,10 +155,14 @@ private:
     friend class PacketTagIterator;
     /**
      * Constructor
-     * \param data the data to copy.
+     * \param tid the type of the tag.
+     * \param data the serialized tag.
+     * \param size the size of the serialized tag.
      */
-    Item (const struct PacketTagList::TagData *data);
-    const struct PacketTagList::TagData *m_data; //!< the tag data
+    Item (TypeId tid, const uint8_t *data, uint32_t size);
+    TypeId m_tid;          //!< the type of the tag
+    const uint8_t *m_data; //!< the serialized tag
+    uint32_t m_size;       //!< the size of the serialized tag
   };
   /**
    * \returns true if calling Next is safe, false otherwise.
@@ -173,10 +177,11 @@ private:
   friend class Packet;
   /**
    * Constructor
-   * \param head head of the items
+   * \param list the tags of the packet
    */
-  PacketTagIterator (const struct PacketTagList::TagData *head);
-  const struct PacketTagList::TagData *m_current;  //!< actual position over the set of tags in a packet
+  PacketTagIterator (const PacketTagList &list);
+  PacketTagList m_list;  //!< a copy of the tags of the packet, which keeps them alive
+  uint32_t m_current;    //!< actual position over the set of tags in a packet
 };
 
 /**
@@ -199,7 +204,9 @@ private:
  * output from Packet::Print. If you wish to only enable
  * checking of metadata, and do not need any printing capability, you can
  * call Packet::EnableChecking: its runtime cost is lower than
- * Packet::EnablePrinting.
+ * Packet::EnablePrinting. Packet::EnableJournaledPrinting also enables
+ * printing, deferring most of the cost of the metadata until a packet
+ * is printed.
  *
  * - The set of tags contain simulation-specific information which cannot
  * be stored in the packet byte buffer because the protocol headers or trailers
@@ -453,6 +460,19 @@ public:
    */
   Ptr<Packet> Copy (void) const;
 
+  /**
+   * \brief performs a deep copy of the packet.
+   *
+   * \returns a copy of the packet which shares no dataset with
+   * the original packet.
+   *
+   * The reference counts of the shared datasets are not atomic,
+   * so a packet handed over to another thread must be a deep copy.
+   * The packet tags are rebuilt from their serialized form, so
+   * their TypeId must have a constructor.
+   */
+  Ptr<Packet> DeepCopy (void) const;
+
   /**
    * \brief Returns the packet's Uid.
    *
@@ -469,6 +489,18 @@ public:
    * sequence numbers, or other packet or frame counters at other
    * protocol layers.
    *
+   * The upper 32 bits of the uid are the value of
+   * Simulator::GetSystemId when the packet was created: the MPI rank
+   * with the distributed simulators, and the partition of the thread
+   * with the MultithreadedSimulatorImpl and the OptimisticSimulatorImpl.
+   * The lower 32 bits count the packets created by the thread. A
+   * partition is run by a single thread until Simulator::Destroy, so
+   * the uids of the packets of a simulation are unique, but the lower
+   * 32 bits alone are not when several partitions or ranks create
+   * packets. A simulation run after Simulator::Destroy with one of
+   * these simulators starts new threads, whose uids may repeat those of
+   * the packets of the previous simulation.
+   *
    * \returns an integer identifier which uniquely
    *          identifies this packet.
    */
@@ -519,6 +551,18 @@ public:
    * simulation setup and before any packet is created.
    */
   static void EnablePrinting (void);
+  /**
+   * \brief Enable printing packets metadata, at a lower cost.
+   *
+   * Like EnablePrinting, but the operations on the headers and
+   * trailers of each packet are only recorded, and the metadata
+   * is only built when the packet is printed, serialized, or
+   * concatenated with another one. The headers removed by a receiver
+   * right after the sender added them cost almost nothing. The errors
+   * found by EnableChecking may be reported late, when the metadata
+   * is built.
+   */
+  static void EnableJournaledPrinting (void);
   /**
    * \brief Enable packets metadata checking.
    *
@@ -766,7 +810,12 @@ private:
   /* Please see comments above about nix-vector */
   Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
-  static uint32_t m_globalUid; //!< Global counter of packets Uid
+  /**
+   * Counter of the packets created by the thread, the lower 32 bits of
+   * their uid; thread local, so that the threads of a parallel
+   * simulator do not share a counter.
+   */
+  static thread_local uint32_t m_globalUid;
 };
 
 /**
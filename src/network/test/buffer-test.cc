@@ -376,6 +376,64 @@ BufferTest::DoRun (void)
   val2 <<= 8;
   val2 |= i.ReadU8 ();
   NS_TEST_ASSERT_MSG_EQ (val1, val2, "Bad ReadNtohU16()");
+
+  // appending buffers keeps the larger zero area, or both when adjacent
+  Buffer a = Buffer (1000);
+  a.AddAtStart (1);
+  a.Begin ().WriteU8 (0xaa);
+  a.AddAtEnd (1);
+  i = a.End ();
+  i.Prev ();
+  i.WriteU8 (0xbb);
+  Buffer b = Buffer (3000);
+  b.AddAtStart (1);
+  b.Begin ().WriteU8 (0xcc);
+  Buffer whole = a;
+  whole.AddAtEnd (b);
+  NS_TEST_ASSERT_MSG_EQ (whole.GetSize (), 4003, "Bad size of appended buffers");
+  NS_TEST_EXPECT_MSG_LT (whole.GetSerializedSize (), 1100, "Smaller zero area not the one written");
+  i = whole.Begin ();
+  NS_TEST_EXPECT_MSG_EQ (i.ReadU8 (), 0xaa, "Bad first byte");
+  i.Next (1000);
+  NS_TEST_EXPECT_MSG_EQ (i.ReadU8 (), 0xbb, "Bad byte after the first zero area");
+  NS_TEST_EXPECT_MSG_EQ (i.ReadU8 (), 0xcc, "Bad byte before the second zero area");
+  NS_TEST_EXPECT_MSG_EQ (i.GetRemainingSize (), 3000, "Bad size of the second zero area");
+  whole = b;
+  whole.AddAtEnd (a);
+  NS_TEST_EXPECT_MSG_LT (whole.GetSerializedSize (), 1100, "Smaller zero area not the one written");
+  i = whole.Begin ();
+  NS_TEST_EXPECT_MSG_EQ (i.ReadU8 (), 0xcc, "Bad first byte");
+  i.Next (3000);
+  NS_TEST_EXPECT_MSG_EQ (i.ReadU8 (), 0xaa, "Bad byte after the first zero area");
+  i.Next (1000);
+  NS_TEST_EXPECT_MSG_EQ (i.ReadU8 (), 0xbb, "Bad last byte");
+  a.RemoveAtEnd (1);
+  whole = a;
+  whole.AddAtEnd (Buffer (500));
+  NS_TEST_EXPECT_MSG_EQ (whole.GetSize (), 1501, "Bad size of merged zero areas");
+  NS_TEST_EXPECT_MSG_LT (whole.GetSerializedSize (), 100, "Adjacent zero areas not merged");
+  Buffer first = whole.CreateFragment (0, 700);
+  first.AddAtEnd (whole.CreateFragment (700, 801));
+  NS_TEST_EXPECT_MSG_EQ (first.GetSize (), 1501, "Bad size of reassembled fragments");
+  NS_TEST_EXPECT_MSG_LT (first.GetSerializedSize (), 100, "Fragments written out");
+  NS_TEST_EXPECT_MSG_EQ (first.Begin ().ReadU8 (), 0xaa, "Bad first byte of reassembled fragments");
+
+  // the memory of a buffer goes back to the pool of its size class
+  Buffer::PoolStatistics before = Buffer::GetPoolStatistics ();
+  {
+    Buffer large;
+    large.AddAtStart (3000);
+  }
+  {
+    Buffer large;
+    large.AddAtStart (3000);
+    Buffer::PoolStatistics during = Buffer::GetPoolStatistics ();
+    NS_TEST_EXPECT_MSG_GT (during.bytesOutstanding, before.bytesOutstanding, "Buffer memory not counted");
+  }
+  Buffer::PoolStatistics after = Buffer::GetPoolStatistics ();
+  NS_TEST_EXPECT_MSG_GT (after.requests, before.requests, "Buffer requests not counted");
+  NS_TEST_EXPECT_MSG_GT (after.hits, before.hits, "Recycled buffer not reused");
+  NS_TEST_EXPECT_MSG_EQ (after.bytesOutstanding, before.bytesOutstanding, "Buffer memory leaked");
 }
 
 /**
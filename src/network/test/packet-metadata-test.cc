@@ -318,7 +318,11 @@ HistoryTrailer<N>::Deserialize (Buffer::Iterator start)
  */
 class PacketMetadataTest : public TestCase {
 public:
-  PacketMetadataTest ();
+  /**
+   * Constructor
+   * \param journal Whether to record the metadata in a journal.
+   */
+  PacketMetadataTest (bool journal);
   virtual ~PacketMetadataTest ();
   /**
    * Checks the packet header and trailer history
@@ -337,10 +341,13 @@ private:
    * \return The packet with the header added.
    */
   Ptr<Packet> DoAddHeader (Ptr<Packet> p);
+
+  bool m_journal;  //!< Whether to record the metadata in a journal.
 };
 
-PacketMetadataTest::PacketMetadataTest ()
-  : TestCase ("Packet metadata")
+PacketMetadataTest::PacketMetadataTest (bool journal)
+  : TestCase (journal ? "Packet metadata journal" : "Packet metadata"),
+    m_journal (journal)
 {
 }
 
@@ -477,7 +484,15 @@ PacketMetadataTest::DoAddHeader (Ptr<Packet> p)
 void
 PacketMetadataTest::DoRun (void)
 {
-  PacketMetadata::Enable ();
+  if (m_journal)
+    {
+      // there is no way back: this case runs last
+      PacketMetadata::EnableJournal ();
+    }
+  else
+    {
+      PacketMetadata::Enable ();
+    }
 
   Ptr<Packet> p = Create<Packet> (0);
   Ptr<Packet> p1 = Create<Packet> (0);
@@ -900,6 +915,27 @@ PacketMetadataTest::DoRun (void)
                                  p3->GetSize ());
   delete [] buf;
   NS_TEST_EXPECT_MSG_EQ (msg, std::string ("hello world"), "Could not find original data in received packet");
+
+  // more operations than the journal holds, most of them cancelled
+  p = Create<Packet> (10);
+  for (uint32_t i = 0; i < 2 * PACKET_METADATA_JOURNAL_SIZE; i++)
+    {
+      ADD_HEADER (p, 2);
+    }
+  p1 = p->Copy ();
+  for (uint32_t i = 0; i < 2 * PACKET_METADATA_JOURNAL_SIZE - 1; i++)
+    {
+      REM_HEADER (p1, 2);
+    }
+  ADD_TRAILER (p1, 4);
+  p2 = p1->CreateFragment (1, 14);
+  CHECK_HISTORY (p1, 3, 2, 10, 4);
+  CHECK_HISTORY (p2, 3, 1, 10, 3);
+  for (uint32_t i = 0; i < 2 * PACKET_METADATA_JOURNAL_SIZE - 3; i++)
+    {
+      REM_HEADER (p, 2);
+    }
+  CHECK_HISTORY (p, 4, 2, 2, 2, 10);
 }
 
 
@@ -918,7 +954,8 @@ public:
 PacketMetadataTestSuite::PacketMetadataTestSuite ()
   : TestSuite ("packet-metadata", UNIT)
 {
-  AddTestCase (new PacketMetadataTest, TestCase::QUICK);
+  AddTestCase (new PacketMetadataTest (false), TestCase::QUICK);
+  AddTestCase (new PacketMetadataTest (true), TestCase::QUICK);
 }
 
 static PacketMetadataTestSuite g_packetMetadataTest; //!< Static variable for test initialization
@@ -993,7 +993,26 @@ PacketTagListTest::DoRun (void)
     ReplaceCheck (6);
     ReplaceCheck (7);
   }
-  
+
+  { // Add to a copy
+    std::cout << GetName () << "check adding to a copy" << std::endl;
+    PacketTagList ptl = ref;
+    ATestTag<100> big (3);  // larger than the first block
+    ptl.Add (big);
+    CheckRefList (ref, "add to copy, orig");
+    CheckRefList (ptl, "add to copy, copy");
+    ATestTag<100> missing;
+    NS_TEST_EXPECT_MSG_EQ (ref.Peek (missing), false, "add to copy, orig");
+    CheckRef (ptl, big, "add to copy, copy");
+
+    PacketTagList order = ptl;
+    order.Remove (t4);
+    NS_TEST_EXPECT_MSG_EQ (order.GetSize (), 7, "add to copy, remove");
+    NS_TEST_EXPECT_MSG_EQ (order.Get (0).tid, big.GetInstanceTypeId (), "most recent first");
+    NS_TEST_EXPECT_MSG_EQ (order.Get (6).tid, t1.GetInstanceTypeId (), "oldest last");
+    CheckRef (order, big, "add to copy, remove");
+  }
+
   { // Timing
     std::cout << GetName () << "add+remove timing" << std::endl;
     int flm = std::numeric_limits<int>::max ();
@@ -371,6 +371,10 @@ private:
  * longer correspond to the second packet that one wants to lose.  Therefore,
  * be advised that it might take some trial and error to select the
  * right uids when multiple are provided.
+ *
+ * Only the lower 32 bits of the uids are compared, which count the
+ * packets created by each partition or rank (see Packet::GetUid): with
+ * a parallel simulator, a listed uid may match a packet of each of them.
  * 
  * Reset() on this model will clear the list
  *
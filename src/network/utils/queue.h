@@ -30,6 +30,8 @@
 #include "ns3/unused.h"
 #include "ns3/log.h"
 #include "ns3/queue-size.h"
+#include "ns3/rollback.h"
+#include "ns3/simple-ref-count.h"
 #include <string>
 #include <sstream>
 #include <list>
@@ -294,6 +296,14 @@ public:
    */
   void Flush (void);
 
+  /**
+   * If the current event may be rolled back, save the items and the
+   * statistics of the queue, to restore them then.
+   *
+   * \see Rollback
+   */
+  void SaveState (void);
+
 protected:
 
   /// Const iterator.
@@ -381,6 +391,27 @@ protected:
   void DropAfterDequeue (Ptr<Item> item);
 
 private:
+  /// The items and statistics of the queue, saved by SaveState
+  struct State : public SimpleRefCount<State>
+  {
+    std::list<Ptr<Item> > packets;                //!< the items in the queue
+    uint32_t nBytes;                              //!< number of bytes in the queue
+    uint32_t nTotalReceivedBytes;                 //!< total received bytes
+    uint32_t nTotalReceivedPackets;               //!< total received packets
+    uint32_t nTotalDroppedBytesBeforeEnqueue;     //!< total dropped bytes before enqueue
+    uint32_t nTotalDroppedBytesAfterDequeue;      //!< total dropped bytes after dequeue
+    uint32_t nTotalDroppedPacketsBeforeEnqueue;   //!< total dropped packets before enqueue
+    uint32_t nTotalDroppedPacketsAfterDequeue;    //!< total dropped packets after dequeue
+  };
+
+  /**
+   * Restore the state saved by SaveState.
+   *
+   * \param queue the queue
+   * \param state the saved state
+   */
+  static void RestoreState (Ptr<Queue<Item> > queue, Ptr<const State> state);
+
   std::list<Ptr<Item> > m_packets;          //!< the items in the queue
   NS_LOG_TEMPLATE_DECLARE;                  //!< the log component
 
@@ -539,6 +570,45 @@ Queue<Item>::Flush (void)
     }
 }
 
+template <typename Item>
+void
+Queue<Item>::SaveState (void)
+{
+  if (!Rollback::IsEnabled ())
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  Ptr<State> state = Create<State> ();
+  state->packets = m_packets;
+  state->nBytes = m_nBytes;
+  state->nTotalReceivedBytes = m_nTotalReceivedBytes;
+  state->nTotalReceivedPackets = m_nTotalReceivedPackets;
+  state->nTotalDroppedBytesBeforeEnqueue = m_nTotalDroppedBytesBeforeEnqueue;
+  state->nTotalDroppedBytesAfterDequeue = m_nTotalDroppedBytesAfterDequeue;
+  state->nTotalDroppedPacketsBeforeEnqueue = m_nTotalDroppedPacketsBeforeEnqueue;
+  state->nTotalDroppedPacketsAfterDequeue = m_nTotalDroppedPacketsAfterDequeue;
+  Rollback::Save (MakeBoundCallback (&Queue<Item>::RestoreState, Ptr<Queue<Item> > (this),
+                                     Ptr<const State> (state)));
+}
+
+template <typename Item>
+void
+Queue<Item>::RestoreState (Ptr<Queue<Item> > queue, Ptr<const State> state)
+{
+  queue->m_packets = state->packets;
+  queue->m_nBytes = state->nBytes;
+  queue->m_nPackets = state->packets.size ();
+  queue->m_nTotalReceivedBytes = state->nTotalReceivedBytes;
+  queue->m_nTotalReceivedPackets = state->nTotalReceivedPackets;
+  queue->m_nTotalDroppedBytesBeforeEnqueue = state->nTotalDroppedBytesBeforeEnqueue;
+  queue->m_nTotalDroppedBytesAfterDequeue = state->nTotalDroppedBytesAfterDequeue;
+  queue->m_nTotalDroppedBytes = state->nTotalDroppedBytesBeforeEnqueue + state->nTotalDroppedBytesAfterDequeue;
+  queue->m_nTotalDroppedPacketsBeforeEnqueue = state->nTotalDroppedPacketsBeforeEnqueue;
+  queue->m_nTotalDroppedPacketsAfterDequeue = state->nTotalDroppedPacketsAfterDequeue;
+  queue->m_nTotalDroppedPackets = state->nTotalDroppedPacketsBeforeEnqueue + state->nTotalDroppedPacketsAfterDequeue;
+}
+
 template <typename Item>
 Ptr<const Item>
 Queue<Item>::DoPeek (ConstIterator pos) const
@@ -24,12 +24,14 @@
 #include "ns3/packet.h"
 #include "ns3/node.h"
 #include "ns3/log.h"
+#include "ns3/rollback.h"
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("SimpleChannel");
 
 NS_OBJECT_ENSURE_REGISTERED (SimpleChannel);
+NS_ROLLBACK_SUPPORTED (SimpleChannel);
 
 TypeId 
 SimpleChannel::GetTypeId (void)
@@ -47,6 +49,7 @@ SimpleChannel::GetTypeId (void)
 }
 
 SimpleChannel::SimpleChannel ()
+  : m_crossThread (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -59,7 +62,7 @@ SimpleChannel::Send (Ptr<Packet> p, uint16_t protocol,
   NS_LOG_FUNCTION (this << p << protocol << to << from << sender);
   for (std::vector<Ptr<SimpleNetDevice> >::const_iterator i = m_devices.begin (); i != m_devices.end (); ++i)
     {
-      Ptr<SimpleNetDevice> tmp = *i;
+      const Ptr<SimpleNetDevice> &tmp = *i;
       if (tmp == sender)
         {
           continue;
@@ -72,6 +75,15 @@ SimpleChannel::Send (Ptr<Packet> p, uint16_t protocol,
               continue;
             }
         }
+      if (m_crossThread)
+        {
+          // the receiver may be run by another thread: neither the
+          // packet nor the reference counts of the receiver are shared
+          Simulator::ScheduleWithContext (m_nodeIds[i - m_devices.begin ()], m_delay,
+                                          &SimpleNetDevice::Receive, PeekPointer (tmp),
+                                          p->DeepCopy (), protocol, to, from);
+          continue;
+        }
       Simulator::ScheduleWithContext (tmp->GetNode ()->GetId (), m_delay,
                                       &SimpleNetDevice::Receive, tmp, p->Copy (), protocol, to, from);
     }
@@ -82,6 +94,10 @@ SimpleChannel::Add (Ptr<SimpleNetDevice> device)
 {
   NS_LOG_FUNCTION (this << device);
   m_devices.push_back (device);
+  if (m_crossThread)
+    {
+      m_nodeIds.push_back (device->GetNode ()->GetId ());
+    }
 }
 
 std::size_t
@@ -98,6 +114,22 @@ SimpleChannel::GetDevice (std::size_t i) const
   return m_devices[i];
 }
 
+bool
+SimpleChannel::SetCrossThread (bool crossThread)
+{
+  NS_LOG_FUNCTION (this << crossThread);
+  m_nodeIds.clear ();
+  if (crossThread)
+    {
+      for (std::vector<Ptr<SimpleNetDevice> >::const_iterator i = m_devices.begin (); i != m_devices.end (); ++i)
+        {
+          m_nodeIds.push_back ((*i)->GetNode ()->GetId ());
+        }
+    }
+  m_crossThread = crossThread;
+  return true;
+}
+
 void
 SimpleChannel::BlackList (Ptr<SimpleNetDevice> from, Ptr<SimpleNetDevice> to)
 {
@@ -96,10 +96,13 @@ public:
   // inherited from ns3::Channel
   virtual std::size_t GetNDevices (void) const;
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
+  virtual bool SetCrossThread (bool crossThread);
 
 private:
   Time m_delay; //!< The assigned speed-of-light delay of the channel
   std::vector<Ptr<SimpleNetDevice> > m_devices; //!< devices connected by the channel
+  bool m_crossThread; //!< Receivers may be run by other threads
+  std::vector<uint32_t> m_nodeIds; //!< node ids of m_devices, set once m_crossThread
   std::map<Ptr<SimpleNetDevice>, std::vector<Ptr<SimpleNetDevice> > > m_blackListedDevices; //!< devices blocked on a device
 };
 
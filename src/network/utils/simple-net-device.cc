@@ -30,6 +30,7 @@
 #include "ns3/tag.h"
 #include "ns3/simulator.h"
 #include "ns3/queue.h"
+#include "ns3/rollback.h"
 
 namespace ns3 {
 
@@ -182,6 +183,7 @@ SimpleTag::Print (std::ostream &os) const
 
 
 NS_OBJECT_ENSURE_REGISTERED (SimpleNetDevice);
+NS_ROLLBACK_SUPPORTED (SimpleNetDevice);
 
 TypeId 
 SimpleNetDevice::GetTypeId (void)
@@ -259,6 +261,13 @@ SimpleNetDevice::Receive (Ptr<Packet> packet, uint16_t protocol,
       packetType = NetDevice::PACKET_OTHERHOST;
     }
 
+  if (Rollback::IsEnabled ())
+    {
+      // the upper layers change the packet, which the event must keep
+      // in case it runs again
+      packet = packet->Copy ();
+    }
+
   if (packetType != NetDevice::PACKET_OTHERHOST)
     {
       m_rxCallback (this, packet, protocol, from);
@@ -444,6 +453,7 @@ SimpleNetDevice::SendFrom (Ptr<Packet> p, const Address& source, const Address&
 
   p->AddPacketTag (tag);
 
+  SaveState ();
   if (m_queue->Enqueue (p))
     {
       if (m_queue->GetNPackets () == 1 && !TransmitCompleteEvent.IsRunning ())
@@ -477,7 +487,13 @@ SimpleNetDevice::TransmitComplete ()
       return;
     }
 
+  SaveState ();
   Ptr<Packet> packet = m_queue->Dequeue ();
+  if (Rollback::IsEnabled ())
+    {
+      // the saved queue still holds the packet with its tag
+      packet = packet->Copy ();
+    }
 
   SimpleTag tag;
   packet->RemovePacketTag (tag);
@@ -501,6 +517,26 @@ SimpleNetDevice::TransmitComplete ()
   return;
 }
 
+void
+SimpleNetDevice::SaveState (void)
+{
+  if (!Rollback::IsEnabled ())
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  m_queue->SaveState ();
+  Rollback::Save (MakeBoundCallback (&SimpleNetDevice::RestoreState,
+                                     Ptr<SimpleNetDevice> (this), TransmitCompleteEvent));
+}
+
+void
+SimpleNetDevice::RestoreState (Ptr<SimpleNetDevice> device, EventId event)
+{
+  NS_LOG_FUNCTION (device);
+  device->TransmitCompleteEvent = event;
+}
+
 Ptr<Node> 
 SimpleNetDevice::GetNode (void) const
 {
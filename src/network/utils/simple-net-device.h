@@ -49,6 +49,10 @@ class ErrorModel;
  *
  * By default the device is in Broadcast mode, with infinite bandwidth.
  *
+ * The device saves its state with Rollback, so that optimistic
+ * simulators may run its events ahead; the decisions of the receive
+ * ErrorModel are not rolled back.
+ *
  * \brief simple net device for simple things and testing
  */
 class SimpleNetDevice : public NetDevice
@@ -164,6 +168,20 @@ private:
    */
   void TransmitComplete (void);
 
+  /**
+   * If the current event may be rolled back, save the queue and the
+   * Tx Complete event before they change.
+   */
+  void SaveState (void);
+
+  /**
+   * Restore the Tx Complete event saved by SaveState.
+   *
+   * \param device the device
+   * \param event the Tx Complete event
+   */
+  static void RestoreState (Ptr<SimpleNetDevice> device, EventId event);
+
   bool m_linkUp; //!< Flag indicating whether or not the link is up
 
   /**
@@ -20,6 +20,8 @@
  */
 
 #include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/boolean.h"
 #include "container.h"
 
 namespace ns3 {
@@ -28,6 +30,36 @@ NS_LOG_COMPONENT_DEFINE ("OpenGymDataContainer");
 
 NS_OBJECT_ENSURE_REGISTERED (OpenGymDataContainer);
 
+static GlobalValue g_packedBox ("OpenGymPackedBox",
+                                "Encode Box containers as one raw little-endian blob "
+                                "instead of repeated protobuf fields",
+                                BooleanValue (true),
+                                MakeBooleanChecker ());
+
+template <typename T>
+static std::vector<T>
+UnpackRawData (const std::string &rawData)
+{
+  std::vector<T> data (rawData.size () / sizeof (T));
+  std::memcpy (data.data (), rawData.data (), data.size () * sizeof (T));
+  return data;
+}
+
+void
+OpenGymPackAny (const google::protobuf::Message &msg, google::protobuf::Any *any)
+{
+  static const std::string prefix = "type.googleapis.com/";
+  const std::string &typeName = msg.GetDescriptor ()->full_name ();
+  const std::string &typeUrl = any->type_url ();
+  if (typeUrl.size () != prefix.size () + typeName.size ()
+      || typeUrl.compare (0, prefix.size (), prefix) != 0
+      || typeUrl.compare (prefix.size (), typeName.size (), typeName) != 0)
+    {
+      any->set_type_url (prefix + typeName);
+    }
+  msg.SerializeToString (any->mutable_value ());
+}
+
 
 TypeId
 OpenGymDataContainer::GetTypeId (void)
@@ -61,8 +93,22 @@ OpenGymDataContainer::DoInitialize (void)
   //NS_LOG_FUNCTION (this);
 }
 
+void
+OpenGymDataContainer::FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm)
+{
+  dataContainerPbMsg = GetDataContainerPbMsg();
+}
+
+bool
+OpenGymDataContainer::IsPackedBoxEnabled()
+{
+  BooleanValue packedBox;
+  g_packedBox.GetValue (packedBox);
+  return packedBox.Get ();
+}
+
 Ptr<OpenGymDataContainer>
-OpenGymDataContainer::CreateFromDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg)
+OpenGymDataContainer::CreateFromDataContainerPbMsg(const ns3opengym::DataContainer &dataContainerPbMsg)
 {
   Ptr<OpenGymDataContainer> actDataContainer;
 
@@ -79,39 +125,61 @@ OpenGymDataContainer::CreateFromDataContainerPbMsg(ns3opengym::DataContainer &da
   {
     ns3opengym::BoxDataContainer boxContainerPbMsg;
     dataContainerPbMsg.data().UnpackTo(&boxContainerPbMsg);
+    // packed encoding if the agent sent a raw blob
+    const std::string &rawData = boxContainerPbMsg.rawdata();
 
     if (boxContainerPbMsg.dtype() == ns3opengym::INT) {
       Ptr<OpenGymBoxContainer<int32_t> > box = CreateObject<OpenGymBoxContainer<int32_t> >();
       std::vector<int32_t> myData;
-      myData.assign(boxContainerPbMsg.intdata().begin(), boxContainerPbMsg.intdata().end());
+      if (!rawData.empty()) {
+        myData = UnpackRawData<int32_t>(rawData);
+      } else {
+        myData.assign(boxContainerPbMsg.intdata().begin(), boxContainerPbMsg.intdata().end());
+      }
       box->SetData(myData);
       actDataContainer = box;
 
     } else if (boxContainerPbMsg.dtype() == ns3opengym::UINT) {
       Ptr<OpenGymBoxContainer<uint32_t> > box = CreateObject<OpenGymBoxContainer<uint32_t> >();
       std::vector<uint32_t> myData;
-      myData.assign(boxContainerPbMsg.uintdata().begin(), boxContainerPbMsg.uintdata().end());
+      if (!rawData.empty()) {
+        myData = UnpackRawData<uint32_t>(rawData);
+      } else {
+        myData.assign(boxContainerPbMsg.uintdata().begin(), boxContainerPbMsg.uintdata().end());
+      }
       box->SetData(myData);
       actDataContainer = box;
 
     } else if (boxContainerPbMsg.dtype() == ns3opengym::FLOAT) {
       Ptr<OpenGymBoxContainer<float> > box = CreateObject<OpenGymBoxContainer<float> >();
       std::vector<float> myData;
-      myData.assign(boxContainerPbMsg.floatdata().begin(), boxContainerPbMsg.floatdata().end());
+      if (!rawData.empty()) {
+        myData = UnpackRawData<float>(rawData);
+      } else {
+        myData.assign(boxContainerPbMsg.floatdata().begin(), boxContainerPbMsg.floatdata().end());
+      }
       box->SetData(myData);
       actDataContainer = box;
 
     } else if (boxContainerPbMsg.dtype() == ns3opengym::DOUBLE) {
       Ptr<OpenGymBoxContainer<double> > box = CreateObject<OpenGymBoxContainer<double> >();
       std::vector<double> myData;
-      myData.assign(boxContainerPbMsg.doubledata().begin(), boxContainerPbMsg.doubledata().end());
+      if (!rawData.empty()) {
+        myData = UnpackRawData<double>(rawData);
+      } else {
+        myData.assign(boxContainerPbMsg.doubledata().begin(), boxContainerPbMsg.doubledata().end());
+      }
       box->SetData(myData);
       actDataContainer = box;
 
     } else {
       Ptr<OpenGymBoxContainer<float> > box = CreateObject<OpenGymBoxContainer<float> >();
       std::vector<float> myData;
-      myData.assign(boxContainerPbMsg.floatdata().begin(), boxContainerPbMsg.floatdata().end());
+      if (!rawData.empty()) {
+        myData = UnpackRawData<float>(rawData);
+      } else {
+        myData.assign(boxContainerPbMsg.floatdata().begin(), boxContainerPbMsg.floatdata().end());
+      }
       box->SetData(myData);
       actDataContainer = box;
     }
@@ -123,13 +191,9 @@ OpenGymDataContainer::CreateFromDataContainerPbMsg(ns3opengym::DataContainer &da
     ns3opengym::TupleDataContainer tupleContainerPbMsg;
     dataContainerPbMsg.data().UnpackTo(&tupleContainerPbMsg);
 
-    std::vector< ns3opengym::DataContainer > elements;
-    elements.assign(tupleContainerPbMsg.element().begin(), tupleContainerPbMsg.element().end());
-
-    std::vector< ns3opengym::DataContainer >::iterator it;
-    for(it=elements.begin();it!=elements.end();++it)
+    for (int i = 0; i < tupleContainerPbMsg.element_size(); i++)
     {
-      Ptr<OpenGymDataContainer> subData = OpenGymDataContainer::CreateFromDataContainerPbMsg(*it);
+      Ptr<OpenGymDataContainer> subData = OpenGymDataContainer::CreateFromDataContainerPbMsg(tupleContainerPbMsg.element(i));
       tupleData->Add(subData);
     }
 
@@ -142,14 +206,11 @@ OpenGymDataContainer::CreateFromDataContainerPbMsg(ns3opengym::DataContainer &da
     ns3opengym::DictDataContainer dictContainerPbMsg;
     dataContainerPbMsg.data().UnpackTo(&dictContainerPbMsg);
 
-    std::vector< ns3opengym::DataContainer > elements;
-    elements.assign(dictContainerPbMsg.element().begin(), dictContainerPbMsg.element().end());
-
-    std::vector< ns3opengym::DataContainer >::iterator it;
-    for(it=elements.begin();it!=elements.end();++it)
+    for (int i = 0; i < dictContainerPbMsg.element_size(); i++)
     {
-      Ptr<OpenGymDataContainer> subSpace = OpenGymDataContainer::CreateFromDataContainerPbMsg(*it);
-      dictData->Add((*it).name(), subSpace);
+      const ns3opengym::DataContainer &element = dictContainerPbMsg.element(i);
+      Ptr<OpenGymDataContainer> subSpace = OpenGymDataContainer::CreateFromDataContainerPbMsg(element);
+      dictData->Add(element.name(), subSpace);
     }
 
     actDataContainer = dictData;
@@ -202,12 +263,18 @@ ns3opengym::DataContainer
 OpenGymDiscreteContainer::GetDataContainerPbMsg()
 {
   ns3opengym::DataContainer dataContainerPbMsg;
+  FillDataContainerPbMsg(dataContainerPbMsg, 0);
+  return dataContainerPbMsg;
+}
+
+void
+OpenGymDiscreteContainer::FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm)
+{
   ns3opengym::DiscreteDataContainer discreteContainerPbMsg;
   discreteContainerPbMsg.set_data(GetValue());
 
   dataContainerPbMsg.set_type(ns3opengym::Discrete);
-  dataContainerPbMsg.mutable_data()->PackFrom(discreteContainerPbMsg);
-  return dataContainerPbMsg;
+  OpenGymPackAny(discreteContainerPbMsg, dataContainerPbMsg.mutable_data());
 }
 
 bool
@@ -266,21 +333,23 @@ ns3opengym::DataContainer
 OpenGymTupleContainer::GetDataContainerPbMsg()
 {
   ns3opengym::DataContainer dataContainerPbMsg;
-  dataContainerPbMsg.set_type(ns3opengym::Tuple);
+  FillDataContainerPbMsg(dataContainerPbMsg, 0);
+  return dataContainerPbMsg;
+}
 
-  ns3opengym::TupleDataContainer tupleContainerPbMsg;
+void
+OpenGymTupleContainer::FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm)
+{
+  dataContainerPbMsg.set_type(ns3opengym::Tuple);
 
-  std::vector< Ptr<OpenGymDataContainer> >::iterator it;
-  for (it=m_tuple.begin(); it!=m_tuple.end(); ++it)
+  google::protobuf::RepeatedPtrField<ns3opengym::DataContainer> *elements = m_pbMsg.mutable_element();
+  for (uint32_t i = 0; i < m_tuple.size(); ++i)
   {
-    Ptr<OpenGymDataContainer> subSpace = *it;
-    ns3opengym::DataContainer subDataContainer = subSpace->GetDataContainerPbMsg();
-
-    tupleContainerPbMsg.add_element()->CopyFrom(subDataContainer);
+    m_tuple[i]->FillDataContainerPbMsg(*OpenGymReuseElement(elements, i), shm);
   }
+  OpenGymTrimElements(elements, m_tuple.size());
 
-  dataContainerPbMsg.mutable_data()->PackFrom(tupleContainerPbMsg);
-  return dataContainerPbMsg;
+  OpenGymPackAny(m_pbMsg, dataContainerPbMsg.mutable_data());
 }
 
 bool
@@ -362,24 +431,27 @@ ns3opengym::DataContainer
 OpenGymDictContainer::GetDataContainerPbMsg()
 {
   ns3opengym::DataContainer dataContainerPbMsg;
-  dataContainerPbMsg.set_type(ns3opengym::Dict);
+  FillDataContainerPbMsg(dataContainerPbMsg, 0);
+  return dataContainerPbMsg;
+}
 
-  ns3opengym::DictDataContainer dictContainerPbMsg;
+void
+OpenGymDictContainer::FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm)
+{
+  dataContainerPbMsg.set_type(ns3opengym::Dict);
 
+  google::protobuf::RepeatedPtrField<ns3opengym::DataContainer> *elements = m_pbMsg.mutable_element();
+  int idx = 0;
   std::map< std::string, Ptr<OpenGymDataContainer> >::iterator it;
   for (it=m_dict.begin(); it!=m_dict.end(); ++it)
   {
-    std::string name = it->first;
-    Ptr<OpenGymDataContainer> subSpace = it->second;
-
-    ns3opengym::DataContainer subDataContainer = subSpace->GetDataContainerPbMsg();
-    subDataContainer.set_name(name);
-
-    dictContainerPbMsg.add_element()->CopyFrom(subDataContainer);
+    ns3opengym::DataContainer *subDataContainer = OpenGymReuseElement(elements, idx++);
+    it->second->FillDataContainerPbMsg(*subDataContainer, shm);
+    subDataContainer->set_name(it->first);
   }
+  OpenGymTrimElements(elements, idx);
 
-  dataContainerPbMsg.mutable_data()->PackFrom(dictContainerPbMsg);
-  return dataContainerPbMsg;
+  OpenGymPackAny(m_pbMsg, dataContainerPbMsg.mutable_data());
 }
 
 bool
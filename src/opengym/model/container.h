@@ -25,9 +25,35 @@
 #include "ns3/object.h"
 #include "ns3/type-name.h"
 #include "messages.pb.h"
+#include "opengym_shm.h"
+#include <cstring>
+#include <type_traits>
 
 namespace ns3 {
 
+/**
+ * Messages cached across steps are refilled through these instead of
+ * Clear() + add_*(), as clearing a proto3 message frees its sub-messages.
+ */
+template <typename M>
+M*
+OpenGymReuseElement (google::protobuf::RepeatedPtrField<M> *elements, int idx)
+{
+  return (idx < elements->size()) ? elements->Mutable(idx) : elements->Add();
+}
+
+template <typename M>
+void
+OpenGymTrimElements (google::protobuf::RepeatedPtrField<M> *elements, int size)
+{
+  while (elements->size() > size) {
+    elements->RemoveLast();
+  }
+}
+
+// Any::PackFrom() builds the type URL on every call, this sets it only when it changes
+void OpenGymPackAny (const google::protobuf::Message &msg, google::protobuf::Any *any);
+
 class OpenGymDataContainer : public Object
 {
 public:
@@ -37,7 +63,11 @@ public:
   static TypeId GetTypeId ();
 
   virtual ns3opengym::DataContainer GetDataContainerPbMsg() = 0;
-  static Ptr<OpenGymDataContainer> CreateFromDataContainerPbMsg(ns3opengym::DataContainer &dataContainer);
+  // fill protobuf msg, bulk data goes to shared memory if shm is given and has room for it
+  virtual void FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm);
+  static Ptr<OpenGymDataContainer> CreateFromDataContainerPbMsg(const ns3opengym::DataContainer &dataContainer);
+  // value of the OpenGymPackedBox global
+  static bool IsPackedBoxEnabled();
 
   virtual void Print(std::ostream& where) const = 0;
   friend std::ostream& operator<< (std::ostream& os, const Ptr<OpenGymDataContainer> container)
@@ -63,6 +93,7 @@ public:
   static TypeId GetTypeId ();
 
   virtual ns3opengym::DataContainer GetDataContainerPbMsg();
+  virtual void FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm);
 
   virtual void Print(std::ostream& where) const;
   friend std::ostream& operator<< (std::ostream& os, const Ptr<OpenGymDiscreteContainer> container)
@@ -94,6 +125,7 @@ public:
   static TypeId GetTypeId ();
 
   virtual ns3opengym::DataContainer GetDataContainerPbMsg();
+  virtual void FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm);
 
   virtual void Print(std::ostream& where) const;
   friend std::ostream& operator<< (std::ostream& os, const Ptr<OpenGymBoxContainer> container)
@@ -104,12 +136,20 @@ public:
 
   bool AddValue(T value);
   T GetValue(uint32_t idx);
+  // overwrite a value in place, the buffer is sized to the full shape on first use
+  bool SetValue(uint32_t idx, T value);
+  // drop all values but keep the buffer, so refilling it does not allocate
+  void Clear();
 
-  bool SetData(std::vector<T> data);
+  bool SetData(const std::vector<T> &data);
   std::vector<T> GetData();
 
   std::vector<uint32_t> GetShape();
 
+  // raw little-endian data: int32, uint32, float or double depending on dtype
+  uint64_t GetRawDataSize() const;
+  void WriteRawData(uint8_t *dst) const;
+
 protected:
   // Inherited
   virtual void DoInitialize (void);
@@ -117,9 +157,16 @@ protected:
 
 private:
   void SetDtype();
+  uint32_t GetShapeSize() const;
+  template <typename U>
+  void CopyRawData(uint8_t *dst) const;
+  template <typename U>
+  void CopyRepeatedData(google::protobuf::RepeatedField<U> *dst) const;
 	std::vector<uint32_t> m_shape;
 	ns3opengym::Dtype m_dtype;
 	std::vector<T> m_data;
+	// reused across steps together with its buffers
+	ns3opengym::BoxDataContainer m_pbMsg;
 };
 
 template <typename T>
@@ -146,6 +193,7 @@ OpenGymBoxContainer<T>::OpenGymBoxContainer(std::vector<uint32_t> shape):
 	m_shape(shape)
 {
   SetDtype();
+  m_data.reserve(GetShapeSize());
 }
 
 template <typename T>
@@ -170,6 +218,16 @@ OpenGymBoxContainer<T>::SetDtype ()
     m_dtype = ns3opengym::FLOAT;
 }
 
+template <typename T>
+uint32_t
+OpenGymBoxContainer<T>::GetShapeSize () const
+{
+  uint32_t size = m_shape.empty() ? 0 : 1;
+  for (uint32_t i = 0; i < m_shape.size(); ++i)
+    size *= m_shape[i];
+  return size;
+}
+
 template <typename T>
 void
 OpenGymBoxContainer<T>::DoDispose (void)
@@ -187,34 +245,102 @@ ns3opengym::DataContainer
 OpenGymBoxContainer<T>::GetDataContainerPbMsg()
 {
   ns3opengym::DataContainer dataContainerPbMsg;
-  ns3opengym::BoxDataContainer boxContainerPbMsg;
-
-  std::vector<uint32_t> shape = GetShape();
-  *boxContainerPbMsg.mutable_shape() = {shape.begin(), shape.end()};
-
+  FillDataContainerPbMsg(dataContainerPbMsg, 0);
+  return dataContainerPbMsg;
+}
 
-  boxContainerPbMsg.set_dtype(m_dtype);
-  std::vector<T> data = GetData();
+template <typename T>
+void
+OpenGymBoxContainer<T>::FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm)
+{
+  // Clear() keeps the capacity of repeated fields and strings
+  m_pbMsg.Clear();
+  m_pbMsg.mutable_shape()->Reserve(m_shape.size());
+  for (uint32_t i = 0; i < m_shape.size(); ++i) {
+    m_pbMsg.mutable_shape()->AddAlreadyReserved(m_shape[i]);
+  }
+  m_pbMsg.set_dtype(m_dtype);
 
-  if (m_dtype == ns3opengym::INT) {
-    *boxContainerPbMsg.mutable_intdata() = {data.begin(), data.end()};
+  uint64_t offset = 0;
+  uint64_t size = GetRawDataSize();
+  uint8_t *blob = 0;
+  if (shm && size) {
+    blob = shm->AllocateBlob(size, offset);
+  }
 
+  if (blob) {
+    WriteRawData(blob);
+    m_pbMsg.set_shmoffset(offset);
+    m_pbMsg.set_shmsize(size);
+  } else if (IsPackedBoxEnabled()) {
+    // one memcpy instead of an add_* call per element on both sides
+    std::string *rawData = m_pbMsg.mutable_rawdata();
+    rawData->resize(size);
+    if (size) {
+      WriteRawData(reinterpret_cast<uint8_t*>(&(*rawData)[0]));
+    }
+  } else if (m_dtype == ns3opengym::INT) {
+    CopyRepeatedData<int32_t>(m_pbMsg.mutable_intdata());
   } else if (m_dtype == ns3opengym::UINT) {
-    *boxContainerPbMsg.mutable_uintdata() = {data.begin(), data.end()};
+    CopyRepeatedData<uint32_t>(m_pbMsg.mutable_uintdata());
+  } else if (m_dtype == ns3opengym::DOUBLE) {
+    CopyRepeatedData<double>(m_pbMsg.mutable_doubledata());
+  } else {
+    CopyRepeatedData<float>(m_pbMsg.mutable_floatdata());
+  }
 
-  } else if (m_dtype == ns3opengym::FLOAT) {
-    *boxContainerPbMsg.mutable_floatdata() = {data.begin(), data.end()};
+  dataContainerPbMsg.set_type(ns3opengym::Box);
+  OpenGymPackAny(m_pbMsg, dataContainerPbMsg.mutable_data());
+}
 
-  } else if (m_dtype == ns3opengym::DOUBLE) {
-    *boxContainerPbMsg.mutable_doubledata() = {data.begin(), data.end()};
+template <typename T>
+uint64_t
+OpenGymBoxContainer<T>::GetRawDataSize() const
+{
+  uint64_t itemSize = (m_dtype == ns3opengym::DOUBLE) ? sizeof(double) : sizeof(float);
+  return itemSize * m_data.size();
+}
 
+template <typename T>
+void
+OpenGymBoxContainer<T>::WriteRawData(uint8_t *dst) const
+{
+  if (m_dtype == ns3opengym::INT) {
+    CopyRawData<int32_t>(dst);
+  } else if (m_dtype == ns3opengym::UINT) {
+    CopyRawData<uint32_t>(dst);
+  } else if (m_dtype == ns3opengym::DOUBLE) {
+    CopyRawData<double>(dst);
   } else {
-    *boxContainerPbMsg.mutable_floatdata() = {data.begin(), data.end()};
+    CopyRawData<float>(dst);
   }
+}
 
-  dataContainerPbMsg.set_type(ns3opengym::Box);
-  dataContainerPbMsg.mutable_data()->PackFrom(boxContainerPbMsg);
-  return dataContainerPbMsg;
+template <typename T>
+template <typename U>
+void
+OpenGymBoxContainer<T>::CopyRawData(uint8_t *dst) const
+{
+  if (std::is_same<T, U>::value) {
+    std::memcpy(dst, m_data.data(), m_data.size() * sizeof(U));
+    return;
+  }
+
+  for (uint32_t i = 0; i < m_data.size(); ++i) {
+    U value = static_cast<U>(m_data[i]);
+    std::memcpy(dst + i * sizeof(U), &value, sizeof(U));
+  }
+}
+
+template <typename T>
+template <typename U>
+void
+OpenGymBoxContainer<T>::CopyRepeatedData(google::protobuf::RepeatedField<U> *dst) const
+{
+  dst->Reserve(m_data.size());
+  for (uint32_t i = 0; i < m_data.size(); ++i) {
+    dst->AddAlreadyReserved(static_cast<U>(m_data[i]));
+  }
 }
 
 template <typename T>
@@ -239,7 +365,30 @@ OpenGymBoxContainer<T>::GetValue(uint32_t idx)
 
 template <typename T>
 bool
-OpenGymBoxContainer<T>::SetData(std::vector<T> data)
+OpenGymBoxContainer<T>::SetValue(uint32_t idx, T value)
+{
+  if (m_data.size() < GetShapeSize())
+  {
+    m_data.resize(GetShapeSize());
+  }
+  if (idx >= m_data.size())
+  {
+    return false;
+  }
+  m_data[idx] = value;
+  return true;
+}
+
+template <typename T>
+void
+OpenGymBoxContainer<T>::Clear()
+{
+  m_data.clear();
+}
+
+template <typename T>
+bool
+OpenGymBoxContainer<T>::SetData(const std::vector<T> &data)
 {
   m_data = data;
   return true;
@@ -285,6 +434,7 @@ public:
   static TypeId GetTypeId ();
 
   virtual ns3opengym::DataContainer GetDataContainerPbMsg();
+  virtual void FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm);
 
   virtual void Print(std::ostream& where) const;
   friend std::ostream& operator<< (std::ostream& os, const Ptr<OpenGymTupleContainer> container)
@@ -302,6 +452,7 @@ protected:
   virtual void DoDispose (void);
 
   std::vector< Ptr<OpenGymDataContainer> > m_tuple;
+  ns3opengym::TupleDataContainer m_pbMsg;
 };
 
 
@@ -314,6 +465,7 @@ public:
   static TypeId GetTypeId ();
 
   virtual ns3opengym::DataContainer GetDataContainerPbMsg();
+  virtual void FillDataContainerPbMsg(ns3opengym::DataContainer &dataContainerPbMsg, Ptr<OpenGymShmChannel> shm);
 
   virtual void Print(std::ostream& where) const;
   friend std::ostream& operator<< ( std::ostream& os, const Ptr<OpenGymDictContainer> container)
@@ -331,6 +483,7 @@ protected:
   virtual void DoDispose (void);
 
   std::map< std::string, Ptr<OpenGymDataContainer> > m_dict;
+  ns3opengym::DictDataContainer m_pbMsg;
 };
 
 } // end of namespace ns3
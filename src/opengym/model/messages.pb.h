@@ -0,0 +1,6040 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: messages.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/any.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_messages_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_messages_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
+namespace ns3opengym {
+class AgentAct;
+struct AgentActDefaultTypeInternal;
+extern AgentActDefaultTypeInternal _AgentAct_default_instance_;
+class AgentSpaceDescription;
+struct AgentSpaceDescriptionDefaultTypeInternal;
+extern AgentSpaceDescriptionDefaultTypeInternal _AgentSpaceDescription_default_instance_;
+class AgentState;
+struct AgentStateDefaultTypeInternal;
+extern AgentStateDefaultTypeInternal _AgentState_default_instance_;
+class BoxDataContainer;
+struct BoxDataContainerDefaultTypeInternal;
+extern BoxDataContainerDefaultTypeInternal _BoxDataContainer_default_instance_;
+class BoxSpace;
+struct BoxSpaceDefaultTypeInternal;
+extern BoxSpaceDefaultTypeInternal _BoxSpace_default_instance_;
+class DataContainer;
+struct DataContainerDefaultTypeInternal;
+extern DataContainerDefaultTypeInternal _DataContainer_default_instance_;
+class DictDataContainer;
+struct DictDataContainerDefaultTypeInternal;
+extern DictDataContainerDefaultTypeInternal _DictDataContainer_default_instance_;
+class DictSpace;
+struct DictSpaceDefaultTypeInternal;
+extern DictSpaceDefaultTypeInternal _DictSpace_default_instance_;
+class DiscreteDataContainer;
+struct DiscreteDataContainerDefaultTypeInternal;
+extern DiscreteDataContainerDefaultTypeInternal _DiscreteDataContainer_default_instance_;
+class DiscreteSpace;
+struct DiscreteSpaceDefaultTypeInternal;
+extern DiscreteSpaceDefaultTypeInternal _DiscreteSpace_default_instance_;
+class EnvActMsg;
+struct EnvActMsgDefaultTypeInternal;
+extern EnvActMsgDefaultTypeInternal _EnvActMsg_default_instance_;
+class EnvStateMsg;
+struct EnvStateMsgDefaultTypeInternal;
+extern EnvStateMsgDefaultTypeInternal _EnvStateMsg_default_instance_;
+class SimInitAck;
+struct SimInitAckDefaultTypeInternal;
+extern SimInitAckDefaultTypeInternal _SimInitAck_default_instance_;
+class SimInitMsg;
+struct SimInitMsgDefaultTypeInternal;
+extern SimInitMsgDefaultTypeInternal _SimInitMsg_default_instance_;
+class SpaceDescription;
+struct SpaceDescriptionDefaultTypeInternal;
+extern SpaceDescriptionDefaultTypeInternal _SpaceDescription_default_instance_;
+class TupleDataContainer;
+struct TupleDataContainerDefaultTypeInternal;
+extern TupleDataContainerDefaultTypeInternal _TupleDataContainer_default_instance_;
+class TupleSpace;
+struct TupleSpaceDefaultTypeInternal;
+extern TupleSpaceDefaultTypeInternal _TupleSpace_default_instance_;
+}  // namespace ns3opengym
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ns3opengym::AgentAct* Arena::CreateMaybeMessage<::ns3opengym::AgentAct>(Arena*);
+template<> ::ns3opengym::AgentSpaceDescription* Arena::CreateMaybeMessage<::ns3opengym::AgentSpaceDescription>(Arena*);
+template<> ::ns3opengym::AgentState* Arena::CreateMaybeMessage<::ns3opengym::AgentState>(Arena*);
+template<> ::ns3opengym::BoxDataContainer* Arena::CreateMaybeMessage<::ns3opengym::BoxDataContainer>(Arena*);
+template<> ::ns3opengym::BoxSpace* Arena::CreateMaybeMessage<::ns3opengym::BoxSpace>(Arena*);
+template<> ::ns3opengym::DataContainer* Arena::CreateMaybeMessage<::ns3opengym::DataContainer>(Arena*);
+template<> ::ns3opengym::DictDataContainer* Arena::CreateMaybeMessage<::ns3opengym::DictDataContainer>(Arena*);
+template<> ::ns3opengym::DictSpace* Arena::CreateMaybeMessage<::ns3opengym::DictSpace>(Arena*);
+template<> ::ns3opengym::DiscreteDataContainer* Arena::CreateMaybeMessage<::ns3opengym::DiscreteDataContainer>(Arena*);
+template<> ::ns3opengym::DiscreteSpace* Arena::CreateMaybeMessage<::ns3opengym::DiscreteSpace>(Arena*);
+template<> ::ns3opengym::EnvActMsg* Arena::CreateMaybeMessage<::ns3opengym::EnvActMsg>(Arena*);
+template<> ::ns3opengym::EnvStateMsg* Arena::CreateMaybeMessage<::ns3opengym::EnvStateMsg>(Arena*);
+template<> ::ns3opengym::SimInitAck* Arena::CreateMaybeMessage<::ns3opengym::SimInitAck>(Arena*);
+template<> ::ns3opengym::SimInitMsg* Arena::CreateMaybeMessage<::ns3opengym::SimInitMsg>(Arena*);
+template<> ::ns3opengym::SpaceDescription* Arena::CreateMaybeMessage<::ns3opengym::SpaceDescription>(Arena*);
+template<> ::ns3opengym::TupleDataContainer* Arena::CreateMaybeMessage<::ns3opengym::TupleDataContainer>(Arena*);
+template<> ::ns3opengym::TupleSpace* Arena::CreateMaybeMessage<::ns3opengym::TupleSpace>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ns3opengym {
+
+enum EnvStateMsg_Reason : int {
+  EnvStateMsg_Reason_SimulationEnd = 0,
+  EnvStateMsg_Reason_GameOver = 1,
+  EnvStateMsg_Reason_EnvStateMsg_Reason_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  EnvStateMsg_Reason_EnvStateMsg_Reason_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool EnvStateMsg_Reason_IsValid(int value);
+constexpr EnvStateMsg_Reason EnvStateMsg_Reason_Reason_MIN = EnvStateMsg_Reason_SimulationEnd;
+constexpr EnvStateMsg_Reason EnvStateMsg_Reason_Reason_MAX = EnvStateMsg_Reason_GameOver;
+constexpr int EnvStateMsg_Reason_Reason_ARRAYSIZE = EnvStateMsg_Reason_Reason_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EnvStateMsg_Reason_descriptor();
+template<typename T>
+inline const std::string& EnvStateMsg_Reason_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EnvStateMsg_Reason>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EnvStateMsg_Reason_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EnvStateMsg_Reason_descriptor(), enum_t_value);
+}
+inline bool EnvStateMsg_Reason_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EnvStateMsg_Reason* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EnvStateMsg_Reason>(
+    EnvStateMsg_Reason_descriptor(), name, value);
+}
+enum EnvActMsg_SnapshotCmd : int {
+  EnvActMsg_SnapshotCmd_NoSnapshotCmd = 0,
+  EnvActMsg_SnapshotCmd_SaveSnapshot = 1,
+  EnvActMsg_SnapshotCmd_RestoreSnapshot = 2,
+  EnvActMsg_SnapshotCmd_ReleaseSnapshot = 3,
+  EnvActMsg_SnapshotCmd_EnvActMsg_SnapshotCmd_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  EnvActMsg_SnapshotCmd_EnvActMsg_SnapshotCmd_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool EnvActMsg_SnapshotCmd_IsValid(int value);
+constexpr EnvActMsg_SnapshotCmd EnvActMsg_SnapshotCmd_SnapshotCmd_MIN = EnvActMsg_SnapshotCmd_NoSnapshotCmd;
+constexpr EnvActMsg_SnapshotCmd EnvActMsg_SnapshotCmd_SnapshotCmd_MAX = EnvActMsg_SnapshotCmd_ReleaseSnapshot;
+constexpr int EnvActMsg_SnapshotCmd_SnapshotCmd_ARRAYSIZE = EnvActMsg_SnapshotCmd_SnapshotCmd_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EnvActMsg_SnapshotCmd_descriptor();
+template<typename T>
+inline const std::string& EnvActMsg_SnapshotCmd_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EnvActMsg_SnapshotCmd>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EnvActMsg_SnapshotCmd_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EnvActMsg_SnapshotCmd_descriptor(), enum_t_value);
+}
+inline bool EnvActMsg_SnapshotCmd_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EnvActMsg_SnapshotCmd* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EnvActMsg_SnapshotCmd>(
+    EnvActMsg_SnapshotCmd_descriptor(), name, value);
+}
+enum MsgType : int {
+  Unknown = 0,
+  Init = 1,
+  ActionSpace = 2,
+  ObservationSpace = 3,
+  IsGameOver = 4,
+  Observation = 5,
+  Reward = 6,
+  ExtraInfo = 7,
+  Action = 8,
+  StopEnv = 9,
+  MsgType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MsgType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MsgType_IsValid(int value);
+constexpr MsgType MsgType_MIN = Unknown;
+constexpr MsgType MsgType_MAX = StopEnv;
+constexpr int MsgType_ARRAYSIZE = MsgType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MsgType_descriptor();
+template<typename T>
+inline const std::string& MsgType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MsgType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MsgType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MsgType_descriptor(), enum_t_value);
+}
+inline bool MsgType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MsgType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MsgType>(
+    MsgType_descriptor(), name, value);
+}
+enum SpaceType : int {
+  NoSpaceType = 0,
+  Discrete = 1,
+  Box = 2,
+  Tuple = 3,
+  Dict = 4,
+  SpaceType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SpaceType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool SpaceType_IsValid(int value);
+constexpr SpaceType SpaceType_MIN = NoSpaceType;
+constexpr SpaceType SpaceType_MAX = Dict;
+constexpr int SpaceType_ARRAYSIZE = SpaceType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SpaceType_descriptor();
+template<typename T>
+inline const std::string& SpaceType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SpaceType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SpaceType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SpaceType_descriptor(), enum_t_value);
+}
+inline bool SpaceType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SpaceType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SpaceType>(
+    SpaceType_descriptor(), name, value);
+}
+enum Dtype : int {
+  NoDType = 0,
+  INT = 1,
+  UINT = 2,
+  FLOAT = 3,
+  DOUBLE = 4,
+  Dtype_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Dtype_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Dtype_IsValid(int value);
+constexpr Dtype Dtype_MIN = NoDType;
+constexpr Dtype Dtype_MAX = DOUBLE;
+constexpr int Dtype_ARRAYSIZE = Dtype_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Dtype_descriptor();
+template<typename T>
+inline const std::string& Dtype_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Dtype>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Dtype_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Dtype_descriptor(), enum_t_value);
+}
+inline bool Dtype_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Dtype* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Dtype>(
+    Dtype_descriptor(), name, value);
+}
+// ===================================================================
+
+class SpaceDescription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.SpaceDescription) */ {
+ public:
+  inline SpaceDescription() : SpaceDescription(nullptr) {}
+  ~SpaceDescription() override;
+  explicit PROTOBUF_CONSTEXPR SpaceDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpaceDescription(const SpaceDescription& from);
+  SpaceDescription(SpaceDescription&& from) noexcept
+    : SpaceDescription() {
+    *this = ::std::move(from);
+  }
+
+  inline SpaceDescription& operator=(const SpaceDescription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpaceDescription& operator=(SpaceDescription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpaceDescription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpaceDescription* internal_default_instance() {
+    return reinterpret_cast<const SpaceDescription*>(
+               &_SpaceDescription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SpaceDescription& a, SpaceDescription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpaceDescription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpaceDescription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpaceDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpaceDescription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpaceDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpaceDescription& from) {
+    SpaceDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpaceDescription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.SpaceDescription";
+  }
+  protected:
+  explicit SpaceDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kSpaceFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .google.protobuf.Any space = 2;
+  bool has_space() const;
+  private:
+  bool _internal_has_space() const;
+  public:
+  void clear_space();
+  const ::PROTOBUF_NAMESPACE_ID::Any& space() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Any* release_space();
+  ::PROTOBUF_NAMESPACE_ID::Any* mutable_space();
+  void set_allocated_space(::PROTOBUF_NAMESPACE_ID::Any* space);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Any& _internal_space() const;
+  ::PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_space();
+  public:
+  void unsafe_arena_set_allocated_space(
+      ::PROTOBUF_NAMESPACE_ID::Any* space);
+  ::PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_space();
+
+  // .ns3opengym.SpaceType type = 1;
+  void clear_type();
+  ::ns3opengym::SpaceType type() const;
+  void set_type(::ns3opengym::SpaceType value);
+  private:
+  ::ns3opengym::SpaceType _internal_type() const;
+  void _internal_set_type(::ns3opengym::SpaceType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.SpaceDescription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::Any* space_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DiscreteSpace final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.DiscreteSpace) */ {
+ public:
+  inline DiscreteSpace() : DiscreteSpace(nullptr) {}
+  ~DiscreteSpace() override;
+  explicit PROTOBUF_CONSTEXPR DiscreteSpace(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DiscreteSpace(const DiscreteSpace& from);
+  DiscreteSpace(DiscreteSpace&& from) noexcept
+    : DiscreteSpace() {
+    *this = ::std::move(from);
+  }
+
+  inline DiscreteSpace& operator=(const DiscreteSpace& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DiscreteSpace& operator=(DiscreteSpace&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DiscreteSpace& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DiscreteSpace* internal_default_instance() {
+    return reinterpret_cast<const DiscreteSpace*>(
+               &_DiscreteSpace_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(DiscreteSpace& a, DiscreteSpace& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DiscreteSpace* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DiscreteSpace* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DiscreteSpace* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DiscreteSpace>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DiscreteSpace& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DiscreteSpace& from) {
+    DiscreteSpace::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DiscreteSpace* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.DiscreteSpace";
+  }
+  protected:
+  explicit DiscreteSpace(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNFieldNumber = 1,
+  };
+  // int32 n = 1;
+  void clear_n();
+  int32_t n() const;
+  void set_n(int32_t value);
+  private:
+  int32_t _internal_n() const;
+  void _internal_set_n(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.DiscreteSpace)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t n_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BoxSpace final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.BoxSpace) */ {
+ public:
+  inline BoxSpace() : BoxSpace(nullptr) {}
+  ~BoxSpace() override;
+  explicit PROTOBUF_CONSTEXPR BoxSpace(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BoxSpace(const BoxSpace& from);
+  BoxSpace(BoxSpace&& from) noexcept
+    : BoxSpace() {
+    *this = ::std::move(from);
+  }
+
+  inline BoxSpace& operator=(const BoxSpace& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoxSpace& operator=(BoxSpace&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BoxSpace& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BoxSpace* internal_default_instance() {
+    return reinterpret_cast<const BoxSpace*>(
+               &_BoxSpace_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(BoxSpace& a, BoxSpace& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BoxSpace* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BoxSpace* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BoxSpace* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BoxSpace>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BoxSpace& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BoxSpace& from) {
+    BoxSpace::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BoxSpace* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.BoxSpace";
+  }
+  protected:
+  explicit BoxSpace(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShapeFieldNumber = 4,
+    kLowFieldNumber = 1,
+    kHighFieldNumber = 2,
+    kDtypeFieldNumber = 3,
+  };
+  // repeated uint32 shape = 4;
+  int shape_size() const;
+  private:
+  int _internal_shape_size() const;
+  public:
+  void clear_shape();
+  private:
+  uint32_t _internal_shape(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_shape() const;
+  void _internal_add_shape(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_shape();
+  public:
+  uint32_t shape(int index) const;
+  void set_shape(int index, uint32_t value);
+  void add_shape(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      shape() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_shape();
+
+  // float low = 1;
+  void clear_low();
+  float low() const;
+  void set_low(float value);
+  private:
+  float _internal_low() const;
+  void _internal_set_low(float value);
+  public:
+
+  // float high = 2;
+  void clear_high();
+  float high() const;
+  void set_high(float value);
+  private:
+  float _internal_high() const;
+  void _internal_set_high(float value);
+  public:
+
+  // .ns3opengym.Dtype dtype = 3;
+  void clear_dtype();
+  ::ns3opengym::Dtype dtype() const;
+  void set_dtype(::ns3opengym::Dtype value);
+  private:
+  ::ns3opengym::Dtype _internal_dtype() const;
+  void _internal_set_dtype(::ns3opengym::Dtype value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.BoxSpace)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > shape_;
+    mutable std::atomic<int> _shape_cached_byte_size_;
+    float low_;
+    float high_;
+    int dtype_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TupleSpace final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.TupleSpace) */ {
+ public:
+  inline TupleSpace() : TupleSpace(nullptr) {}
+  ~TupleSpace() override;
+  explicit PROTOBUF_CONSTEXPR TupleSpace(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TupleSpace(const TupleSpace& from);
+  TupleSpace(TupleSpace&& from) noexcept
+    : TupleSpace() {
+    *this = ::std::move(from);
+  }
+
+  inline TupleSpace& operator=(const TupleSpace& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TupleSpace& operator=(TupleSpace&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TupleSpace& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TupleSpace* internal_default_instance() {
+    return reinterpret_cast<const TupleSpace*>(
+               &_TupleSpace_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TupleSpace& a, TupleSpace& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TupleSpace* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TupleSpace* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TupleSpace* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TupleSpace>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TupleSpace& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TupleSpace& from) {
+    TupleSpace::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TupleSpace* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.TupleSpace";
+  }
+  protected:
+  explicit TupleSpace(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementFieldNumber = 1,
+  };
+  // repeated .ns3opengym.SpaceDescription element = 1;
+  int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
+  void clear_element();
+  ::ns3opengym::SpaceDescription* mutable_element(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >*
+      mutable_element();
+  private:
+  const ::ns3opengym::SpaceDescription& _internal_element(int index) const;
+  ::ns3opengym::SpaceDescription* _internal_add_element();
+  public:
+  const ::ns3opengym::SpaceDescription& element(int index) const;
+  ::ns3opengym::SpaceDescription* add_element();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >&
+      element() const;
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.TupleSpace)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription > element_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DictSpace final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.DictSpace) */ {
+ public:
+  inline DictSpace() : DictSpace(nullptr) {}
+  ~DictSpace() override;
+  explicit PROTOBUF_CONSTEXPR DictSpace(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DictSpace(const DictSpace& from);
+  DictSpace(DictSpace&& from) noexcept
+    : DictSpace() {
+    *this = ::std::move(from);
+  }
+
+  inline DictSpace& operator=(const DictSpace& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DictSpace& operator=(DictSpace&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DictSpace& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DictSpace* internal_default_instance() {
+    return reinterpret_cast<const DictSpace*>(
+               &_DictSpace_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(DictSpace& a, DictSpace& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DictSpace* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DictSpace* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DictSpace* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DictSpace>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DictSpace& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DictSpace& from) {
+    DictSpace::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DictSpace* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.DictSpace";
+  }
+  protected:
+  explicit DictSpace(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementFieldNumber = 1,
+  };
+  // repeated .ns3opengym.SpaceDescription element = 1;
+  int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
+  void clear_element();
+  ::ns3opengym::SpaceDescription* mutable_element(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >*
+      mutable_element();
+  private:
+  const ::ns3opengym::SpaceDescription& _internal_element(int index) const;
+  ::ns3opengym::SpaceDescription* _internal_add_element();
+  public:
+  const ::ns3opengym::SpaceDescription& element(int index) const;
+  ::ns3opengym::SpaceDescription* add_element();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >&
+      element() const;
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.DictSpace)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription > element_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DataContainer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.DataContainer) */ {
+ public:
+  inline DataContainer() : DataContainer(nullptr) {}
+  ~DataContainer() override;
+  explicit PROTOBUF_CONSTEXPR DataContainer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DataContainer(const DataContainer& from);
+  DataContainer(DataContainer&& from) noexcept
+    : DataContainer() {
+    *this = ::std::move(from);
+  }
+
+  inline DataContainer& operator=(const DataContainer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DataContainer& operator=(DataContainer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DataContainer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DataContainer* internal_default_instance() {
+    return reinterpret_cast<const DataContainer*>(
+               &_DataContainer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(DataContainer& a, DataContainer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DataContainer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DataContainer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DataContainer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DataContainer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DataContainer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DataContainer& from) {
+    DataContainer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DataContainer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.DataContainer";
+  }
+  protected:
+  explicit DataContainer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 3,
+    kDataFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .google.protobuf.Any data = 2;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const ::PROTOBUF_NAMESPACE_ID::Any& data() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Any* release_data();
+  ::PROTOBUF_NAMESPACE_ID::Any* mutable_data();
+  void set_allocated_data(::PROTOBUF_NAMESPACE_ID::Any* data);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Any& _internal_data() const;
+  ::PROTOBUF_NAMESPACE_ID::Any* _internal_mutable_data();
+  public:
+  void unsafe_arena_set_allocated_data(
+      ::PROTOBUF_NAMESPACE_ID::Any* data);
+  ::PROTOBUF_NAMESPACE_ID::Any* unsafe_arena_release_data();
+
+  // .ns3opengym.SpaceType type = 1;
+  void clear_type();
+  ::ns3opengym::SpaceType type() const;
+  void set_type(::ns3opengym::SpaceType value);
+  private:
+  ::ns3opengym::SpaceType _internal_type() const;
+  void _internal_set_type(::ns3opengym::SpaceType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.DataContainer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::Any* data_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DiscreteDataContainer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.DiscreteDataContainer) */ {
+ public:
+  inline DiscreteDataContainer() : DiscreteDataContainer(nullptr) {}
+  ~DiscreteDataContainer() override;
+  explicit PROTOBUF_CONSTEXPR DiscreteDataContainer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DiscreteDataContainer(const DiscreteDataContainer& from);
+  DiscreteDataContainer(DiscreteDataContainer&& from) noexcept
+    : DiscreteDataContainer() {
+    *this = ::std::move(from);
+  }
+
+  inline DiscreteDataContainer& operator=(const DiscreteDataContainer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DiscreteDataContainer& operator=(DiscreteDataContainer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DiscreteDataContainer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DiscreteDataContainer* internal_default_instance() {
+    return reinterpret_cast<const DiscreteDataContainer*>(
+               &_DiscreteDataContainer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(DiscreteDataContainer& a, DiscreteDataContainer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DiscreteDataContainer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DiscreteDataContainer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DiscreteDataContainer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DiscreteDataContainer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DiscreteDataContainer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DiscreteDataContainer& from) {
+    DiscreteDataContainer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DiscreteDataContainer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.DiscreteDataContainer";
+  }
+  protected:
+  explicit DiscreteDataContainer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // int32 data = 1;
+  void clear_data();
+  int32_t data() const;
+  void set_data(int32_t value);
+  private:
+  int32_t _internal_data() const;
+  void _internal_set_data(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.DiscreteDataContainer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BoxDataContainer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.BoxDataContainer) */ {
+ public:
+  inline BoxDataContainer() : BoxDataContainer(nullptr) {}
+  ~BoxDataContainer() override;
+  explicit PROTOBUF_CONSTEXPR BoxDataContainer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BoxDataContainer(const BoxDataContainer& from);
+  BoxDataContainer(BoxDataContainer&& from) noexcept
+    : BoxDataContainer() {
+    *this = ::std::move(from);
+  }
+
+  inline BoxDataContainer& operator=(const BoxDataContainer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoxDataContainer& operator=(BoxDataContainer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BoxDataContainer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BoxDataContainer* internal_default_instance() {
+    return reinterpret_cast<const BoxDataContainer*>(
+               &_BoxDataContainer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(BoxDataContainer& a, BoxDataContainer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BoxDataContainer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BoxDataContainer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BoxDataContainer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BoxDataContainer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BoxDataContainer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BoxDataContainer& from) {
+    BoxDataContainer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BoxDataContainer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.BoxDataContainer";
+  }
+  protected:
+  explicit BoxDataContainer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShapeFieldNumber = 2,
+    kIntDataFieldNumber = 3,
+    kUintDataFieldNumber = 4,
+    kFloatDataFieldNumber = 5,
+    kDoubleDataFieldNumber = 6,
+    kRawDataFieldNumber = 9,
+    kShmOffsetFieldNumber = 7,
+    kShmSizeFieldNumber = 8,
+    kDtypeFieldNumber = 1,
+  };
+  // repeated uint32 shape = 2;
+  int shape_size() const;
+  private:
+  int _internal_shape_size() const;
+  public:
+  void clear_shape();
+  private:
+  uint32_t _internal_shape(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_shape() const;
+  void _internal_add_shape(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_shape();
+  public:
+  uint32_t shape(int index) const;
+  void set_shape(int index, uint32_t value);
+  void add_shape(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      shape() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_shape();
+
+  // repeated int32 intData = 3;
+  int intdata_size() const;
+  private:
+  int _internal_intdata_size() const;
+  public:
+  void clear_intdata();
+  private:
+  int32_t _internal_intdata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_intdata() const;
+  void _internal_add_intdata(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_intdata();
+  public:
+  int32_t intdata(int index) const;
+  void set_intdata(int index, int32_t value);
+  void add_intdata(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      intdata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_intdata();
+
+  // repeated uint32 uintData = 4;
+  int uintdata_size() const;
+  private:
+  int _internal_uintdata_size() const;
+  public:
+  void clear_uintdata();
+  private:
+  uint32_t _internal_uintdata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_uintdata() const;
+  void _internal_add_uintdata(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_uintdata();
+  public:
+  uint32_t uintdata(int index) const;
+  void set_uintdata(int index, uint32_t value);
+  void add_uintdata(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      uintdata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_uintdata();
+
+  // repeated float floatData = 5;
+  int floatdata_size() const;
+  private:
+  int _internal_floatdata_size() const;
+  public:
+  void clear_floatdata();
+  private:
+  float _internal_floatdata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_floatdata() const;
+  void _internal_add_floatdata(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_floatdata();
+  public:
+  float floatdata(int index) const;
+  void set_floatdata(int index, float value);
+  void add_floatdata(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      floatdata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_floatdata();
+
+  // repeated double doubleData = 6;
+  int doubledata_size() const;
+  private:
+  int _internal_doubledata_size() const;
+  public:
+  void clear_doubledata();
+  private:
+  double _internal_doubledata(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_doubledata() const;
+  void _internal_add_doubledata(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_doubledata();
+  public:
+  double doubledata(int index) const;
+  void set_doubledata(int index, double value);
+  void add_doubledata(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      doubledata() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_doubledata();
+
+  // bytes rawData = 9;
+  void clear_rawdata();
+  const std::string& rawdata() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rawdata(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rawdata();
+  PROTOBUF_NODISCARD std::string* release_rawdata();
+  void set_allocated_rawdata(std::string* rawdata);
+  private:
+  const std::string& _internal_rawdata() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rawdata(const std::string& value);
+  std::string* _internal_mutable_rawdata();
+  public:
+
+  // uint64 shmOffset = 7;
+  void clear_shmoffset();
+  uint64_t shmoffset() const;
+  void set_shmoffset(uint64_t value);
+  private:
+  uint64_t _internal_shmoffset() const;
+  void _internal_set_shmoffset(uint64_t value);
+  public:
+
+  // uint64 shmSize = 8;
+  void clear_shmsize();
+  uint64_t shmsize() const;
+  void set_shmsize(uint64_t value);
+  private:
+  uint64_t _internal_shmsize() const;
+  void _internal_set_shmsize(uint64_t value);
+  public:
+
+  // .ns3opengym.Dtype dtype = 1;
+  void clear_dtype();
+  ::ns3opengym::Dtype dtype() const;
+  void set_dtype(::ns3opengym::Dtype value);
+  private:
+  ::ns3opengym::Dtype _internal_dtype() const;
+  void _internal_set_dtype(::ns3opengym::Dtype value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.BoxDataContainer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > shape_;
+    mutable std::atomic<int> _shape_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > intdata_;
+    mutable std::atomic<int> _intdata_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > uintdata_;
+    mutable std::atomic<int> _uintdata_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > floatdata_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > doubledata_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rawdata_;
+    uint64_t shmoffset_;
+    uint64_t shmsize_;
+    int dtype_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TupleDataContainer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.TupleDataContainer) */ {
+ public:
+  inline TupleDataContainer() : TupleDataContainer(nullptr) {}
+  ~TupleDataContainer() override;
+  explicit PROTOBUF_CONSTEXPR TupleDataContainer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TupleDataContainer(const TupleDataContainer& from);
+  TupleDataContainer(TupleDataContainer&& from) noexcept
+    : TupleDataContainer() {
+    *this = ::std::move(from);
+  }
+
+  inline TupleDataContainer& operator=(const TupleDataContainer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TupleDataContainer& operator=(TupleDataContainer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TupleDataContainer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TupleDataContainer* internal_default_instance() {
+    return reinterpret_cast<const TupleDataContainer*>(
+               &_TupleDataContainer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(TupleDataContainer& a, TupleDataContainer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TupleDataContainer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TupleDataContainer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TupleDataContainer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TupleDataContainer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TupleDataContainer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TupleDataContainer& from) {
+    TupleDataContainer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TupleDataContainer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.TupleDataContainer";
+  }
+  protected:
+  explicit TupleDataContainer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementFieldNumber = 1,
+  };
+  // repeated .ns3opengym.DataContainer element = 1;
+  int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
+  void clear_element();
+  ::ns3opengym::DataContainer* mutable_element(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >*
+      mutable_element();
+  private:
+  const ::ns3opengym::DataContainer& _internal_element(int index) const;
+  ::ns3opengym::DataContainer* _internal_add_element();
+  public:
+  const ::ns3opengym::DataContainer& element(int index) const;
+  ::ns3opengym::DataContainer* add_element();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >&
+      element() const;
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.TupleDataContainer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer > element_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DictDataContainer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.DictDataContainer) */ {
+ public:
+  inline DictDataContainer() : DictDataContainer(nullptr) {}
+  ~DictDataContainer() override;
+  explicit PROTOBUF_CONSTEXPR DictDataContainer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DictDataContainer(const DictDataContainer& from);
+  DictDataContainer(DictDataContainer&& from) noexcept
+    : DictDataContainer() {
+    *this = ::std::move(from);
+  }
+
+  inline DictDataContainer& operator=(const DictDataContainer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DictDataContainer& operator=(DictDataContainer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DictDataContainer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DictDataContainer* internal_default_instance() {
+    return reinterpret_cast<const DictDataContainer*>(
+               &_DictDataContainer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(DictDataContainer& a, DictDataContainer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DictDataContainer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DictDataContainer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DictDataContainer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DictDataContainer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DictDataContainer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DictDataContainer& from) {
+    DictDataContainer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DictDataContainer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.DictDataContainer";
+  }
+  protected:
+  explicit DictDataContainer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementFieldNumber = 1,
+  };
+  // repeated .ns3opengym.DataContainer element = 1;
+  int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
+  void clear_element();
+  ::ns3opengym::DataContainer* mutable_element(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >*
+      mutable_element();
+  private:
+  const ::ns3opengym::DataContainer& _internal_element(int index) const;
+  ::ns3opengym::DataContainer* _internal_add_element();
+  public:
+  const ::ns3opengym::DataContainer& element(int index) const;
+  ::ns3opengym::DataContainer* add_element();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >&
+      element() const;
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.DictDataContainer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer > element_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AgentSpaceDescription final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.AgentSpaceDescription) */ {
+ public:
+  inline AgentSpaceDescription() : AgentSpaceDescription(nullptr) {}
+  ~AgentSpaceDescription() override;
+  explicit PROTOBUF_CONSTEXPR AgentSpaceDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AgentSpaceDescription(const AgentSpaceDescription& from);
+  AgentSpaceDescription(AgentSpaceDescription&& from) noexcept
+    : AgentSpaceDescription() {
+    *this = ::std::move(from);
+  }
+
+  inline AgentSpaceDescription& operator=(const AgentSpaceDescription& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AgentSpaceDescription& operator=(AgentSpaceDescription&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AgentSpaceDescription& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AgentSpaceDescription* internal_default_instance() {
+    return reinterpret_cast<const AgentSpaceDescription*>(
+               &_AgentSpaceDescription_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(AgentSpaceDescription& a, AgentSpaceDescription& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AgentSpaceDescription* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AgentSpaceDescription* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AgentSpaceDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AgentSpaceDescription>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AgentSpaceDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AgentSpaceDescription& from) {
+    AgentSpaceDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AgentSpaceDescription* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.AgentSpaceDescription";
+  }
+  protected:
+  explicit AgentSpaceDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObsSpaceFieldNumber = 2,
+    kActSpaceFieldNumber = 3,
+    kAgentIdFieldNumber = 1,
+  };
+  // .ns3opengym.SpaceDescription obsSpace = 2;
+  bool has_obsspace() const;
+  private:
+  bool _internal_has_obsspace() const;
+  public:
+  void clear_obsspace();
+  const ::ns3opengym::SpaceDescription& obsspace() const;
+  PROTOBUF_NODISCARD ::ns3opengym::SpaceDescription* release_obsspace();
+  ::ns3opengym::SpaceDescription* mutable_obsspace();
+  void set_allocated_obsspace(::ns3opengym::SpaceDescription* obsspace);
+  private:
+  const ::ns3opengym::SpaceDescription& _internal_obsspace() const;
+  ::ns3opengym::SpaceDescription* _internal_mutable_obsspace();
+  public:
+  void unsafe_arena_set_allocated_obsspace(
+      ::ns3opengym::SpaceDescription* obsspace);
+  ::ns3opengym::SpaceDescription* unsafe_arena_release_obsspace();
+
+  // .ns3opengym.SpaceDescription actSpace = 3;
+  bool has_actspace() const;
+  private:
+  bool _internal_has_actspace() const;
+  public:
+  void clear_actspace();
+  const ::ns3opengym::SpaceDescription& actspace() const;
+  PROTOBUF_NODISCARD ::ns3opengym::SpaceDescription* release_actspace();
+  ::ns3opengym::SpaceDescription* mutable_actspace();
+  void set_allocated_actspace(::ns3opengym::SpaceDescription* actspace);
+  private:
+  const ::ns3opengym::SpaceDescription& _internal_actspace() const;
+  ::ns3opengym::SpaceDescription* _internal_mutable_actspace();
+  public:
+  void unsafe_arena_set_allocated_actspace(
+      ::ns3opengym::SpaceDescription* actspace);
+  ::ns3opengym::SpaceDescription* unsafe_arena_release_actspace();
+
+  // uint32 agentId = 1;
+  void clear_agentid();
+  uint32_t agentid() const;
+  void set_agentid(uint32_t value);
+  private:
+  uint32_t _internal_agentid() const;
+  void _internal_set_agentid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.AgentSpaceDescription)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::ns3opengym::SpaceDescription* obsspace_;
+    ::ns3opengym::SpaceDescription* actspace_;
+    uint32_t agentid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SimInitMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.SimInitMsg) */ {
+ public:
+  inline SimInitMsg() : SimInitMsg(nullptr) {}
+  ~SimInitMsg() override;
+  explicit PROTOBUF_CONSTEXPR SimInitMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SimInitMsg(const SimInitMsg& from);
+  SimInitMsg(SimInitMsg&& from) noexcept
+    : SimInitMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline SimInitMsg& operator=(const SimInitMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SimInitMsg& operator=(SimInitMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SimInitMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SimInitMsg* internal_default_instance() {
+    return reinterpret_cast<const SimInitMsg*>(
+               &_SimInitMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(SimInitMsg& a, SimInitMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SimInitMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SimInitMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SimInitMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SimInitMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SimInitMsg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SimInitMsg& from) {
+    SimInitMsg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SimInitMsg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.SimInitMsg";
+  }
+  protected:
+  explicit SimInitMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAgentsFieldNumber = 7,
+    kShmNameFieldNumber = 5,
+    kObsSpaceFieldNumber = 3,
+    kActSpaceFieldNumber = 4,
+    kSimProcessIdFieldNumber = 1,
+    kWafShellProcessIdFieldNumber = 2,
+    kRestoredSnapshotFieldNumber = 8,
+    kForkServerFieldNumber = 6,
+  };
+  // repeated .ns3opengym.AgentSpaceDescription agents = 7;
+  int agents_size() const;
+  private:
+  int _internal_agents_size() const;
+  public:
+  void clear_agents();
+  ::ns3opengym::AgentSpaceDescription* mutable_agents(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentSpaceDescription >*
+      mutable_agents();
+  private:
+  const ::ns3opengym::AgentSpaceDescription& _internal_agents(int index) const;
+  ::ns3opengym::AgentSpaceDescription* _internal_add_agents();
+  public:
+  const ::ns3opengym::AgentSpaceDescription& agents(int index) const;
+  ::ns3opengym::AgentSpaceDescription* add_agents();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentSpaceDescription >&
+      agents() const;
+
+  // string shmName = 5;
+  void clear_shmname();
+  const std::string& shmname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_shmname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_shmname();
+  PROTOBUF_NODISCARD std::string* release_shmname();
+  void set_allocated_shmname(std::string* shmname);
+  private:
+  const std::string& _internal_shmname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_shmname(const std::string& value);
+  std::string* _internal_mutable_shmname();
+  public:
+
+  // .ns3opengym.SpaceDescription obsSpace = 3;
+  bool has_obsspace() const;
+  private:
+  bool _internal_has_obsspace() const;
+  public:
+  void clear_obsspace();
+  const ::ns3opengym::SpaceDescription& obsspace() const;
+  PROTOBUF_NODISCARD ::ns3opengym::SpaceDescription* release_obsspace();
+  ::ns3opengym::SpaceDescription* mutable_obsspace();
+  void set_allocated_obsspace(::ns3opengym::SpaceDescription* obsspace);
+  private:
+  const ::ns3opengym::SpaceDescription& _internal_obsspace() const;
+  ::ns3opengym::SpaceDescription* _internal_mutable_obsspace();
+  public:
+  void unsafe_arena_set_allocated_obsspace(
+      ::ns3opengym::SpaceDescription* obsspace);
+  ::ns3opengym::SpaceDescription* unsafe_arena_release_obsspace();
+
+  // .ns3opengym.SpaceDescription actSpace = 4;
+  bool has_actspace() const;
+  private:
+  bool _internal_has_actspace() const;
+  public:
+  void clear_actspace();
+  const ::ns3opengym::SpaceDescription& actspace() const;
+  PROTOBUF_NODISCARD ::ns3opengym::SpaceDescription* release_actspace();
+  ::ns3opengym::SpaceDescription* mutable_actspace();
+  void set_allocated_actspace(::ns3opengym::SpaceDescription* actspace);
+  private:
+  const ::ns3opengym::SpaceDescription& _internal_actspace() const;
+  ::ns3opengym::SpaceDescription* _internal_mutable_actspace();
+  public:
+  void unsafe_arena_set_allocated_actspace(
+      ::ns3opengym::SpaceDescription* actspace);
+  ::ns3opengym::SpaceDescription* unsafe_arena_release_actspace();
+
+  // uint64 simProcessId = 1;
+  void clear_simprocessid();
+  uint64_t simprocessid() const;
+  void set_simprocessid(uint64_t value);
+  private:
+  uint64_t _internal_simprocessid() const;
+  void _internal_set_simprocessid(uint64_t value);
+  public:
+
+  // uint64 wafShellProcessId = 2;
+  void clear_wafshellprocessid();
+  uint64_t wafshellprocessid() const;
+  void set_wafshellprocessid(uint64_t value);
+  private:
+  uint64_t _internal_wafshellprocessid() const;
+  void _internal_set_wafshellprocessid(uint64_t value);
+  public:
+
+  // uint64 restoredSnapshot = 8;
+  void clear_restoredsnapshot();
+  uint64_t restoredsnapshot() const;
+  void set_restoredsnapshot(uint64_t value);
+  private:
+  uint64_t _internal_restoredsnapshot() const;
+  void _internal_set_restoredsnapshot(uint64_t value);
+  public:
+
+  // bool forkServer = 6;
+  void clear_forkserver();
+  bool forkserver() const;
+  void set_forkserver(bool value);
+  private:
+  bool _internal_forkserver() const;
+  void _internal_set_forkserver(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.SimInitMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentSpaceDescription > agents_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr shmname_;
+    ::ns3opengym::SpaceDescription* obsspace_;
+    ::ns3opengym::SpaceDescription* actspace_;
+    uint64_t simprocessid_;
+    uint64_t wafshellprocessid_;
+    uint64_t restoredsnapshot_;
+    bool forkserver_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SimInitAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.SimInitAck) */ {
+ public:
+  inline SimInitAck() : SimInitAck(nullptr) {}
+  ~SimInitAck() override;
+  explicit PROTOBUF_CONSTEXPR SimInitAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SimInitAck(const SimInitAck& from);
+  SimInitAck(SimInitAck&& from) noexcept
+    : SimInitAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SimInitAck& operator=(const SimInitAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SimInitAck& operator=(SimInitAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SimInitAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SimInitAck* internal_default_instance() {
+    return reinterpret_cast<const SimInitAck*>(
+               &_SimInitAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SimInitAck& a, SimInitAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SimInitAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SimInitAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SimInitAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SimInitAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SimInitAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SimInitAck& from) {
+    SimInitAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SimInitAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.SimInitAck";
+  }
+  protected:
+  explicit SimInitAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDoneFieldNumber = 1,
+    kStopSimReqFieldNumber = 2,
+    kShmAttachedFieldNumber = 3,
+  };
+  // bool done = 1;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // bool stopSimReq = 2;
+  void clear_stopsimreq();
+  bool stopsimreq() const;
+  void set_stopsimreq(bool value);
+  private:
+  bool _internal_stopsimreq() const;
+  void _internal_set_stopsimreq(bool value);
+  public:
+
+  // bool shmAttached = 3;
+  void clear_shmattached();
+  bool shmattached() const;
+  void set_shmattached(bool value);
+  private:
+  bool _internal_shmattached() const;
+  void _internal_set_shmattached(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.SimInitAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool done_;
+    bool stopsimreq_;
+    bool shmattached_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AgentState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.AgentState) */ {
+ public:
+  inline AgentState() : AgentState(nullptr) {}
+  ~AgentState() override;
+  explicit PROTOBUF_CONSTEXPR AgentState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AgentState(const AgentState& from);
+  AgentState(AgentState&& from) noexcept
+    : AgentState() {
+    *this = ::std::move(from);
+  }
+
+  inline AgentState& operator=(const AgentState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AgentState& operator=(AgentState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AgentState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AgentState* internal_default_instance() {
+    return reinterpret_cast<const AgentState*>(
+               &_AgentState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(AgentState& a, AgentState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AgentState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AgentState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AgentState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AgentState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AgentState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AgentState& from) {
+    AgentState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AgentState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.AgentState";
+  }
+  protected:
+  explicit AgentState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInfoFieldNumber = 5,
+    kObsDataFieldNumber = 2,
+    kAgentIdFieldNumber = 1,
+    kRewardFieldNumber = 3,
+    kIsGameOverFieldNumber = 4,
+  };
+  // string info = 5;
+  void clear_info();
+  const std::string& info() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_info(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_info();
+  PROTOBUF_NODISCARD std::string* release_info();
+  void set_allocated_info(std::string* info);
+  private:
+  const std::string& _internal_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_info(const std::string& value);
+  std::string* _internal_mutable_info();
+  public:
+
+  // .ns3opengym.DataContainer obsData = 2;
+  bool has_obsdata() const;
+  private:
+  bool _internal_has_obsdata() const;
+  public:
+  void clear_obsdata();
+  const ::ns3opengym::DataContainer& obsdata() const;
+  PROTOBUF_NODISCARD ::ns3opengym::DataContainer* release_obsdata();
+  ::ns3opengym::DataContainer* mutable_obsdata();
+  void set_allocated_obsdata(::ns3opengym::DataContainer* obsdata);
+  private:
+  const ::ns3opengym::DataContainer& _internal_obsdata() const;
+  ::ns3opengym::DataContainer* _internal_mutable_obsdata();
+  public:
+  void unsafe_arena_set_allocated_obsdata(
+      ::ns3opengym::DataContainer* obsdata);
+  ::ns3opengym::DataContainer* unsafe_arena_release_obsdata();
+
+  // uint32 agentId = 1;
+  void clear_agentid();
+  uint32_t agentid() const;
+  void set_agentid(uint32_t value);
+  private:
+  uint32_t _internal_agentid() const;
+  void _internal_set_agentid(uint32_t value);
+  public:
+
+  // float reward = 3;
+  void clear_reward();
+  float reward() const;
+  void set_reward(float value);
+  private:
+  float _internal_reward() const;
+  void _internal_set_reward(float value);
+  public:
+
+  // bool isGameOver = 4;
+  void clear_isgameover();
+  bool isgameover() const;
+  void set_isgameover(bool value);
+  private:
+  bool _internal_isgameover() const;
+  void _internal_set_isgameover(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.AgentState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr info_;
+    ::ns3opengym::DataContainer* obsdata_;
+    uint32_t agentid_;
+    float reward_;
+    bool isgameover_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AgentAct final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.AgentAct) */ {
+ public:
+  inline AgentAct() : AgentAct(nullptr) {}
+  ~AgentAct() override;
+  explicit PROTOBUF_CONSTEXPR AgentAct(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AgentAct(const AgentAct& from);
+  AgentAct(AgentAct&& from) noexcept
+    : AgentAct() {
+    *this = ::std::move(from);
+  }
+
+  inline AgentAct& operator=(const AgentAct& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AgentAct& operator=(AgentAct&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AgentAct& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AgentAct* internal_default_instance() {
+    return reinterpret_cast<const AgentAct*>(
+               &_AgentAct_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(AgentAct& a, AgentAct& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AgentAct* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AgentAct* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AgentAct* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AgentAct>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AgentAct& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AgentAct& from) {
+    AgentAct::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AgentAct* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.AgentAct";
+  }
+  protected:
+  explicit AgentAct(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kActDataFieldNumber = 2,
+    kAgentIdFieldNumber = 1,
+  };
+  // .ns3opengym.DataContainer actData = 2;
+  bool has_actdata() const;
+  private:
+  bool _internal_has_actdata() const;
+  public:
+  void clear_actdata();
+  const ::ns3opengym::DataContainer& actdata() const;
+  PROTOBUF_NODISCARD ::ns3opengym::DataContainer* release_actdata();
+  ::ns3opengym::DataContainer* mutable_actdata();
+  void set_allocated_actdata(::ns3opengym::DataContainer* actdata);
+  private:
+  const ::ns3opengym::DataContainer& _internal_actdata() const;
+  ::ns3opengym::DataContainer* _internal_mutable_actdata();
+  public:
+  void unsafe_arena_set_allocated_actdata(
+      ::ns3opengym::DataContainer* actdata);
+  ::ns3opengym::DataContainer* unsafe_arena_release_actdata();
+
+  // uint32 agentId = 1;
+  void clear_agentid();
+  uint32_t agentid() const;
+  void set_agentid(uint32_t value);
+  private:
+  uint32_t _internal_agentid() const;
+  void _internal_set_agentid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.AgentAct)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::ns3opengym::DataContainer* actdata_;
+    uint32_t agentid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EnvStateMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.EnvStateMsg) */ {
+ public:
+  inline EnvStateMsg() : EnvStateMsg(nullptr) {}
+  ~EnvStateMsg() override;
+  explicit PROTOBUF_CONSTEXPR EnvStateMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EnvStateMsg(const EnvStateMsg& from);
+  EnvStateMsg(EnvStateMsg&& from) noexcept
+    : EnvStateMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline EnvStateMsg& operator=(const EnvStateMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EnvStateMsg& operator=(EnvStateMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EnvStateMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EnvStateMsg* internal_default_instance() {
+    return reinterpret_cast<const EnvStateMsg*>(
+               &_EnvStateMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(EnvStateMsg& a, EnvStateMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EnvStateMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EnvStateMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EnvStateMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EnvStateMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EnvStateMsg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EnvStateMsg& from) {
+    EnvStateMsg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EnvStateMsg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.EnvStateMsg";
+  }
+  protected:
+  explicit EnvStateMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef EnvStateMsg_Reason Reason;
+  static constexpr Reason SimulationEnd =
+    EnvStateMsg_Reason_SimulationEnd;
+  static constexpr Reason GameOver =
+    EnvStateMsg_Reason_GameOver;
+  static inline bool Reason_IsValid(int value) {
+    return EnvStateMsg_Reason_IsValid(value);
+  }
+  static constexpr Reason Reason_MIN =
+    EnvStateMsg_Reason_Reason_MIN;
+  static constexpr Reason Reason_MAX =
+    EnvStateMsg_Reason_Reason_MAX;
+  static constexpr int Reason_ARRAYSIZE =
+    EnvStateMsg_Reason_Reason_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Reason_descriptor() {
+    return EnvStateMsg_Reason_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Reason_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Reason>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Reason_Name.");
+    return EnvStateMsg_Reason_Name(enum_t_value);
+  }
+  static inline bool Reason_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Reason* value) {
+    return EnvStateMsg_Reason_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAgentsFieldNumber = 6,
+    kInfoFieldNumber = 5,
+    kObsDataFieldNumber = 1,
+    kRewardFieldNumber = 2,
+    kIsGameOverFieldNumber = 3,
+    kSnapshotIdFieldNumber = 7,
+    kReasonFieldNumber = 4,
+  };
+  // repeated .ns3opengym.AgentState agents = 6;
+  int agents_size() const;
+  private:
+  int _internal_agents_size() const;
+  public:
+  void clear_agents();
+  ::ns3opengym::AgentState* mutable_agents(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentState >*
+      mutable_agents();
+  private:
+  const ::ns3opengym::AgentState& _internal_agents(int index) const;
+  ::ns3opengym::AgentState* _internal_add_agents();
+  public:
+  const ::ns3opengym::AgentState& agents(int index) const;
+  ::ns3opengym::AgentState* add_agents();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentState >&
+      agents() const;
+
+  // string info = 5;
+  void clear_info();
+  const std::string& info() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_info(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_info();
+  PROTOBUF_NODISCARD std::string* release_info();
+  void set_allocated_info(std::string* info);
+  private:
+  const std::string& _internal_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_info(const std::string& value);
+  std::string* _internal_mutable_info();
+  public:
+
+  // .ns3opengym.DataContainer obsData = 1;
+  bool has_obsdata() const;
+  private:
+  bool _internal_has_obsdata() const;
+  public:
+  void clear_obsdata();
+  const ::ns3opengym::DataContainer& obsdata() const;
+  PROTOBUF_NODISCARD ::ns3opengym::DataContainer* release_obsdata();
+  ::ns3opengym::DataContainer* mutable_obsdata();
+  void set_allocated_obsdata(::ns3opengym::DataContainer* obsdata);
+  private:
+  const ::ns3opengym::DataContainer& _internal_obsdata() const;
+  ::ns3opengym::DataContainer* _internal_mutable_obsdata();
+  public:
+  void unsafe_arena_set_allocated_obsdata(
+      ::ns3opengym::DataContainer* obsdata);
+  ::ns3opengym::DataContainer* unsafe_arena_release_obsdata();
+
+  // float reward = 2;
+  void clear_reward();
+  float reward() const;
+  void set_reward(float value);
+  private:
+  float _internal_reward() const;
+  void _internal_set_reward(float value);
+  public:
+
+  // bool isGameOver = 3;
+  void clear_isgameover();
+  bool isgameover() const;
+  void set_isgameover(bool value);
+  private:
+  bool _internal_isgameover() const;
+  void _internal_set_isgameover(bool value);
+  public:
+
+  // uint64 snapshotId = 7;
+  void clear_snapshotid();
+  uint64_t snapshotid() const;
+  void set_snapshotid(uint64_t value);
+  private:
+  uint64_t _internal_snapshotid() const;
+  void _internal_set_snapshotid(uint64_t value);
+  public:
+
+  // .ns3opengym.EnvStateMsg.Reason reason = 4;
+  void clear_reason();
+  ::ns3opengym::EnvStateMsg_Reason reason() const;
+  void set_reason(::ns3opengym::EnvStateMsg_Reason value);
+  private:
+  ::ns3opengym::EnvStateMsg_Reason _internal_reason() const;
+  void _internal_set_reason(::ns3opengym::EnvStateMsg_Reason value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.EnvStateMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentState > agents_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr info_;
+    ::ns3opengym::DataContainer* obsdata_;
+    float reward_;
+    bool isgameover_;
+    uint64_t snapshotid_;
+    int reason_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EnvActMsg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ns3opengym.EnvActMsg) */ {
+ public:
+  inline EnvActMsg() : EnvActMsg(nullptr) {}
+  ~EnvActMsg() override;
+  explicit PROTOBUF_CONSTEXPR EnvActMsg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EnvActMsg(const EnvActMsg& from);
+  EnvActMsg(EnvActMsg&& from) noexcept
+    : EnvActMsg() {
+    *this = ::std::move(from);
+  }
+
+  inline EnvActMsg& operator=(const EnvActMsg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EnvActMsg& operator=(EnvActMsg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EnvActMsg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EnvActMsg* internal_default_instance() {
+    return reinterpret_cast<const EnvActMsg*>(
+               &_EnvActMsg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(EnvActMsg& a, EnvActMsg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EnvActMsg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EnvActMsg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EnvActMsg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EnvActMsg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EnvActMsg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EnvActMsg& from) {
+    EnvActMsg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EnvActMsg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ns3opengym.EnvActMsg";
+  }
+  protected:
+  explicit EnvActMsg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef EnvActMsg_SnapshotCmd SnapshotCmd;
+  static constexpr SnapshotCmd NoSnapshotCmd =
+    EnvActMsg_SnapshotCmd_NoSnapshotCmd;
+  static constexpr SnapshotCmd SaveSnapshot =
+    EnvActMsg_SnapshotCmd_SaveSnapshot;
+  static constexpr SnapshotCmd RestoreSnapshot =
+    EnvActMsg_SnapshotCmd_RestoreSnapshot;
+  static constexpr SnapshotCmd ReleaseSnapshot =
+    EnvActMsg_SnapshotCmd_ReleaseSnapshot;
+  static inline bool SnapshotCmd_IsValid(int value) {
+    return EnvActMsg_SnapshotCmd_IsValid(value);
+  }
+  static constexpr SnapshotCmd SnapshotCmd_MIN =
+    EnvActMsg_SnapshotCmd_SnapshotCmd_MIN;
+  static constexpr SnapshotCmd SnapshotCmd_MAX =
+    EnvActMsg_SnapshotCmd_SnapshotCmd_MAX;
+  static constexpr int SnapshotCmd_ARRAYSIZE =
+    EnvActMsg_SnapshotCmd_SnapshotCmd_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  SnapshotCmd_descriptor() {
+    return EnvActMsg_SnapshotCmd_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& SnapshotCmd_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, SnapshotCmd>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function SnapshotCmd_Name.");
+    return EnvActMsg_SnapshotCmd_Name(enum_t_value);
+  }
+  static inline bool SnapshotCmd_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      SnapshotCmd* value) {
+    return EnvActMsg_SnapshotCmd_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAgentsFieldNumber = 3,
+    kActDataFieldNumber = 1,
+    kStopSimReqFieldNumber = 2,
+    kSnapshotCmdFieldNumber = 4,
+    kSnapshotIdFieldNumber = 5,
+  };
+  // repeated .ns3opengym.AgentAct agents = 3;
+  int agents_size() const;
+  private:
+  int _internal_agents_size() const;
+  public:
+  void clear_agents();
+  ::ns3opengym::AgentAct* mutable_agents(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentAct >*
+      mutable_agents();
+  private:
+  const ::ns3opengym::AgentAct& _internal_agents(int index) const;
+  ::ns3opengym::AgentAct* _internal_add_agents();
+  public:
+  const ::ns3opengym::AgentAct& agents(int index) const;
+  ::ns3opengym::AgentAct* add_agents();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentAct >&
+      agents() const;
+
+  // .ns3opengym.DataContainer actData = 1;
+  bool has_actdata() const;
+  private:
+  bool _internal_has_actdata() const;
+  public:
+  void clear_actdata();
+  const ::ns3opengym::DataContainer& actdata() const;
+  PROTOBUF_NODISCARD ::ns3opengym::DataContainer* release_actdata();
+  ::ns3opengym::DataContainer* mutable_actdata();
+  void set_allocated_actdata(::ns3opengym::DataContainer* actdata);
+  private:
+  const ::ns3opengym::DataContainer& _internal_actdata() const;
+  ::ns3opengym::DataContainer* _internal_mutable_actdata();
+  public:
+  void unsafe_arena_set_allocated_actdata(
+      ::ns3opengym::DataContainer* actdata);
+  ::ns3opengym::DataContainer* unsafe_arena_release_actdata();
+
+  // bool stopSimReq = 2;
+  void clear_stopsimreq();
+  bool stopsimreq() const;
+  void set_stopsimreq(bool value);
+  private:
+  bool _internal_stopsimreq() const;
+  void _internal_set_stopsimreq(bool value);
+  public:
+
+  // .ns3opengym.EnvActMsg.SnapshotCmd snapshotCmd = 4;
+  void clear_snapshotcmd();
+  ::ns3opengym::EnvActMsg_SnapshotCmd snapshotcmd() const;
+  void set_snapshotcmd(::ns3opengym::EnvActMsg_SnapshotCmd value);
+  private:
+  ::ns3opengym::EnvActMsg_SnapshotCmd _internal_snapshotcmd() const;
+  void _internal_set_snapshotcmd(::ns3opengym::EnvActMsg_SnapshotCmd value);
+  public:
+
+  // uint64 snapshotId = 5;
+  void clear_snapshotid();
+  uint64_t snapshotid() const;
+  void set_snapshotid(uint64_t value);
+  private:
+  uint64_t _internal_snapshotid() const;
+  void _internal_set_snapshotid(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ns3opengym.EnvActMsg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentAct > agents_;
+    ::ns3opengym::DataContainer* actdata_;
+    bool stopsimreq_;
+    int snapshotcmd_;
+    uint64_t snapshotid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SpaceDescription
+
+// .ns3opengym.SpaceType type = 1;
+inline void SpaceDescription::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::ns3opengym::SpaceType SpaceDescription::_internal_type() const {
+  return static_cast< ::ns3opengym::SpaceType >(_impl_.type_);
+}
+inline ::ns3opengym::SpaceType SpaceDescription::type() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SpaceDescription.type)
+  return _internal_type();
+}
+inline void SpaceDescription::_internal_set_type(::ns3opengym::SpaceType value) {
+  
+  _impl_.type_ = value;
+}
+inline void SpaceDescription::set_type(::ns3opengym::SpaceType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SpaceDescription.type)
+}
+
+// .google.protobuf.Any space = 2;
+inline bool SpaceDescription::_internal_has_space() const {
+  return this != internal_default_instance() && _impl_.space_ != nullptr;
+}
+inline bool SpaceDescription::has_space() const {
+  return _internal_has_space();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Any& SpaceDescription::_internal_space() const {
+  const ::PROTOBUF_NAMESPACE_ID::Any* p = _impl_.space_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Any&>(
+      ::PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Any& SpaceDescription::space() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SpaceDescription.space)
+  return _internal_space();
+}
+inline void SpaceDescription::unsafe_arena_set_allocated_space(
+    ::PROTOBUF_NAMESPACE_ID::Any* space) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.space_);
+  }
+  _impl_.space_ = space;
+  if (space) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.SpaceDescription.space)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* SpaceDescription::release_space() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Any* temp = _impl_.space_;
+  _impl_.space_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* SpaceDescription::unsafe_arena_release_space() {
+  // @@protoc_insertion_point(field_release:ns3opengym.SpaceDescription.space)
+  
+  ::PROTOBUF_NAMESPACE_ID::Any* temp = _impl_.space_;
+  _impl_.space_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* SpaceDescription::_internal_mutable_space() {
+  
+  if (_impl_.space_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Any>(GetArenaForAllocation());
+    _impl_.space_ = p;
+  }
+  return _impl_.space_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* SpaceDescription::mutable_space() {
+  ::PROTOBUF_NAMESPACE_ID::Any* _msg = _internal_mutable_space();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.SpaceDescription.space)
+  return _msg;
+}
+inline void SpaceDescription::set_allocated_space(::PROTOBUF_NAMESPACE_ID::Any* space) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.space_);
+  }
+  if (space) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(space));
+    if (message_arena != submessage_arena) {
+      space = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, space, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.space_ = space;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.SpaceDescription.space)
+}
+
+// string name = 3;
+inline void SpaceDescription::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SpaceDescription::name() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SpaceDescription.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpaceDescription::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3opengym.SpaceDescription.name)
+}
+inline std::string* SpaceDescription::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.SpaceDescription.name)
+  return _s;
+}
+inline const std::string& SpaceDescription::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SpaceDescription::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpaceDescription::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpaceDescription::release_name() {
+  // @@protoc_insertion_point(field_release:ns3opengym.SpaceDescription.name)
+  return _impl_.name_.Release();
+}
+inline void SpaceDescription::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.SpaceDescription.name)
+}
+
+// -------------------------------------------------------------------
+
+// DiscreteSpace
+
+// int32 n = 1;
+inline void DiscreteSpace::clear_n() {
+  _impl_.n_ = 0;
+}
+inline int32_t DiscreteSpace::_internal_n() const {
+  return _impl_.n_;
+}
+inline int32_t DiscreteSpace::n() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DiscreteSpace.n)
+  return _internal_n();
+}
+inline void DiscreteSpace::_internal_set_n(int32_t value) {
+  
+  _impl_.n_ = value;
+}
+inline void DiscreteSpace::set_n(int32_t value) {
+  _internal_set_n(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.DiscreteSpace.n)
+}
+
+// -------------------------------------------------------------------
+
+// BoxSpace
+
+// float low = 1;
+inline void BoxSpace::clear_low() {
+  _impl_.low_ = 0;
+}
+inline float BoxSpace::_internal_low() const {
+  return _impl_.low_;
+}
+inline float BoxSpace::low() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxSpace.low)
+  return _internal_low();
+}
+inline void BoxSpace::_internal_set_low(float value) {
+  
+  _impl_.low_ = value;
+}
+inline void BoxSpace::set_low(float value) {
+  _internal_set_low(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxSpace.low)
+}
+
+// float high = 2;
+inline void BoxSpace::clear_high() {
+  _impl_.high_ = 0;
+}
+inline float BoxSpace::_internal_high() const {
+  return _impl_.high_;
+}
+inline float BoxSpace::high() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxSpace.high)
+  return _internal_high();
+}
+inline void BoxSpace::_internal_set_high(float value) {
+  
+  _impl_.high_ = value;
+}
+inline void BoxSpace::set_high(float value) {
+  _internal_set_high(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxSpace.high)
+}
+
+// .ns3opengym.Dtype dtype = 3;
+inline void BoxSpace::clear_dtype() {
+  _impl_.dtype_ = 0;
+}
+inline ::ns3opengym::Dtype BoxSpace::_internal_dtype() const {
+  return static_cast< ::ns3opengym::Dtype >(_impl_.dtype_);
+}
+inline ::ns3opengym::Dtype BoxSpace::dtype() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxSpace.dtype)
+  return _internal_dtype();
+}
+inline void BoxSpace::_internal_set_dtype(::ns3opengym::Dtype value) {
+  
+  _impl_.dtype_ = value;
+}
+inline void BoxSpace::set_dtype(::ns3opengym::Dtype value) {
+  _internal_set_dtype(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxSpace.dtype)
+}
+
+// repeated uint32 shape = 4;
+inline int BoxSpace::_internal_shape_size() const {
+  return _impl_.shape_.size();
+}
+inline int BoxSpace::shape_size() const {
+  return _internal_shape_size();
+}
+inline void BoxSpace::clear_shape() {
+  _impl_.shape_.Clear();
+}
+inline uint32_t BoxSpace::_internal_shape(int index) const {
+  return _impl_.shape_.Get(index);
+}
+inline uint32_t BoxSpace::shape(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxSpace.shape)
+  return _internal_shape(index);
+}
+inline void BoxSpace::set_shape(int index, uint32_t value) {
+  _impl_.shape_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxSpace.shape)
+}
+inline void BoxSpace::_internal_add_shape(uint32_t value) {
+  _impl_.shape_.Add(value);
+}
+inline void BoxSpace::add_shape(uint32_t value) {
+  _internal_add_shape(value);
+  // @@protoc_insertion_point(field_add:ns3opengym.BoxSpace.shape)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+BoxSpace::_internal_shape() const {
+  return _impl_.shape_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+BoxSpace::shape() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.BoxSpace.shape)
+  return _internal_shape();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+BoxSpace::_internal_mutable_shape() {
+  return &_impl_.shape_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+BoxSpace::mutable_shape() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.BoxSpace.shape)
+  return _internal_mutable_shape();
+}
+
+// -------------------------------------------------------------------
+
+// TupleSpace
+
+// repeated .ns3opengym.SpaceDescription element = 1;
+inline int TupleSpace::_internal_element_size() const {
+  return _impl_.element_.size();
+}
+inline int TupleSpace::element_size() const {
+  return _internal_element_size();
+}
+inline void TupleSpace::clear_element() {
+  _impl_.element_.Clear();
+}
+inline ::ns3opengym::SpaceDescription* TupleSpace::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.TupleSpace.element)
+  return _impl_.element_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >*
+TupleSpace::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.TupleSpace.element)
+  return &_impl_.element_;
+}
+inline const ::ns3opengym::SpaceDescription& TupleSpace::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
+}
+inline const ::ns3opengym::SpaceDescription& TupleSpace::element(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.TupleSpace.element)
+  return _internal_element(index);
+}
+inline ::ns3opengym::SpaceDescription* TupleSpace::_internal_add_element() {
+  return _impl_.element_.Add();
+}
+inline ::ns3opengym::SpaceDescription* TupleSpace::add_element() {
+  ::ns3opengym::SpaceDescription* _add = _internal_add_element();
+  // @@protoc_insertion_point(field_add:ns3opengym.TupleSpace.element)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >&
+TupleSpace::element() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.TupleSpace.element)
+  return _impl_.element_;
+}
+
+// -------------------------------------------------------------------
+
+// DictSpace
+
+// repeated .ns3opengym.SpaceDescription element = 1;
+inline int DictSpace::_internal_element_size() const {
+  return _impl_.element_.size();
+}
+inline int DictSpace::element_size() const {
+  return _internal_element_size();
+}
+inline void DictSpace::clear_element() {
+  _impl_.element_.Clear();
+}
+inline ::ns3opengym::SpaceDescription* DictSpace::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.DictSpace.element)
+  return _impl_.element_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >*
+DictSpace::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.DictSpace.element)
+  return &_impl_.element_;
+}
+inline const ::ns3opengym::SpaceDescription& DictSpace::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
+}
+inline const ::ns3opengym::SpaceDescription& DictSpace::element(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DictSpace.element)
+  return _internal_element(index);
+}
+inline ::ns3opengym::SpaceDescription* DictSpace::_internal_add_element() {
+  return _impl_.element_.Add();
+}
+inline ::ns3opengym::SpaceDescription* DictSpace::add_element() {
+  ::ns3opengym::SpaceDescription* _add = _internal_add_element();
+  // @@protoc_insertion_point(field_add:ns3opengym.DictSpace.element)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::SpaceDescription >&
+DictSpace::element() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.DictSpace.element)
+  return _impl_.element_;
+}
+
+// -------------------------------------------------------------------
+
+// DataContainer
+
+// .ns3opengym.SpaceType type = 1;
+inline void DataContainer::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::ns3opengym::SpaceType DataContainer::_internal_type() const {
+  return static_cast< ::ns3opengym::SpaceType >(_impl_.type_);
+}
+inline ::ns3opengym::SpaceType DataContainer::type() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DataContainer.type)
+  return _internal_type();
+}
+inline void DataContainer::_internal_set_type(::ns3opengym::SpaceType value) {
+  
+  _impl_.type_ = value;
+}
+inline void DataContainer::set_type(::ns3opengym::SpaceType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.DataContainer.type)
+}
+
+// .google.protobuf.Any data = 2;
+inline bool DataContainer::_internal_has_data() const {
+  return this != internal_default_instance() && _impl_.data_ != nullptr;
+}
+inline bool DataContainer::has_data() const {
+  return _internal_has_data();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Any& DataContainer::_internal_data() const {
+  const ::PROTOBUF_NAMESPACE_ID::Any* p = _impl_.data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Any&>(
+      ::PROTOBUF_NAMESPACE_ID::_Any_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Any& DataContainer::data() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DataContainer.data)
+  return _internal_data();
+}
+inline void DataContainer::unsafe_arena_set_allocated_data(
+    ::PROTOBUF_NAMESPACE_ID::Any* data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
+  }
+  _impl_.data_ = data;
+  if (data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.DataContainer.data)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* DataContainer::release_data() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Any* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* DataContainer::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_release:ns3opengym.DataContainer.data)
+  
+  ::PROTOBUF_NAMESPACE_ID::Any* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* DataContainer::_internal_mutable_data() {
+  
+  if (_impl_.data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Any>(GetArenaForAllocation());
+    _impl_.data_ = p;
+  }
+  return _impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Any* DataContainer::mutable_data() {
+  ::PROTOBUF_NAMESPACE_ID::Any* _msg = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.DataContainer.data)
+  return _msg;
+}
+inline void DataContainer::set_allocated_data(::PROTOBUF_NAMESPACE_ID::Any* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(data));
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.DataContainer.data)
+}
+
+// string name = 3;
+inline void DataContainer::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& DataContainer::name() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DataContainer.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DataContainer::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3opengym.DataContainer.name)
+}
+inline std::string* DataContainer::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.DataContainer.name)
+  return _s;
+}
+inline const std::string& DataContainer::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void DataContainer::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DataContainer::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DataContainer::release_name() {
+  // @@protoc_insertion_point(field_release:ns3opengym.DataContainer.name)
+  return _impl_.name_.Release();
+}
+inline void DataContainer::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.DataContainer.name)
+}
+
+// -------------------------------------------------------------------
+
+// DiscreteDataContainer
+
+// int32 data = 1;
+inline void DiscreteDataContainer::clear_data() {
+  _impl_.data_ = 0;
+}
+inline int32_t DiscreteDataContainer::_internal_data() const {
+  return _impl_.data_;
+}
+inline int32_t DiscreteDataContainer::data() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DiscreteDataContainer.data)
+  return _internal_data();
+}
+inline void DiscreteDataContainer::_internal_set_data(int32_t value) {
+  
+  _impl_.data_ = value;
+}
+inline void DiscreteDataContainer::set_data(int32_t value) {
+  _internal_set_data(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.DiscreteDataContainer.data)
+}
+
+// -------------------------------------------------------------------
+
+// BoxDataContainer
+
+// .ns3opengym.Dtype dtype = 1;
+inline void BoxDataContainer::clear_dtype() {
+  _impl_.dtype_ = 0;
+}
+inline ::ns3opengym::Dtype BoxDataContainer::_internal_dtype() const {
+  return static_cast< ::ns3opengym::Dtype >(_impl_.dtype_);
+}
+inline ::ns3opengym::Dtype BoxDataContainer::dtype() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.dtype)
+  return _internal_dtype();
+}
+inline void BoxDataContainer::_internal_set_dtype(::ns3opengym::Dtype value) {
+  
+  _impl_.dtype_ = value;
+}
+inline void BoxDataContainer::set_dtype(::ns3opengym::Dtype value) {
+  _internal_set_dtype(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.dtype)
+}
+
+// repeated uint32 shape = 2;
+inline int BoxDataContainer::_internal_shape_size() const {
+  return _impl_.shape_.size();
+}
+inline int BoxDataContainer::shape_size() const {
+  return _internal_shape_size();
+}
+inline void BoxDataContainer::clear_shape() {
+  _impl_.shape_.Clear();
+}
+inline uint32_t BoxDataContainer::_internal_shape(int index) const {
+  return _impl_.shape_.Get(index);
+}
+inline uint32_t BoxDataContainer::shape(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.shape)
+  return _internal_shape(index);
+}
+inline void BoxDataContainer::set_shape(int index, uint32_t value) {
+  _impl_.shape_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.shape)
+}
+inline void BoxDataContainer::_internal_add_shape(uint32_t value) {
+  _impl_.shape_.Add(value);
+}
+inline void BoxDataContainer::add_shape(uint32_t value) {
+  _internal_add_shape(value);
+  // @@protoc_insertion_point(field_add:ns3opengym.BoxDataContainer.shape)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+BoxDataContainer::_internal_shape() const {
+  return _impl_.shape_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+BoxDataContainer::shape() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.BoxDataContainer.shape)
+  return _internal_shape();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+BoxDataContainer::_internal_mutable_shape() {
+  return &_impl_.shape_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+BoxDataContainer::mutable_shape() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.BoxDataContainer.shape)
+  return _internal_mutable_shape();
+}
+
+// repeated int32 intData = 3;
+inline int BoxDataContainer::_internal_intdata_size() const {
+  return _impl_.intdata_.size();
+}
+inline int BoxDataContainer::intdata_size() const {
+  return _internal_intdata_size();
+}
+inline void BoxDataContainer::clear_intdata() {
+  _impl_.intdata_.Clear();
+}
+inline int32_t BoxDataContainer::_internal_intdata(int index) const {
+  return _impl_.intdata_.Get(index);
+}
+inline int32_t BoxDataContainer::intdata(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.intData)
+  return _internal_intdata(index);
+}
+inline void BoxDataContainer::set_intdata(int index, int32_t value) {
+  _impl_.intdata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.intData)
+}
+inline void BoxDataContainer::_internal_add_intdata(int32_t value) {
+  _impl_.intdata_.Add(value);
+}
+inline void BoxDataContainer::add_intdata(int32_t value) {
+  _internal_add_intdata(value);
+  // @@protoc_insertion_point(field_add:ns3opengym.BoxDataContainer.intData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+BoxDataContainer::_internal_intdata() const {
+  return _impl_.intdata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+BoxDataContainer::intdata() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.BoxDataContainer.intData)
+  return _internal_intdata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+BoxDataContainer::_internal_mutable_intdata() {
+  return &_impl_.intdata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+BoxDataContainer::mutable_intdata() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.BoxDataContainer.intData)
+  return _internal_mutable_intdata();
+}
+
+// repeated uint32 uintData = 4;
+inline int BoxDataContainer::_internal_uintdata_size() const {
+  return _impl_.uintdata_.size();
+}
+inline int BoxDataContainer::uintdata_size() const {
+  return _internal_uintdata_size();
+}
+inline void BoxDataContainer::clear_uintdata() {
+  _impl_.uintdata_.Clear();
+}
+inline uint32_t BoxDataContainer::_internal_uintdata(int index) const {
+  return _impl_.uintdata_.Get(index);
+}
+inline uint32_t BoxDataContainer::uintdata(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.uintData)
+  return _internal_uintdata(index);
+}
+inline void BoxDataContainer::set_uintdata(int index, uint32_t value) {
+  _impl_.uintdata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.uintData)
+}
+inline void BoxDataContainer::_internal_add_uintdata(uint32_t value) {
+  _impl_.uintdata_.Add(value);
+}
+inline void BoxDataContainer::add_uintdata(uint32_t value) {
+  _internal_add_uintdata(value);
+  // @@protoc_insertion_point(field_add:ns3opengym.BoxDataContainer.uintData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+BoxDataContainer::_internal_uintdata() const {
+  return _impl_.uintdata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+BoxDataContainer::uintdata() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.BoxDataContainer.uintData)
+  return _internal_uintdata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+BoxDataContainer::_internal_mutable_uintdata() {
+  return &_impl_.uintdata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+BoxDataContainer::mutable_uintdata() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.BoxDataContainer.uintData)
+  return _internal_mutable_uintdata();
+}
+
+// repeated float floatData = 5;
+inline int BoxDataContainer::_internal_floatdata_size() const {
+  return _impl_.floatdata_.size();
+}
+inline int BoxDataContainer::floatdata_size() const {
+  return _internal_floatdata_size();
+}
+inline void BoxDataContainer::clear_floatdata() {
+  _impl_.floatdata_.Clear();
+}
+inline float BoxDataContainer::_internal_floatdata(int index) const {
+  return _impl_.floatdata_.Get(index);
+}
+inline float BoxDataContainer::floatdata(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.floatData)
+  return _internal_floatdata(index);
+}
+inline void BoxDataContainer::set_floatdata(int index, float value) {
+  _impl_.floatdata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.floatData)
+}
+inline void BoxDataContainer::_internal_add_floatdata(float value) {
+  _impl_.floatdata_.Add(value);
+}
+inline void BoxDataContainer::add_floatdata(float value) {
+  _internal_add_floatdata(value);
+  // @@protoc_insertion_point(field_add:ns3opengym.BoxDataContainer.floatData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+BoxDataContainer::_internal_floatdata() const {
+  return _impl_.floatdata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+BoxDataContainer::floatdata() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.BoxDataContainer.floatData)
+  return _internal_floatdata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+BoxDataContainer::_internal_mutable_floatdata() {
+  return &_impl_.floatdata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+BoxDataContainer::mutable_floatdata() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.BoxDataContainer.floatData)
+  return _internal_mutable_floatdata();
+}
+
+// repeated double doubleData = 6;
+inline int BoxDataContainer::_internal_doubledata_size() const {
+  return _impl_.doubledata_.size();
+}
+inline int BoxDataContainer::doubledata_size() const {
+  return _internal_doubledata_size();
+}
+inline void BoxDataContainer::clear_doubledata() {
+  _impl_.doubledata_.Clear();
+}
+inline double BoxDataContainer::_internal_doubledata(int index) const {
+  return _impl_.doubledata_.Get(index);
+}
+inline double BoxDataContainer::doubledata(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.doubleData)
+  return _internal_doubledata(index);
+}
+inline void BoxDataContainer::set_doubledata(int index, double value) {
+  _impl_.doubledata_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.doubleData)
+}
+inline void BoxDataContainer::_internal_add_doubledata(double value) {
+  _impl_.doubledata_.Add(value);
+}
+inline void BoxDataContainer::add_doubledata(double value) {
+  _internal_add_doubledata(value);
+  // @@protoc_insertion_point(field_add:ns3opengym.BoxDataContainer.doubleData)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+BoxDataContainer::_internal_doubledata() const {
+  return _impl_.doubledata_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+BoxDataContainer::doubledata() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.BoxDataContainer.doubleData)
+  return _internal_doubledata();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+BoxDataContainer::_internal_mutable_doubledata() {
+  return &_impl_.doubledata_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+BoxDataContainer::mutable_doubledata() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.BoxDataContainer.doubleData)
+  return _internal_mutable_doubledata();
+}
+
+// uint64 shmOffset = 7;
+inline void BoxDataContainer::clear_shmoffset() {
+  _impl_.shmoffset_ = uint64_t{0u};
+}
+inline uint64_t BoxDataContainer::_internal_shmoffset() const {
+  return _impl_.shmoffset_;
+}
+inline uint64_t BoxDataContainer::shmoffset() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.shmOffset)
+  return _internal_shmoffset();
+}
+inline void BoxDataContainer::_internal_set_shmoffset(uint64_t value) {
+  
+  _impl_.shmoffset_ = value;
+}
+inline void BoxDataContainer::set_shmoffset(uint64_t value) {
+  _internal_set_shmoffset(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.shmOffset)
+}
+
+// uint64 shmSize = 8;
+inline void BoxDataContainer::clear_shmsize() {
+  _impl_.shmsize_ = uint64_t{0u};
+}
+inline uint64_t BoxDataContainer::_internal_shmsize() const {
+  return _impl_.shmsize_;
+}
+inline uint64_t BoxDataContainer::shmsize() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.shmSize)
+  return _internal_shmsize();
+}
+inline void BoxDataContainer::_internal_set_shmsize(uint64_t value) {
+  
+  _impl_.shmsize_ = value;
+}
+inline void BoxDataContainer::set_shmsize(uint64_t value) {
+  _internal_set_shmsize(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.shmSize)
+}
+
+// bytes rawData = 9;
+inline void BoxDataContainer::clear_rawdata() {
+  _impl_.rawdata_.ClearToEmpty();
+}
+inline const std::string& BoxDataContainer::rawdata() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.BoxDataContainer.rawData)
+  return _internal_rawdata();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BoxDataContainer::set_rawdata(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rawdata_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3opengym.BoxDataContainer.rawData)
+}
+inline std::string* BoxDataContainer::mutable_rawdata() {
+  std::string* _s = _internal_mutable_rawdata();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.BoxDataContainer.rawData)
+  return _s;
+}
+inline const std::string& BoxDataContainer::_internal_rawdata() const {
+  return _impl_.rawdata_.Get();
+}
+inline void BoxDataContainer::_internal_set_rawdata(const std::string& value) {
+  
+  _impl_.rawdata_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BoxDataContainer::_internal_mutable_rawdata() {
+  
+  return _impl_.rawdata_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BoxDataContainer::release_rawdata() {
+  // @@protoc_insertion_point(field_release:ns3opengym.BoxDataContainer.rawData)
+  return _impl_.rawdata_.Release();
+}
+inline void BoxDataContainer::set_allocated_rawdata(std::string* rawdata) {
+  if (rawdata != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rawdata_.SetAllocated(rawdata, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rawdata_.IsDefault()) {
+    _impl_.rawdata_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.BoxDataContainer.rawData)
+}
+
+// -------------------------------------------------------------------
+
+// TupleDataContainer
+
+// repeated .ns3opengym.DataContainer element = 1;
+inline int TupleDataContainer::_internal_element_size() const {
+  return _impl_.element_.size();
+}
+inline int TupleDataContainer::element_size() const {
+  return _internal_element_size();
+}
+inline void TupleDataContainer::clear_element() {
+  _impl_.element_.Clear();
+}
+inline ::ns3opengym::DataContainer* TupleDataContainer::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.TupleDataContainer.element)
+  return _impl_.element_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >*
+TupleDataContainer::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.TupleDataContainer.element)
+  return &_impl_.element_;
+}
+inline const ::ns3opengym::DataContainer& TupleDataContainer::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
+}
+inline const ::ns3opengym::DataContainer& TupleDataContainer::element(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.TupleDataContainer.element)
+  return _internal_element(index);
+}
+inline ::ns3opengym::DataContainer* TupleDataContainer::_internal_add_element() {
+  return _impl_.element_.Add();
+}
+inline ::ns3opengym::DataContainer* TupleDataContainer::add_element() {
+  ::ns3opengym::DataContainer* _add = _internal_add_element();
+  // @@protoc_insertion_point(field_add:ns3opengym.TupleDataContainer.element)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >&
+TupleDataContainer::element() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.TupleDataContainer.element)
+  return _impl_.element_;
+}
+
+// -------------------------------------------------------------------
+
+// DictDataContainer
+
+// repeated .ns3opengym.DataContainer element = 1;
+inline int DictDataContainer::_internal_element_size() const {
+  return _impl_.element_.size();
+}
+inline int DictDataContainer::element_size() const {
+  return _internal_element_size();
+}
+inline void DictDataContainer::clear_element() {
+  _impl_.element_.Clear();
+}
+inline ::ns3opengym::DataContainer* DictDataContainer::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.DictDataContainer.element)
+  return _impl_.element_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >*
+DictDataContainer::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.DictDataContainer.element)
+  return &_impl_.element_;
+}
+inline const ::ns3opengym::DataContainer& DictDataContainer::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
+}
+inline const ::ns3opengym::DataContainer& DictDataContainer::element(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.DictDataContainer.element)
+  return _internal_element(index);
+}
+inline ::ns3opengym::DataContainer* DictDataContainer::_internal_add_element() {
+  return _impl_.element_.Add();
+}
+inline ::ns3opengym::DataContainer* DictDataContainer::add_element() {
+  ::ns3opengym::DataContainer* _add = _internal_add_element();
+  // @@protoc_insertion_point(field_add:ns3opengym.DictDataContainer.element)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::DataContainer >&
+DictDataContainer::element() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.DictDataContainer.element)
+  return _impl_.element_;
+}
+
+// -------------------------------------------------------------------
+
+// AgentSpaceDescription
+
+// uint32 agentId = 1;
+inline void AgentSpaceDescription::clear_agentid() {
+  _impl_.agentid_ = 0u;
+}
+inline uint32_t AgentSpaceDescription::_internal_agentid() const {
+  return _impl_.agentid_;
+}
+inline uint32_t AgentSpaceDescription::agentid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentSpaceDescription.agentId)
+  return _internal_agentid();
+}
+inline void AgentSpaceDescription::_internal_set_agentid(uint32_t value) {
+  
+  _impl_.agentid_ = value;
+}
+inline void AgentSpaceDescription::set_agentid(uint32_t value) {
+  _internal_set_agentid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.AgentSpaceDescription.agentId)
+}
+
+// .ns3opengym.SpaceDescription obsSpace = 2;
+inline bool AgentSpaceDescription::_internal_has_obsspace() const {
+  return this != internal_default_instance() && _impl_.obsspace_ != nullptr;
+}
+inline bool AgentSpaceDescription::has_obsspace() const {
+  return _internal_has_obsspace();
+}
+inline void AgentSpaceDescription::clear_obsspace() {
+  if (GetArenaForAllocation() == nullptr && _impl_.obsspace_ != nullptr) {
+    delete _impl_.obsspace_;
+  }
+  _impl_.obsspace_ = nullptr;
+}
+inline const ::ns3opengym::SpaceDescription& AgentSpaceDescription::_internal_obsspace() const {
+  const ::ns3opengym::SpaceDescription* p = _impl_.obsspace_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::SpaceDescription&>(
+      ::ns3opengym::_SpaceDescription_default_instance_);
+}
+inline const ::ns3opengym::SpaceDescription& AgentSpaceDescription::obsspace() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentSpaceDescription.obsSpace)
+  return _internal_obsspace();
+}
+inline void AgentSpaceDescription::unsafe_arena_set_allocated_obsspace(
+    ::ns3opengym::SpaceDescription* obsspace) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.obsspace_);
+  }
+  _impl_.obsspace_ = obsspace;
+  if (obsspace) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.AgentSpaceDescription.obsSpace)
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::release_obsspace() {
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.obsspace_;
+  _impl_.obsspace_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::unsafe_arena_release_obsspace() {
+  // @@protoc_insertion_point(field_release:ns3opengym.AgentSpaceDescription.obsSpace)
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.obsspace_;
+  _impl_.obsspace_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::_internal_mutable_obsspace() {
+  
+  if (_impl_.obsspace_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::SpaceDescription>(GetArenaForAllocation());
+    _impl_.obsspace_ = p;
+  }
+  return _impl_.obsspace_;
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::mutable_obsspace() {
+  ::ns3opengym::SpaceDescription* _msg = _internal_mutable_obsspace();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.AgentSpaceDescription.obsSpace)
+  return _msg;
+}
+inline void AgentSpaceDescription::set_allocated_obsspace(::ns3opengym::SpaceDescription* obsspace) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.obsspace_;
+  }
+  if (obsspace) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(obsspace);
+    if (message_arena != submessage_arena) {
+      obsspace = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, obsspace, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.obsspace_ = obsspace;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.AgentSpaceDescription.obsSpace)
+}
+
+// .ns3opengym.SpaceDescription actSpace = 3;
+inline bool AgentSpaceDescription::_internal_has_actspace() const {
+  return this != internal_default_instance() && _impl_.actspace_ != nullptr;
+}
+inline bool AgentSpaceDescription::has_actspace() const {
+  return _internal_has_actspace();
+}
+inline void AgentSpaceDescription::clear_actspace() {
+  if (GetArenaForAllocation() == nullptr && _impl_.actspace_ != nullptr) {
+    delete _impl_.actspace_;
+  }
+  _impl_.actspace_ = nullptr;
+}
+inline const ::ns3opengym::SpaceDescription& AgentSpaceDescription::_internal_actspace() const {
+  const ::ns3opengym::SpaceDescription* p = _impl_.actspace_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::SpaceDescription&>(
+      ::ns3opengym::_SpaceDescription_default_instance_);
+}
+inline const ::ns3opengym::SpaceDescription& AgentSpaceDescription::actspace() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentSpaceDescription.actSpace)
+  return _internal_actspace();
+}
+inline void AgentSpaceDescription::unsafe_arena_set_allocated_actspace(
+    ::ns3opengym::SpaceDescription* actspace) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.actspace_);
+  }
+  _impl_.actspace_ = actspace;
+  if (actspace) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.AgentSpaceDescription.actSpace)
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::release_actspace() {
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.actspace_;
+  _impl_.actspace_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::unsafe_arena_release_actspace() {
+  // @@protoc_insertion_point(field_release:ns3opengym.AgentSpaceDescription.actSpace)
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.actspace_;
+  _impl_.actspace_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::_internal_mutable_actspace() {
+  
+  if (_impl_.actspace_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::SpaceDescription>(GetArenaForAllocation());
+    _impl_.actspace_ = p;
+  }
+  return _impl_.actspace_;
+}
+inline ::ns3opengym::SpaceDescription* AgentSpaceDescription::mutable_actspace() {
+  ::ns3opengym::SpaceDescription* _msg = _internal_mutable_actspace();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.AgentSpaceDescription.actSpace)
+  return _msg;
+}
+inline void AgentSpaceDescription::set_allocated_actspace(::ns3opengym::SpaceDescription* actspace) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.actspace_;
+  }
+  if (actspace) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(actspace);
+    if (message_arena != submessage_arena) {
+      actspace = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, actspace, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.actspace_ = actspace;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.AgentSpaceDescription.actSpace)
+}
+
+// -------------------------------------------------------------------
+
+// SimInitMsg
+
+// uint64 simProcessId = 1;
+inline void SimInitMsg::clear_simprocessid() {
+  _impl_.simprocessid_ = uint64_t{0u};
+}
+inline uint64_t SimInitMsg::_internal_simprocessid() const {
+  return _impl_.simprocessid_;
+}
+inline uint64_t SimInitMsg::simprocessid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.simProcessId)
+  return _internal_simprocessid();
+}
+inline void SimInitMsg::_internal_set_simprocessid(uint64_t value) {
+  
+  _impl_.simprocessid_ = value;
+}
+inline void SimInitMsg::set_simprocessid(uint64_t value) {
+  _internal_set_simprocessid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitMsg.simProcessId)
+}
+
+// uint64 wafShellProcessId = 2;
+inline void SimInitMsg::clear_wafshellprocessid() {
+  _impl_.wafshellprocessid_ = uint64_t{0u};
+}
+inline uint64_t SimInitMsg::_internal_wafshellprocessid() const {
+  return _impl_.wafshellprocessid_;
+}
+inline uint64_t SimInitMsg::wafshellprocessid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.wafShellProcessId)
+  return _internal_wafshellprocessid();
+}
+inline void SimInitMsg::_internal_set_wafshellprocessid(uint64_t value) {
+  
+  _impl_.wafshellprocessid_ = value;
+}
+inline void SimInitMsg::set_wafshellprocessid(uint64_t value) {
+  _internal_set_wafshellprocessid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitMsg.wafShellProcessId)
+}
+
+// .ns3opengym.SpaceDescription obsSpace = 3;
+inline bool SimInitMsg::_internal_has_obsspace() const {
+  return this != internal_default_instance() && _impl_.obsspace_ != nullptr;
+}
+inline bool SimInitMsg::has_obsspace() const {
+  return _internal_has_obsspace();
+}
+inline void SimInitMsg::clear_obsspace() {
+  if (GetArenaForAllocation() == nullptr && _impl_.obsspace_ != nullptr) {
+    delete _impl_.obsspace_;
+  }
+  _impl_.obsspace_ = nullptr;
+}
+inline const ::ns3opengym::SpaceDescription& SimInitMsg::_internal_obsspace() const {
+  const ::ns3opengym::SpaceDescription* p = _impl_.obsspace_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::SpaceDescription&>(
+      ::ns3opengym::_SpaceDescription_default_instance_);
+}
+inline const ::ns3opengym::SpaceDescription& SimInitMsg::obsspace() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.obsSpace)
+  return _internal_obsspace();
+}
+inline void SimInitMsg::unsafe_arena_set_allocated_obsspace(
+    ::ns3opengym::SpaceDescription* obsspace) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.obsspace_);
+  }
+  _impl_.obsspace_ = obsspace;
+  if (obsspace) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.SimInitMsg.obsSpace)
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::release_obsspace() {
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.obsspace_;
+  _impl_.obsspace_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::unsafe_arena_release_obsspace() {
+  // @@protoc_insertion_point(field_release:ns3opengym.SimInitMsg.obsSpace)
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.obsspace_;
+  _impl_.obsspace_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::_internal_mutable_obsspace() {
+  
+  if (_impl_.obsspace_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::SpaceDescription>(GetArenaForAllocation());
+    _impl_.obsspace_ = p;
+  }
+  return _impl_.obsspace_;
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::mutable_obsspace() {
+  ::ns3opengym::SpaceDescription* _msg = _internal_mutable_obsspace();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.SimInitMsg.obsSpace)
+  return _msg;
+}
+inline void SimInitMsg::set_allocated_obsspace(::ns3opengym::SpaceDescription* obsspace) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.obsspace_;
+  }
+  if (obsspace) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(obsspace);
+    if (message_arena != submessage_arena) {
+      obsspace = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, obsspace, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.obsspace_ = obsspace;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.SimInitMsg.obsSpace)
+}
+
+// .ns3opengym.SpaceDescription actSpace = 4;
+inline bool SimInitMsg::_internal_has_actspace() const {
+  return this != internal_default_instance() && _impl_.actspace_ != nullptr;
+}
+inline bool SimInitMsg::has_actspace() const {
+  return _internal_has_actspace();
+}
+inline void SimInitMsg::clear_actspace() {
+  if (GetArenaForAllocation() == nullptr && _impl_.actspace_ != nullptr) {
+    delete _impl_.actspace_;
+  }
+  _impl_.actspace_ = nullptr;
+}
+inline const ::ns3opengym::SpaceDescription& SimInitMsg::_internal_actspace() const {
+  const ::ns3opengym::SpaceDescription* p = _impl_.actspace_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::SpaceDescription&>(
+      ::ns3opengym::_SpaceDescription_default_instance_);
+}
+inline const ::ns3opengym::SpaceDescription& SimInitMsg::actspace() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.actSpace)
+  return _internal_actspace();
+}
+inline void SimInitMsg::unsafe_arena_set_allocated_actspace(
+    ::ns3opengym::SpaceDescription* actspace) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.actspace_);
+  }
+  _impl_.actspace_ = actspace;
+  if (actspace) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.SimInitMsg.actSpace)
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::release_actspace() {
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.actspace_;
+  _impl_.actspace_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::unsafe_arena_release_actspace() {
+  // @@protoc_insertion_point(field_release:ns3opengym.SimInitMsg.actSpace)
+  
+  ::ns3opengym::SpaceDescription* temp = _impl_.actspace_;
+  _impl_.actspace_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::_internal_mutable_actspace() {
+  
+  if (_impl_.actspace_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::SpaceDescription>(GetArenaForAllocation());
+    _impl_.actspace_ = p;
+  }
+  return _impl_.actspace_;
+}
+inline ::ns3opengym::SpaceDescription* SimInitMsg::mutable_actspace() {
+  ::ns3opengym::SpaceDescription* _msg = _internal_mutable_actspace();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.SimInitMsg.actSpace)
+  return _msg;
+}
+inline void SimInitMsg::set_allocated_actspace(::ns3opengym::SpaceDescription* actspace) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.actspace_;
+  }
+  if (actspace) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(actspace);
+    if (message_arena != submessage_arena) {
+      actspace = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, actspace, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.actspace_ = actspace;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.SimInitMsg.actSpace)
+}
+
+// string shmName = 5;
+inline void SimInitMsg::clear_shmname() {
+  _impl_.shmname_.ClearToEmpty();
+}
+inline const std::string& SimInitMsg::shmname() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.shmName)
+  return _internal_shmname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SimInitMsg::set_shmname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.shmname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitMsg.shmName)
+}
+inline std::string* SimInitMsg::mutable_shmname() {
+  std::string* _s = _internal_mutable_shmname();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.SimInitMsg.shmName)
+  return _s;
+}
+inline const std::string& SimInitMsg::_internal_shmname() const {
+  return _impl_.shmname_.Get();
+}
+inline void SimInitMsg::_internal_set_shmname(const std::string& value) {
+  
+  _impl_.shmname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SimInitMsg::_internal_mutable_shmname() {
+  
+  return _impl_.shmname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SimInitMsg::release_shmname() {
+  // @@protoc_insertion_point(field_release:ns3opengym.SimInitMsg.shmName)
+  return _impl_.shmname_.Release();
+}
+inline void SimInitMsg::set_allocated_shmname(std::string* shmname) {
+  if (shmname != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.shmname_.SetAllocated(shmname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shmname_.IsDefault()) {
+    _impl_.shmname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.SimInitMsg.shmName)
+}
+
+// bool forkServer = 6;
+inline void SimInitMsg::clear_forkserver() {
+  _impl_.forkserver_ = false;
+}
+inline bool SimInitMsg::_internal_forkserver() const {
+  return _impl_.forkserver_;
+}
+inline bool SimInitMsg::forkserver() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.forkServer)
+  return _internal_forkserver();
+}
+inline void SimInitMsg::_internal_set_forkserver(bool value) {
+  
+  _impl_.forkserver_ = value;
+}
+inline void SimInitMsg::set_forkserver(bool value) {
+  _internal_set_forkserver(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitMsg.forkServer)
+}
+
+// repeated .ns3opengym.AgentSpaceDescription agents = 7;
+inline int SimInitMsg::_internal_agents_size() const {
+  return _impl_.agents_.size();
+}
+inline int SimInitMsg::agents_size() const {
+  return _internal_agents_size();
+}
+inline void SimInitMsg::clear_agents() {
+  _impl_.agents_.Clear();
+}
+inline ::ns3opengym::AgentSpaceDescription* SimInitMsg::mutable_agents(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.SimInitMsg.agents)
+  return _impl_.agents_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentSpaceDescription >*
+SimInitMsg::mutable_agents() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.SimInitMsg.agents)
+  return &_impl_.agents_;
+}
+inline const ::ns3opengym::AgentSpaceDescription& SimInitMsg::_internal_agents(int index) const {
+  return _impl_.agents_.Get(index);
+}
+inline const ::ns3opengym::AgentSpaceDescription& SimInitMsg::agents(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.agents)
+  return _internal_agents(index);
+}
+inline ::ns3opengym::AgentSpaceDescription* SimInitMsg::_internal_add_agents() {
+  return _impl_.agents_.Add();
+}
+inline ::ns3opengym::AgentSpaceDescription* SimInitMsg::add_agents() {
+  ::ns3opengym::AgentSpaceDescription* _add = _internal_add_agents();
+  // @@protoc_insertion_point(field_add:ns3opengym.SimInitMsg.agents)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentSpaceDescription >&
+SimInitMsg::agents() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.SimInitMsg.agents)
+  return _impl_.agents_;
+}
+
+// uint64 restoredSnapshot = 8;
+inline void SimInitMsg::clear_restoredsnapshot() {
+  _impl_.restoredsnapshot_ = uint64_t{0u};
+}
+inline uint64_t SimInitMsg::_internal_restoredsnapshot() const {
+  return _impl_.restoredsnapshot_;
+}
+inline uint64_t SimInitMsg::restoredsnapshot() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitMsg.restoredSnapshot)
+  return _internal_restoredsnapshot();
+}
+inline void SimInitMsg::_internal_set_restoredsnapshot(uint64_t value) {
+  
+  _impl_.restoredsnapshot_ = value;
+}
+inline void SimInitMsg::set_restoredsnapshot(uint64_t value) {
+  _internal_set_restoredsnapshot(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitMsg.restoredSnapshot)
+}
+
+// -------------------------------------------------------------------
+
+// SimInitAck
+
+// bool done = 1;
+inline void SimInitAck::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool SimInitAck::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool SimInitAck::done() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitAck.done)
+  return _internal_done();
+}
+inline void SimInitAck::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void SimInitAck::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitAck.done)
+}
+
+// bool stopSimReq = 2;
+inline void SimInitAck::clear_stopsimreq() {
+  _impl_.stopsimreq_ = false;
+}
+inline bool SimInitAck::_internal_stopsimreq() const {
+  return _impl_.stopsimreq_;
+}
+inline bool SimInitAck::stopsimreq() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitAck.stopSimReq)
+  return _internal_stopsimreq();
+}
+inline void SimInitAck::_internal_set_stopsimreq(bool value) {
+  
+  _impl_.stopsimreq_ = value;
+}
+inline void SimInitAck::set_stopsimreq(bool value) {
+  _internal_set_stopsimreq(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitAck.stopSimReq)
+}
+
+// bool shmAttached = 3;
+inline void SimInitAck::clear_shmattached() {
+  _impl_.shmattached_ = false;
+}
+inline bool SimInitAck::_internal_shmattached() const {
+  return _impl_.shmattached_;
+}
+inline bool SimInitAck::shmattached() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.SimInitAck.shmAttached)
+  return _internal_shmattached();
+}
+inline void SimInitAck::_internal_set_shmattached(bool value) {
+  
+  _impl_.shmattached_ = value;
+}
+inline void SimInitAck::set_shmattached(bool value) {
+  _internal_set_shmattached(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.SimInitAck.shmAttached)
+}
+
+// -------------------------------------------------------------------
+
+// AgentState
+
+// uint32 agentId = 1;
+inline void AgentState::clear_agentid() {
+  _impl_.agentid_ = 0u;
+}
+inline uint32_t AgentState::_internal_agentid() const {
+  return _impl_.agentid_;
+}
+inline uint32_t AgentState::agentid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentState.agentId)
+  return _internal_agentid();
+}
+inline void AgentState::_internal_set_agentid(uint32_t value) {
+  
+  _impl_.agentid_ = value;
+}
+inline void AgentState::set_agentid(uint32_t value) {
+  _internal_set_agentid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.AgentState.agentId)
+}
+
+// .ns3opengym.DataContainer obsData = 2;
+inline bool AgentState::_internal_has_obsdata() const {
+  return this != internal_default_instance() && _impl_.obsdata_ != nullptr;
+}
+inline bool AgentState::has_obsdata() const {
+  return _internal_has_obsdata();
+}
+inline void AgentState::clear_obsdata() {
+  if (GetArenaForAllocation() == nullptr && _impl_.obsdata_ != nullptr) {
+    delete _impl_.obsdata_;
+  }
+  _impl_.obsdata_ = nullptr;
+}
+inline const ::ns3opengym::DataContainer& AgentState::_internal_obsdata() const {
+  const ::ns3opengym::DataContainer* p = _impl_.obsdata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::DataContainer&>(
+      ::ns3opengym::_DataContainer_default_instance_);
+}
+inline const ::ns3opengym::DataContainer& AgentState::obsdata() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentState.obsData)
+  return _internal_obsdata();
+}
+inline void AgentState::unsafe_arena_set_allocated_obsdata(
+    ::ns3opengym::DataContainer* obsdata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.obsdata_);
+  }
+  _impl_.obsdata_ = obsdata;
+  if (obsdata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.AgentState.obsData)
+}
+inline ::ns3opengym::DataContainer* AgentState::release_obsdata() {
+  
+  ::ns3opengym::DataContainer* temp = _impl_.obsdata_;
+  _impl_.obsdata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::DataContainer* AgentState::unsafe_arena_release_obsdata() {
+  // @@protoc_insertion_point(field_release:ns3opengym.AgentState.obsData)
+  
+  ::ns3opengym::DataContainer* temp = _impl_.obsdata_;
+  _impl_.obsdata_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::DataContainer* AgentState::_internal_mutable_obsdata() {
+  
+  if (_impl_.obsdata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::DataContainer>(GetArenaForAllocation());
+    _impl_.obsdata_ = p;
+  }
+  return _impl_.obsdata_;
+}
+inline ::ns3opengym::DataContainer* AgentState::mutable_obsdata() {
+  ::ns3opengym::DataContainer* _msg = _internal_mutable_obsdata();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.AgentState.obsData)
+  return _msg;
+}
+inline void AgentState::set_allocated_obsdata(::ns3opengym::DataContainer* obsdata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.obsdata_;
+  }
+  if (obsdata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(obsdata);
+    if (message_arena != submessage_arena) {
+      obsdata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, obsdata, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.obsdata_ = obsdata;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.AgentState.obsData)
+}
+
+// float reward = 3;
+inline void AgentState::clear_reward() {
+  _impl_.reward_ = 0;
+}
+inline float AgentState::_internal_reward() const {
+  return _impl_.reward_;
+}
+inline float AgentState::reward() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentState.reward)
+  return _internal_reward();
+}
+inline void AgentState::_internal_set_reward(float value) {
+  
+  _impl_.reward_ = value;
+}
+inline void AgentState::set_reward(float value) {
+  _internal_set_reward(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.AgentState.reward)
+}
+
+// bool isGameOver = 4;
+inline void AgentState::clear_isgameover() {
+  _impl_.isgameover_ = false;
+}
+inline bool AgentState::_internal_isgameover() const {
+  return _impl_.isgameover_;
+}
+inline bool AgentState::isgameover() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentState.isGameOver)
+  return _internal_isgameover();
+}
+inline void AgentState::_internal_set_isgameover(bool value) {
+  
+  _impl_.isgameover_ = value;
+}
+inline void AgentState::set_isgameover(bool value) {
+  _internal_set_isgameover(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.AgentState.isGameOver)
+}
+
+// string info = 5;
+inline void AgentState::clear_info() {
+  _impl_.info_.ClearToEmpty();
+}
+inline const std::string& AgentState::info() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentState.info)
+  return _internal_info();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AgentState::set_info(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.info_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3opengym.AgentState.info)
+}
+inline std::string* AgentState::mutable_info() {
+  std::string* _s = _internal_mutable_info();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.AgentState.info)
+  return _s;
+}
+inline const std::string& AgentState::_internal_info() const {
+  return _impl_.info_.Get();
+}
+inline void AgentState::_internal_set_info(const std::string& value) {
+  
+  _impl_.info_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AgentState::_internal_mutable_info() {
+  
+  return _impl_.info_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AgentState::release_info() {
+  // @@protoc_insertion_point(field_release:ns3opengym.AgentState.info)
+  return _impl_.info_.Release();
+}
+inline void AgentState::set_allocated_info(std::string* info) {
+  if (info != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.info_.SetAllocated(info, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.info_.IsDefault()) {
+    _impl_.info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.AgentState.info)
+}
+
+// -------------------------------------------------------------------
+
+// AgentAct
+
+// uint32 agentId = 1;
+inline void AgentAct::clear_agentid() {
+  _impl_.agentid_ = 0u;
+}
+inline uint32_t AgentAct::_internal_agentid() const {
+  return _impl_.agentid_;
+}
+inline uint32_t AgentAct::agentid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentAct.agentId)
+  return _internal_agentid();
+}
+inline void AgentAct::_internal_set_agentid(uint32_t value) {
+  
+  _impl_.agentid_ = value;
+}
+inline void AgentAct::set_agentid(uint32_t value) {
+  _internal_set_agentid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.AgentAct.agentId)
+}
+
+// .ns3opengym.DataContainer actData = 2;
+inline bool AgentAct::_internal_has_actdata() const {
+  return this != internal_default_instance() && _impl_.actdata_ != nullptr;
+}
+inline bool AgentAct::has_actdata() const {
+  return _internal_has_actdata();
+}
+inline void AgentAct::clear_actdata() {
+  if (GetArenaForAllocation() == nullptr && _impl_.actdata_ != nullptr) {
+    delete _impl_.actdata_;
+  }
+  _impl_.actdata_ = nullptr;
+}
+inline const ::ns3opengym::DataContainer& AgentAct::_internal_actdata() const {
+  const ::ns3opengym::DataContainer* p = _impl_.actdata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::DataContainer&>(
+      ::ns3opengym::_DataContainer_default_instance_);
+}
+inline const ::ns3opengym::DataContainer& AgentAct::actdata() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.AgentAct.actData)
+  return _internal_actdata();
+}
+inline void AgentAct::unsafe_arena_set_allocated_actdata(
+    ::ns3opengym::DataContainer* actdata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.actdata_);
+  }
+  _impl_.actdata_ = actdata;
+  if (actdata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.AgentAct.actData)
+}
+inline ::ns3opengym::DataContainer* AgentAct::release_actdata() {
+  
+  ::ns3opengym::DataContainer* temp = _impl_.actdata_;
+  _impl_.actdata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::DataContainer* AgentAct::unsafe_arena_release_actdata() {
+  // @@protoc_insertion_point(field_release:ns3opengym.AgentAct.actData)
+  
+  ::ns3opengym::DataContainer* temp = _impl_.actdata_;
+  _impl_.actdata_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::DataContainer* AgentAct::_internal_mutable_actdata() {
+  
+  if (_impl_.actdata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::DataContainer>(GetArenaForAllocation());
+    _impl_.actdata_ = p;
+  }
+  return _impl_.actdata_;
+}
+inline ::ns3opengym::DataContainer* AgentAct::mutable_actdata() {
+  ::ns3opengym::DataContainer* _msg = _internal_mutable_actdata();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.AgentAct.actData)
+  return _msg;
+}
+inline void AgentAct::set_allocated_actdata(::ns3opengym::DataContainer* actdata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.actdata_;
+  }
+  if (actdata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(actdata);
+    if (message_arena != submessage_arena) {
+      actdata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, actdata, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.actdata_ = actdata;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.AgentAct.actData)
+}
+
+// -------------------------------------------------------------------
+
+// EnvStateMsg
+
+// .ns3opengym.DataContainer obsData = 1;
+inline bool EnvStateMsg::_internal_has_obsdata() const {
+  return this != internal_default_instance() && _impl_.obsdata_ != nullptr;
+}
+inline bool EnvStateMsg::has_obsdata() const {
+  return _internal_has_obsdata();
+}
+inline void EnvStateMsg::clear_obsdata() {
+  if (GetArenaForAllocation() == nullptr && _impl_.obsdata_ != nullptr) {
+    delete _impl_.obsdata_;
+  }
+  _impl_.obsdata_ = nullptr;
+}
+inline const ::ns3opengym::DataContainer& EnvStateMsg::_internal_obsdata() const {
+  const ::ns3opengym::DataContainer* p = _impl_.obsdata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::DataContainer&>(
+      ::ns3opengym::_DataContainer_default_instance_);
+}
+inline const ::ns3opengym::DataContainer& EnvStateMsg::obsdata() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.obsData)
+  return _internal_obsdata();
+}
+inline void EnvStateMsg::unsafe_arena_set_allocated_obsdata(
+    ::ns3opengym::DataContainer* obsdata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.obsdata_);
+  }
+  _impl_.obsdata_ = obsdata;
+  if (obsdata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.EnvStateMsg.obsData)
+}
+inline ::ns3opengym::DataContainer* EnvStateMsg::release_obsdata() {
+  
+  ::ns3opengym::DataContainer* temp = _impl_.obsdata_;
+  _impl_.obsdata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::DataContainer* EnvStateMsg::unsafe_arena_release_obsdata() {
+  // @@protoc_insertion_point(field_release:ns3opengym.EnvStateMsg.obsData)
+  
+  ::ns3opengym::DataContainer* temp = _impl_.obsdata_;
+  _impl_.obsdata_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::DataContainer* EnvStateMsg::_internal_mutable_obsdata() {
+  
+  if (_impl_.obsdata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::DataContainer>(GetArenaForAllocation());
+    _impl_.obsdata_ = p;
+  }
+  return _impl_.obsdata_;
+}
+inline ::ns3opengym::DataContainer* EnvStateMsg::mutable_obsdata() {
+  ::ns3opengym::DataContainer* _msg = _internal_mutable_obsdata();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.EnvStateMsg.obsData)
+  return _msg;
+}
+inline void EnvStateMsg::set_allocated_obsdata(::ns3opengym::DataContainer* obsdata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.obsdata_;
+  }
+  if (obsdata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(obsdata);
+    if (message_arena != submessage_arena) {
+      obsdata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, obsdata, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.obsdata_ = obsdata;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.EnvStateMsg.obsData)
+}
+
+// float reward = 2;
+inline void EnvStateMsg::clear_reward() {
+  _impl_.reward_ = 0;
+}
+inline float EnvStateMsg::_internal_reward() const {
+  return _impl_.reward_;
+}
+inline float EnvStateMsg::reward() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.reward)
+  return _internal_reward();
+}
+inline void EnvStateMsg::_internal_set_reward(float value) {
+  
+  _impl_.reward_ = value;
+}
+inline void EnvStateMsg::set_reward(float value) {
+  _internal_set_reward(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvStateMsg.reward)
+}
+
+// bool isGameOver = 3;
+inline void EnvStateMsg::clear_isgameover() {
+  _impl_.isgameover_ = false;
+}
+inline bool EnvStateMsg::_internal_isgameover() const {
+  return _impl_.isgameover_;
+}
+inline bool EnvStateMsg::isgameover() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.isGameOver)
+  return _internal_isgameover();
+}
+inline void EnvStateMsg::_internal_set_isgameover(bool value) {
+  
+  _impl_.isgameover_ = value;
+}
+inline void EnvStateMsg::set_isgameover(bool value) {
+  _internal_set_isgameover(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvStateMsg.isGameOver)
+}
+
+// .ns3opengym.EnvStateMsg.Reason reason = 4;
+inline void EnvStateMsg::clear_reason() {
+  _impl_.reason_ = 0;
+}
+inline ::ns3opengym::EnvStateMsg_Reason EnvStateMsg::_internal_reason() const {
+  return static_cast< ::ns3opengym::EnvStateMsg_Reason >(_impl_.reason_);
+}
+inline ::ns3opengym::EnvStateMsg_Reason EnvStateMsg::reason() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.reason)
+  return _internal_reason();
+}
+inline void EnvStateMsg::_internal_set_reason(::ns3opengym::EnvStateMsg_Reason value) {
+  
+  _impl_.reason_ = value;
+}
+inline void EnvStateMsg::set_reason(::ns3opengym::EnvStateMsg_Reason value) {
+  _internal_set_reason(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvStateMsg.reason)
+}
+
+// string info = 5;
+inline void EnvStateMsg::clear_info() {
+  _impl_.info_.ClearToEmpty();
+}
+inline const std::string& EnvStateMsg::info() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.info)
+  return _internal_info();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EnvStateMsg::set_info(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.info_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvStateMsg.info)
+}
+inline std::string* EnvStateMsg::mutable_info() {
+  std::string* _s = _internal_mutable_info();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.EnvStateMsg.info)
+  return _s;
+}
+inline const std::string& EnvStateMsg::_internal_info() const {
+  return _impl_.info_.Get();
+}
+inline void EnvStateMsg::_internal_set_info(const std::string& value) {
+  
+  _impl_.info_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EnvStateMsg::_internal_mutable_info() {
+  
+  return _impl_.info_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EnvStateMsg::release_info() {
+  // @@protoc_insertion_point(field_release:ns3opengym.EnvStateMsg.info)
+  return _impl_.info_.Release();
+}
+inline void EnvStateMsg::set_allocated_info(std::string* info) {
+  if (info != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.info_.SetAllocated(info, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.info_.IsDefault()) {
+    _impl_.info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.EnvStateMsg.info)
+}
+
+// repeated .ns3opengym.AgentState agents = 6;
+inline int EnvStateMsg::_internal_agents_size() const {
+  return _impl_.agents_.size();
+}
+inline int EnvStateMsg::agents_size() const {
+  return _internal_agents_size();
+}
+inline void EnvStateMsg::clear_agents() {
+  _impl_.agents_.Clear();
+}
+inline ::ns3opengym::AgentState* EnvStateMsg::mutable_agents(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.EnvStateMsg.agents)
+  return _impl_.agents_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentState >*
+EnvStateMsg::mutable_agents() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.EnvStateMsg.agents)
+  return &_impl_.agents_;
+}
+inline const ::ns3opengym::AgentState& EnvStateMsg::_internal_agents(int index) const {
+  return _impl_.agents_.Get(index);
+}
+inline const ::ns3opengym::AgentState& EnvStateMsg::agents(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.agents)
+  return _internal_agents(index);
+}
+inline ::ns3opengym::AgentState* EnvStateMsg::_internal_add_agents() {
+  return _impl_.agents_.Add();
+}
+inline ::ns3opengym::AgentState* EnvStateMsg::add_agents() {
+  ::ns3opengym::AgentState* _add = _internal_add_agents();
+  // @@protoc_insertion_point(field_add:ns3opengym.EnvStateMsg.agents)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentState >&
+EnvStateMsg::agents() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.EnvStateMsg.agents)
+  return _impl_.agents_;
+}
+
+// uint64 snapshotId = 7;
+inline void EnvStateMsg::clear_snapshotid() {
+  _impl_.snapshotid_ = uint64_t{0u};
+}
+inline uint64_t EnvStateMsg::_internal_snapshotid() const {
+  return _impl_.snapshotid_;
+}
+inline uint64_t EnvStateMsg::snapshotid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvStateMsg.snapshotId)
+  return _internal_snapshotid();
+}
+inline void EnvStateMsg::_internal_set_snapshotid(uint64_t value) {
+  
+  _impl_.snapshotid_ = value;
+}
+inline void EnvStateMsg::set_snapshotid(uint64_t value) {
+  _internal_set_snapshotid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvStateMsg.snapshotId)
+}
+
+// -------------------------------------------------------------------
+
+// EnvActMsg
+
+// .ns3opengym.DataContainer actData = 1;
+inline bool EnvActMsg::_internal_has_actdata() const {
+  return this != internal_default_instance() && _impl_.actdata_ != nullptr;
+}
+inline bool EnvActMsg::has_actdata() const {
+  return _internal_has_actdata();
+}
+inline void EnvActMsg::clear_actdata() {
+  if (GetArenaForAllocation() == nullptr && _impl_.actdata_ != nullptr) {
+    delete _impl_.actdata_;
+  }
+  _impl_.actdata_ = nullptr;
+}
+inline const ::ns3opengym::DataContainer& EnvActMsg::_internal_actdata() const {
+  const ::ns3opengym::DataContainer* p = _impl_.actdata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ns3opengym::DataContainer&>(
+      ::ns3opengym::_DataContainer_default_instance_);
+}
+inline const ::ns3opengym::DataContainer& EnvActMsg::actdata() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvActMsg.actData)
+  return _internal_actdata();
+}
+inline void EnvActMsg::unsafe_arena_set_allocated_actdata(
+    ::ns3opengym::DataContainer* actdata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.actdata_);
+  }
+  _impl_.actdata_ = actdata;
+  if (actdata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ns3opengym.EnvActMsg.actData)
+}
+inline ::ns3opengym::DataContainer* EnvActMsg::release_actdata() {
+  
+  ::ns3opengym::DataContainer* temp = _impl_.actdata_;
+  _impl_.actdata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ns3opengym::DataContainer* EnvActMsg::unsafe_arena_release_actdata() {
+  // @@protoc_insertion_point(field_release:ns3opengym.EnvActMsg.actData)
+  
+  ::ns3opengym::DataContainer* temp = _impl_.actdata_;
+  _impl_.actdata_ = nullptr;
+  return temp;
+}
+inline ::ns3opengym::DataContainer* EnvActMsg::_internal_mutable_actdata() {
+  
+  if (_impl_.actdata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ns3opengym::DataContainer>(GetArenaForAllocation());
+    _impl_.actdata_ = p;
+  }
+  return _impl_.actdata_;
+}
+inline ::ns3opengym::DataContainer* EnvActMsg::mutable_actdata() {
+  ::ns3opengym::DataContainer* _msg = _internal_mutable_actdata();
+  // @@protoc_insertion_point(field_mutable:ns3opengym.EnvActMsg.actData)
+  return _msg;
+}
+inline void EnvActMsg::set_allocated_actdata(::ns3opengym::DataContainer* actdata) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.actdata_;
+  }
+  if (actdata) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(actdata);
+    if (message_arena != submessage_arena) {
+      actdata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, actdata, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.actdata_ = actdata;
+  // @@protoc_insertion_point(field_set_allocated:ns3opengym.EnvActMsg.actData)
+}
+
+// bool stopSimReq = 2;
+inline void EnvActMsg::clear_stopsimreq() {
+  _impl_.stopsimreq_ = false;
+}
+inline bool EnvActMsg::_internal_stopsimreq() const {
+  return _impl_.stopsimreq_;
+}
+inline bool EnvActMsg::stopsimreq() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvActMsg.stopSimReq)
+  return _internal_stopsimreq();
+}
+inline void EnvActMsg::_internal_set_stopsimreq(bool value) {
+  
+  _impl_.stopsimreq_ = value;
+}
+inline void EnvActMsg::set_stopsimreq(bool value) {
+  _internal_set_stopsimreq(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvActMsg.stopSimReq)
+}
+
+// repeated .ns3opengym.AgentAct agents = 3;
+inline int EnvActMsg::_internal_agents_size() const {
+  return _impl_.agents_.size();
+}
+inline int EnvActMsg::agents_size() const {
+  return _internal_agents_size();
+}
+inline void EnvActMsg::clear_agents() {
+  _impl_.agents_.Clear();
+}
+inline ::ns3opengym::AgentAct* EnvActMsg::mutable_agents(int index) {
+  // @@protoc_insertion_point(field_mutable:ns3opengym.EnvActMsg.agents)
+  return _impl_.agents_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentAct >*
+EnvActMsg::mutable_agents() {
+  // @@protoc_insertion_point(field_mutable_list:ns3opengym.EnvActMsg.agents)
+  return &_impl_.agents_;
+}
+inline const ::ns3opengym::AgentAct& EnvActMsg::_internal_agents(int index) const {
+  return _impl_.agents_.Get(index);
+}
+inline const ::ns3opengym::AgentAct& EnvActMsg::agents(int index) const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvActMsg.agents)
+  return _internal_agents(index);
+}
+inline ::ns3opengym::AgentAct* EnvActMsg::_internal_add_agents() {
+  return _impl_.agents_.Add();
+}
+inline ::ns3opengym::AgentAct* EnvActMsg::add_agents() {
+  ::ns3opengym::AgentAct* _add = _internal_add_agents();
+  // @@protoc_insertion_point(field_add:ns3opengym.EnvActMsg.agents)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::ns3opengym::AgentAct >&
+EnvActMsg::agents() const {
+  // @@protoc_insertion_point(field_list:ns3opengym.EnvActMsg.agents)
+  return _impl_.agents_;
+}
+
+// .ns3opengym.EnvActMsg.SnapshotCmd snapshotCmd = 4;
+inline void EnvActMsg::clear_snapshotcmd() {
+  _impl_.snapshotcmd_ = 0;
+}
+inline ::ns3opengym::EnvActMsg_SnapshotCmd EnvActMsg::_internal_snapshotcmd() const {
+  return static_cast< ::ns3opengym::EnvActMsg_SnapshotCmd >(_impl_.snapshotcmd_);
+}
+inline ::ns3opengym::EnvActMsg_SnapshotCmd EnvActMsg::snapshotcmd() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvActMsg.snapshotCmd)
+  return _internal_snapshotcmd();
+}
+inline void EnvActMsg::_internal_set_snapshotcmd(::ns3opengym::EnvActMsg_SnapshotCmd value) {
+  
+  _impl_.snapshotcmd_ = value;
+}
+inline void EnvActMsg::set_snapshotcmd(::ns3opengym::EnvActMsg_SnapshotCmd value) {
+  _internal_set_snapshotcmd(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvActMsg.snapshotCmd)
+}
+
+// uint64 snapshotId = 5;
+inline void EnvActMsg::clear_snapshotid() {
+  _impl_.snapshotid_ = uint64_t{0u};
+}
+inline uint64_t EnvActMsg::_internal_snapshotid() const {
+  return _impl_.snapshotid_;
+}
+inline uint64_t EnvActMsg::snapshotid() const {
+  // @@protoc_insertion_point(field_get:ns3opengym.EnvActMsg.snapshotId)
+  return _internal_snapshotid();
+}
+inline void EnvActMsg::_internal_set_snapshotid(uint64_t value) {
+  
+  _impl_.snapshotid_ = value;
+}
+inline void EnvActMsg::set_snapshotid(uint64_t value) {
+  _internal_set_snapshotid(value);
+  // @@protoc_insertion_point(field_set:ns3opengym.EnvActMsg.snapshotId)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ns3opengym
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ns3opengym::EnvStateMsg_Reason> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ns3opengym::EnvStateMsg_Reason>() {
+  return ::ns3opengym::EnvStateMsg_Reason_descriptor();
+}
+template <> struct is_proto_enum< ::ns3opengym::EnvActMsg_SnapshotCmd> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ns3opengym::EnvActMsg_SnapshotCmd>() {
+  return ::ns3opengym::EnvActMsg_SnapshotCmd_descriptor();
+}
+template <> struct is_proto_enum< ::ns3opengym::MsgType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ns3opengym::MsgType>() {
+  return ::ns3opengym::MsgType_descriptor();
+}
+template <> struct is_proto_enum< ::ns3opengym::SpaceType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ns3opengym::SpaceType>() {
+  return ::ns3opengym::SpaceType_descriptor();
+}
+template <> struct is_proto_enum< ::ns3opengym::Dtype> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ns3opengym::Dtype>() {
+  return ::ns3opengym::Dtype_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
@@ -0,0 +1,68 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: messages.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+from google.protobuf import any_pb2 as google_dot_protobuf_dot_any__pb2
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0emessages.proto\x12\nns3opengym\x1a\x19google/protobuf/any.proto\"j\n\x10SpaceDescription\x12#\n\x04type\x18\x01 \x01(\x0e\x32\x15.ns3opengym.SpaceType\x12#\n\x05space\x18\x02 \x01(\x0b\x32\x14.google.protobuf.Any\x12\x0c\n\x04name\x18\x03 \x01(\t\"\x1a\n\rDiscreteSpace\x12\t\n\x01n\x18\x01 \x01(\x05\"V\n\x08\x42oxSpace\x12\x0b\n\x03low\x18\x01 \x01(\x02\x12\x0c\n\x04high\x18\x02 \x01(\x02\x12 \n\x05\x64type\x18\x03 \x01(\x0e\x32\x11.ns3opengym.Dtype\x12\r\n\x05shape\x18\x04 \x03(\r\";\n\nTupleSpace\x12-\n\x07\x65lement\x18\x01 \x03(\x0b\x32\x1c.ns3opengym.SpaceDescription\":\n\tDictSpace\x12-\n\x07\x65lement\x18\x01 \x03(\x0b\x32\x1c.ns3opengym.SpaceDescription\"f\n\rDataContainer\x12#\n\x04type\x18\x01 \x01(\x0e\x32\x15.ns3opengym.SpaceType\x12\"\n\x04\x64\x61ta\x18\x02 \x01(\x0b\x32\x14.google.protobuf.Any\x12\x0c\n\x04name\x18\x03 \x01(\t\"%\n\x15\x44iscreteDataContainer\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x05\"\xc2\x01\n\x10\x42oxDataContainer\x12 \n\x05\x64type\x18\x01 \x01(\x0e\x32\x11.ns3opengym.Dtype\x12\r\n\x05shape\x18\x02 \x03(\r\x12\x0f\n\x07intData\x18\x03 \x03(\x05\x12\x10\n\x08uintData\x18\x04 \x03(\r\x12\x11\n\tfloatData\x18\x05 \x03(\x02\x12\x12\n\ndoubleData\x18\x06 \x03(\x01\x12\x11\n\tshmOffset\x18\x07 \x01(\x04\x12\x0f\n\x07shmSize\x18\x08 \x01(\x04\x12\x0f\n\x07rawData\x18\t \x01(\x0c\"@\n\x12TupleDataContainer\x12*\n\x07\x65lement\x18\x01 \x03(\x0b\x32\x19.ns3opengym.DataContainer\"?\n\x11\x44ictDataContainer\x12*\n\x07\x65lement\x18\x01 \x03(\x0b\x32\x19.ns3opengym.DataContainer\"\x88\x01\n\x15\x41gentSpaceDescription\x12\x0f\n\x07\x61gentId\x18\x01 \x01(\r\x12.\n\x08obsSpace\x18\x02 \x01(\x0b\x32\x1c.ns3opengym.SpaceDescription\x12.\n\x08\x61\x63tSpace\x18\x03 \x01(\x0b\x32\x1c.ns3opengym.SpaceDescription\"\x8f\x02\n\nSimInitMsg\x12\x14\n\x0csimProcessId\x18\x01 \x01(\x04\x12\x19\n\x11wafShellProcessId\x18\x02 \x01(\x04\x12.\n\x08obsSpace\x18\x03 \x01(\x0b\x32\x1c.ns3opengym.SpaceDescription\x12.\n\x08\x61\x63tSpace\x18\x04 \x01(\x0b\x32\x1c.ns3opengym.SpaceDescription\x12\x0f\n\x07shmName\x18\x05 \x01(\t\x12\x12\n\nforkServer\x18\x06 \x01(\x08\x12\x31\n\x06\x61gents\x18\x07 \x03(\x0b\x32!.ns3opengym.AgentSpaceDescription\x12\x18\n\x10restoredSnapshot\x18\x08 \x01(\x04\"C\n\nSimInitAck\x12\x0c\n\x04\x64one\x18\x01 \x01(\x08\x12\x12\n\nstopSimReq\x18\x02 \x01(\x08\x12\x13\n\x0bshmAttached\x18\x03 \x01(\x08\"{\n\nAgentState\x12\x0f\n\x07\x61gentId\x18\x01 \x01(\r\x12*\n\x07obsData\x18\x02 \x01(\x0b\x32\x19.ns3opengym.DataContainer\x12\x0e\n\x06reward\x18\x03 \x01(\x02\x12\x12\n\nisGameOver\x18\x04 \x01(\x08\x12\x0c\n\x04info\x18\x05 \x01(\t\"G\n\x08\x41gentAct\x12\x0f\n\x07\x61gentId\x18\x01 \x01(\r\x12*\n\x07\x61\x63tData\x18\x02 \x01(\x0b\x32\x19.ns3opengym.DataContainer\"\x82\x02\n\x0b\x45nvStateMsg\x12*\n\x07obsData\x18\x01 \x01(\x0b\x32\x19.ns3opengym.DataContainer\x12\x0e\n\x06reward\x18\x02 \x01(\x02\x12\x12\n\nisGameOver\x18\x03 \x01(\x08\x12.\n\x06reason\x18\x04 \x01(\x0e\x32\x1e.ns3opengym.EnvStateMsg.Reason\x12\x0c\n\x04info\x18\x05 \x01(\t\x12&\n\x06\x61gents\x18\x06 \x03(\x0b\x32\x16.ns3opengym.AgentState\x12\x12\n\nsnapshotId\x18\x07 \x01(\x04\")\n\x06Reason\x12\x11\n\rSimulationEnd\x10\x00\x12\x0c\n\x08GameOver\x10\x01\"\x9b\x02\n\tEnvActMsg\x12*\n\x07\x61\x63tData\x18\x01 \x01(\x0b\x32\x19.ns3opengym.DataContainer\x12\x12\n\nstopSimReq\x18\x02 \x01(\x08\x12$\n\x06\x61gents\x18\x03 \x03(\x0b\x32\x14.ns3opengym.AgentAct\x12\x36\n\x0bsnapshotCmd\x18\x04 \x01(\x0e\x32!.ns3opengym.EnvActMsg.SnapshotCmd\x12\x12\n\nsnapshotId\x18\x05 \x01(\x04\"\\\n\x0bSnapshotCmd\x12\x11\n\rNoSnapshotCmd\x10\x00\x12\x10\n\x0cSaveSnapshot\x10\x01\x12\x13\n\x0fRestoreSnapshot\x10\x02\x12\x13\n\x0fReleaseSnapshot\x10\x03*\x9c\x01\n\x07MsgType\x12\x0b\n\x07Unknown\x10\x00\x12\x08\n\x04Init\x10\x01\x12\x0f\n\x0b\x41\x63tionSpace\x10\x02\x12\x14\n\x10ObservationSpace\x10\x03\x12\x0e\n\nIsGameOver\x10\x04\x12\x0f\n\x0bObservation\x10\x05\x12\n\n\x06Reward\x10\x06\x12\r\n\tExtraInfo\x10\x07\x12\n\n\x06\x41\x63tion\x10\x08\x12\x0b\n\x07StopEnv\x10\t*H\n\tSpaceType\x12\x0f\n\x0bNoSpaceType\x10\x00\x12\x0c\n\x08\x44iscrete\x10\x01\x12\x07\n\x03\x42ox\x10\x02\x12\t\n\x05Tuple\x10\x03\x12\x08\n\x04\x44ict\x10\x04*>\n\x05\x44type\x12\x0b\n\x07NoDType\x10\x00\x12\x07\n\x03INT\x10\x01\x12\x08\n\x04UINT\x10\x02\x12\t\n\x05\x46LOAT\x10\x03\x12\n\n\x06\x44OUBLE\x10\x04\x62\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'messages_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _MSGTYPE._serialized_start=2101
+  _MSGTYPE._serialized_end=2257
+  _SPACETYPE._serialized_start=2259
+  _SPACETYPE._serialized_end=2331
+  _DTYPE._serialized_start=2333
+  _DTYPE._serialized_end=2395
+  _SPACEDESCRIPTION._serialized_start=57
+  _SPACEDESCRIPTION._serialized_end=163
+  _DISCRETESPACE._serialized_start=165
+  _DISCRETESPACE._serialized_end=191
+  _BOXSPACE._serialized_start=193
+  _BOXSPACE._serialized_end=279
+  _TUPLESPACE._serialized_start=281
+  _TUPLESPACE._serialized_end=340
+  _DICTSPACE._serialized_start=342
+  _DICTSPACE._serialized_end=400
+  _DATACONTAINER._serialized_start=402
+  _DATACONTAINER._serialized_end=504
+  _DISCRETEDATACONTAINER._serialized_start=506
+  _DISCRETEDATACONTAINER._serialized_end=543
+  _BOXDATACONTAINER._serialized_start=546
+  _BOXDATACONTAINER._serialized_end=740
+  _TUPLEDATACONTAINER._serialized_start=742
+  _TUPLEDATACONTAINER._serialized_end=806
+  _DICTDATACONTAINER._serialized_start=808
+  _DICTDATACONTAINER._serialized_end=871
+  _AGENTSPACEDESCRIPTION._serialized_start=874
+  _AGENTSPACEDESCRIPTION._serialized_end=1010
+  _SIMINITMSG._serialized_start=1013
+  _SIMINITMSG._serialized_end=1284
+  _SIMINITACK._serialized_start=1286
+  _SIMINITACK._serialized_end=1353
+  _AGENTSTATE._serialized_start=1355
+  _AGENTSTATE._serialized_end=1478
+  _AGENTACT._serialized_start=1480
+  _AGENTACT._serialized_end=1551
+  _ENVSTATEMSG._serialized_start=1554
+  _ENVSTATEMSG._serialized_end=1812
+  _ENVSTATEMSG_REASON._serialized_start=1771
+  _ENVSTATEMSG_REASON._serialized_end=1812
+  _ENVACTMSG._serialized_start=1815
+  _ENVACTMSG._serialized_end=2098
+  _ENVACTMSG_SNAPSHOTCMD._serialized_start=2006
+  _ENVACTMSG_SNAPSHOTCMD._serialized_end=2098
+# @@protoc_insertion_point(module_scope)
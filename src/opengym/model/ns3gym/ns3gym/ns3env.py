@@ -2,12 +2,18 @@ import os
 import sys
 import zmq
 import time
+import mmap
+import ctypes
+import signal
+import struct
+import platform
 
 import numpy as np
 
 import gym
 from gym import spaces
 from gym.utils import seeding
+from gym.vector.utils import batch_space
 from enum import IntEnum
 
 from ns3gym.start_sim import start_sim_script, build_ns3_project
@@ -22,9 +28,133 @@ __version__ = "0.1.0"
 __email__ = "gawlowicz@tkn.tu-berlin.de"
 
 
+class Ns3ShmChannel(object):
+    """Shared-memory ring offered by OpenGymInterface (ShmTransport attribute).
+
+    Layout has to be kept in sync with OpenGymShmChannel in opengym_shm.cc.
+    Box data of observations is copied out of the ring. With zeroCopy it is
+    mapped straight into read-only numpy arrays instead; such an array stays
+    valid for (slotNum - 1) further steps, copy it if it has to live longer
+    (e.g. in a replay buffer).
+
+    The counters are read and written with plain loads and stores, which
+    only order the accesses to the slots under the x86 memory model, so the
+    transport is limited to x86 hosts.
+    """
+    MAGIC = 0x4733534e
+    VERSION = 1
+    REQ_WRITE = 64
+    REQ_READ = 128
+    REP_WRITE = 192
+    REP_READ = 256
+    HEADER_SIZE = 4096
+    SLOT_HEADER_SIZE = 64
+    SPIN_NUM = 1000
+
+    FUTEX_WAIT = 0
+    FUTEX_WAKE = 1
+    SYS_FUTEX = {'x86_64': 202, 'i386': 240, 'i686': 240}
+
+    class _Timespec(ctypes.Structure):
+        _fields_ = [("tv_sec", ctypes.c_long), ("tv_nsec", ctypes.c_long)]
+
+    def __init__(self, name, zeroCopy=False):
+        super(Ns3ShmChannel, self).__init__()
+        machine = platform.machine()
+        if machine not in self.SYS_FUTEX:
+            raise RuntimeError("Shared-memory transport is not supported on " + machine)
+        self.libc = ctypes.CDLL(None, use_errno=True)
+        self.sysFutex = self.SYS_FUTEX[machine]
+        self.zeroCopy = zeroCopy
+
+        fd = os.open("/dev/shm" + name, os.O_RDWR)
+        try:
+            self.mm = mmap.mmap(fd, 0)
+        finally:
+            os.close(fd)
+
+        magic, version, self.slotNum, self.slotSize = struct.unpack_from("<IIII", self.mm, 0)
+        if magic != self.MAGIC or version != self.VERSION:
+            self.mm.close()
+            raise ValueError("Unknown shared-memory segment layout")
+
+        self.reqSlots = self.HEADER_SIZE
+        self.repSlots = self.HEADER_SIZE + self.slotNum * self.slotSize
+        # counters are futex words, plain aligned 32-bit loads/stores are atomic,
+        # and have acquire/release semantics on x86
+        self.counters = {}
+        for offset in [self.REQ_WRITE, self.REQ_READ, self.REP_WRITE, self.REP_READ]:
+            self.counters[offset] = ctypes.c_uint32.from_buffer(self.mm, offset)
+        self.timeout = self._Timespec(0, 100000000)
+
+    def close(self):
+        self.counters = {}
+        try:
+            self.mm.close()
+        except BufferError:
+            # numpy views on the observations are still alive
+            pass
+
+    def _futex(self, counter, op, value, timeout=None):
+        self.libc.syscall(self.sysFutex, ctypes.c_void_p(ctypes.addressof(counter)), op,
+                          ctypes.c_uint32(value), timeout, None, 0)
+
+    def _wait(self, counter, value):
+        for i in range(self.SPIN_NUM):
+            if counter.value != value:
+                return
+        while counter.value == value:
+            # timeout keeps us responsive to Ctrl-C
+            self._futex(counter, self.FUTEX_WAIT, value, ctypes.byref(self.timeout))
+
+    def _slot(self, base, idx):
+        return base + (idx % self.slotNum) * self.slotSize
+
+    def recv(self):
+        read = self.counters[self.REQ_READ].value
+        self._wait(self.counters[self.REQ_WRITE], read)
+
+        slot = self._slot(self.reqSlots, read)
+        msgOffset, msgSize = struct.unpack_from("<II", self.mm, slot)
+        msg = self.mm[slot + msgOffset:slot + msgOffset + msgSize]
+
+        self.counters[self.REQ_READ].value = (read + 1) & 0xffffffff
+        self._futex(self.counters[self.REQ_READ], self.FUTEX_WAKE, 0x7fffffff)
+        return msg
+
+    def send(self, msg):
+        write = self.counters[self.REP_WRITE].value
+        while (write - self.counters[self.REP_READ].value) & 0xffffffff >= self.slotNum:
+            self._wait(self.counters[self.REP_READ], self.counters[self.REP_READ].value)
+
+        if self.SLOT_HEADER_SIZE + len(msg) > self.slotSize:
+            raise ValueError("Message does not fit into shared-memory slot, increase ShmSlotSize")
+
+        slot = self._slot(self.repSlots, write)
+        struct.pack_into("<II", self.mm, slot, self.SLOT_HEADER_SIZE, len(msg))
+        self.mm[slot + self.SLOT_HEADER_SIZE:slot + self.SLOT_HEADER_SIZE + len(msg)] = msg
+
+        self.counters[self.REP_WRITE].value = (write + 1) & 0xffffffff
+        self._futex(self.counters[self.REP_WRITE], self.FUTEX_WAKE, 0x7fffffff)
+
+    def get_array(self, offset, size, dtype, shape):
+        data = np.frombuffer(self.mm, dtype=dtype, count=size // np.dtype(dtype).itemsize, offset=offset)
+        if self.zeroCopy:
+            # the slot is rewritten by the simulation later on
+            data.flags.writeable = False
+        else:
+            data = data.copy()
+        if shape and int(np.prod(shape)) == data.size:
+            data = data.reshape(shape)
+        return data
+
+
 class Ns3ZmqBridge(object):
     """docstring for Ns3ZmqBridge"""
-    def __init__(self, port=0, startSim=True, simSeed=0, simArgs={}, debug=False):
+    # raw layout of packed and shared-memory Box data
+    BOX_DTYPES = {pb.INT: '<i4', pb.UINT: '<u4', pb.FLOAT: '<f4', pb.DOUBLE: '<f8'}
+
+    def __init__(self, port=0, startSim=True, simSeed=0, simArgs={}, debug=False, shmZeroCopy=False):
         super(Ns3ZmqBridge, self).__init__()
         port = int(port)
         self.port = port
@@ -35,6 +165,12 @@ class Ns3ZmqBridge(object):
         self.simPid = None
         self.wafPid = None
         self.ns3Process = None
+        self.shm = None
+        self.shmZeroCopy = shmZeroCopy
+        self.forkServer = False
+        self.forkServerTimeout = 10000  # ms
+        # ids of snapshots held by the simulation, i.e. pids of the frozen processes
+        self.snapshots = set()
 
         context = zmq.Context()
         self.socket = context.socket(zmq.REP)
@@ -70,7 +206,13 @@ class Ns3ZmqBridge(object):
 
         self._action_space = None
         self._observation_space = None
+        self._reset_episode_state()
 
+    def _reset_episode_state(self):
+        self.multiAgent = False
+        self.agentDone = {}
+        self.agentInfo = {}
+        self.envStopped = False
         self.forceEnvStop = False
         self.obsData = None
         self.reward = 0
@@ -78,14 +220,16 @@ class Ns3ZmqBridge(object):
         self.gameOverReason = None
         self.extraInfo = None
         self.newStateRx = False
+        self.episodeDone = False
 
     def close(self):
         try:
+            if self.forkServer:
+                self.finish_episode()
+                self.stop_fork_server()
             if not self.envStopped:
                 self.envStopped = True
-                self.force_env_stop()
-                self.rx_env_state()
-                self.send_close_command()
+                self.finish_episode()
                 self.ns3Process.kill()
                 if self.simPid:
                     os.kill(self.simPid, signal.SIGTERM)
@@ -95,6 +239,109 @@ class Ns3ZmqBridge(object):
                     self.wafPid = None
         except Exception as e:
             pass
+        finally:
+            if self.shm:
+                self.shm.close()
+                self.shm = None
+            for snapshotId in self.snapshots:
+                try:
+                    os.kill(snapshotId, signal.SIGTERM)
+                except OSError:
+                    pass
+            self.snapshots.clear()
+
+    def finish_episode(self):
+        if self.episodeDone:
+            return
+        self.force_env_stop()
+        self.rx_env_state()
+        if not self.episodeDone:
+            self.send_close_command()
+
+    def restart_episode(self, stepInterval):
+        # fork server forks the next episode as soon as the current one exits
+        self.finish_episode()
+        if self.shm:
+            self.shm.close()
+            self.shm = None
+
+        self._reset_episode_state()
+        self.initialize_env(stepInterval)
+
+    def stop_fork_server(self):
+        # next episode is already waiting for the init ack, reject it to stop the server
+        self.forkServer = False
+        if not self.socket.poll(self.forkServerTimeout):
+            return
+        self.socket.recv()
+        reply = pb.SimInitAck()
+        reply.done = True
+        reply.stopSimReq = True
+        self.socket.send(reply.SerializeToString())
+
+    def _state_pending(self):
+        # simulation waits for the reply to the last state
+        return self.newStateRx and not self.episodeDone
+
+    def _snapshot_cmd(self, cmd, snapshotId=0):
+        reply = pb.EnvActMsg()
+        reply.snapshotCmd = cmd
+        reply.snapshotId = snapshotId
+        self._send(reply.SerializeToString())
+        ack = pb.EnvStateMsg()
+        ack.ParseFromString(self._recv())
+        return ack.snapshotId
+
+    def save_snapshot(self):
+        if not self._state_pending():
+            raise RuntimeError("Snapshots are taken at a step of a running simulation")
+        snapshotId = self._snapshot_cmd(pb.EnvActMsg.SaveSnapshot)
+        if not snapshotId:
+            raise RuntimeError("Simulation could not take a snapshot")
+        self.snapshots.add(snapshotId)
+        return snapshotId
+
+    def restore_snapshot(self, snapshotId, stepInterval):
+        if snapshotId not in self.snapshots:
+            raise ValueError("Unknown snapshot %s" % str(snapshotId))
+        if self._state_pending():
+            # running simulation wakes up the snapshot and quits
+            if not self._snapshot_cmd(pb.EnvActMsg.RestoreSnapshot, snapshotId):
+                raise RuntimeError("Simulation could not restore snapshot %s" % str(snapshotId))
+            # simulation wakes the snapshot as soon as it gets the confirmation
+            self._send(b'')
+        else:
+            os.kill(snapshotId, signal.SIGUSR1)
+
+        if self.shm:
+            self.shm.close()
+            self.shm = None
+        self._reset_episode_state()
+        self.initialize_env(stepInterval)
+        self.rx_env_state()
+
+    def release_snapshot(self, snapshotId):
+        if snapshotId not in self.snapshots:
+            return
+        self.snapshots.discard(snapshotId)
+        if self._state_pending():
+            self._snapshot_cmd(pb.EnvActMsg.ReleaseSnapshot, snapshotId)
+        else:
+            try:
+                os.kill(snapshotId, signal.SIGTERM)
+            except OSError:
+                pass
+
+    def _send(self, msg):
+        if self.shm:
+            self.shm.send(msg)
+        else:
+            self.socket.send(msg)
+
+    def _recv(self):
+        if self.shm:
+            return self.shm.recv()
+        return self.socket.recv()
 
     def _create_space(self, spaceDesc):
         space = None
@@ -149,20 +396,46 @@ class Ns3ZmqBridge(object):
 
     def initialize_env(self, stepInterval):
         request = self.socket.recv()
+        replyMsg = self._process_init(request, attachShm=True)
+        # init ack always goes over ZMQ
+        self.socket.send(replyMsg)
+        return True
+
+    def _process_init(self, request, attachShm):
         simInitMsg = pb.SimInitMsg()
         simInitMsg.ParseFromString(request)
 
         self.simPid = int(simInitMsg.simProcessId)
         self.wafPid = int(simInitMsg.wafShellProcessId)
+        self.forkServer = simInitMsg.forkServer
+        self.episodeDone = False
         self._action_space = self._create_space(simInitMsg.actSpace)
         self._observation_space = self._create_space(simInitMsg.obsSpace)
 
+        # multi-agent mode, spaces keyed by agent id
+        self.multiAgent = len(simInitMsg.agents) > 0
+        if self.multiAgent:
+            actSpaces = {}
+            obsSpaces = {}
+            for agentDesc in simInitMsg.agents:
+                actSpaces[agentDesc.agentId] = self._create_space(agentDesc.actSpace)
+                obsSpaces[agentDesc.agentId] = self._create_space(agentDesc.obsSpace)
+            self._action_space = spaces.Dict(actSpaces)
+            self._observation_space = spaces.Dict(obsSpaces)
+
         reply = pb.SimInitAck()
         reply.done = True
         reply.stopSimReq = False
-        replyMsg = reply.SerializeToString()
-        self.socket.send(replyMsg)
-        return True
+
+        if simInitMsg.shmName and attachShm:
+            try:
+                self.shm = Ns3ShmChannel(simInitMsg.shmName, self.shmZeroCopy)
+                reply.shmAttached = True
+            except Exception as e:
+                print("Cannot attach to shared memory, using ZMQ transport: ", e)
+                self.shm = None
+
+        return reply.SerializeToString()
 
     def get_action_space(self):
         return self._action_space
@@ -177,12 +450,24 @@ class Ns3ZmqBridge(object):
         if self.newStateRx:
             return
 
-        request = self.socket.recv()
+        request = self._recv()
         envStateMsg = pb.EnvStateMsg()
         envStateMsg.ParseFromString(request)
 
-        self.obsData = self._create_data(envStateMsg.obsData)
-        self.reward = envStateMsg.reward
+        if self.multiAgent:
+            # only agents notified at this time stamp are present
+            self.obsData = {}
+            self.reward = {}
+            self.agentDone = {}
+            self.agentInfo = {}
+            for agentState in envStateMsg.agents:
+                self.obsData[agentState.agentId] = self._create_data(agentState.obsData)
+                self.reward[agentState.agentId] = agentState.reward
+                self.agentDone[agentState.agentId] = agentState.isGameOver
+                self.agentInfo[agentState.agentId] = agentState.info
+        else:
+            self.obsData = self._create_data(envStateMsg.obsData)
+            self.reward = envStateMsg.reward
         self.gameOver = envStateMsg.isGameOver
         self.gameOverReason = envStateMsg.reason
 
@@ -195,6 +480,8 @@ class Ns3ZmqBridge(object):
                 self.send_close_command()
 
         self.extraInfo = envStateMsg.info
+        if self.multiAgent:
+            self.extraInfo = self.agentInfo
         if not self.extraInfo:
             self.extraInfo = {}
 
@@ -205,22 +492,30 @@ class Ns3ZmqBridge(object):
         reply.stopSimReq = True
 
         replyMsg = reply.SerializeToString()
-        self.socket.send(replyMsg)
+        self._send(replyMsg)
         self.newStateRx = False
+        self.episodeDone = True
         return True
 
     def send_actions(self, actions):
         reply = pb.EnvActMsg()
 
-        actionMsg = self._pack_data(actions, self._action_space)
-        reply.actData.CopyFrom(actionMsg)
+        if self.multiAgent:
+            # actions of agents not present in the last state are ignored by the simulation
+            for agentId, agentAction in actions.items():
+                agentAct = reply.agents.add()
+                agentAct.agentId = agentId
+                agentAct.actData.CopyFrom(self._pack_data(agentAction, self._action_space.spaces[agentId]))
+        else:
+            actionMsg = self._pack_data(actions, self._action_space)
+            reply.actData.CopyFrom(actionMsg)
 
         reply.stopSimReq = False
         if self.forceEnvStop:
             reply.stopSimReq = True
 
         replyMsg = reply.SerializeToString()
-        self.socket.send(replyMsg)
+        self._send(replyMsg)
         self.newStateRx = False
         return True
 
@@ -245,6 +540,20 @@ class Ns3ZmqBridge(object):
             dataContainerPb.data.Unpack(boxContainerPb)
             # print(boxContainerPb.shape, boxContainerPb.dtype, boxContainerPb.uintData)
 
+            dtype = self.BOX_DTYPES.get(boxContainerPb.dtype, '<f4')
+            shape = tuple(boxContainerPb.shape)
+            if boxContainerPb.shmSize:
+                return self.shm.get_array(boxContainerPb.shmOffset, boxContainerPb.shmSize,
+                                          dtype, shape)
+
+            if boxContainerPb.rawData:
+                # packed encoding, copied out of the read-only message bytes so
+                # agents get a writable array as with the repeated fields
+                data = np.frombuffer(boxContainerPb.rawData, dtype=dtype).copy()
+                if shape and int(np.prod(shape)) == data.size:
+                    data = data.reshape(shape)
+                return data
+
             if boxContainerPb.dtype == pb.INT:
                 data = boxContainerPb.intData
             elif boxContainerPb.dtype == pb.UINT:
@@ -309,23 +618,22 @@ class Ns3ZmqBridge(object):
 
             if (spaceDesc.dtype in ['int', 'int8', 'int16', 'int32', 'int64']):
                 boxContainerPb.dtype = pb.INT
-                boxContainerPb.intData.extend(actions)
 
             elif (spaceDesc.dtype in ['uint', 'uint8', 'uint16', 'uint32', 'uint64']):
                 boxContainerPb.dtype = pb.UINT
-                boxContainerPb.uintData.extend(actions)
 
             elif (spaceDesc.dtype in ['float', 'float32', 'float64']):
                 boxContainerPb.dtype = pb.FLOAT
-                boxContainerPb.floatData.extend(actions)
 
             elif (spaceDesc.dtype in ['double']):
                 boxContainerPb.dtype = pb.DOUBLE
-                boxContainerPb.doubleData.extend(actions)
 
             else:
                 boxContainerPb.dtype = pb.FLOAT
-                boxContainerPb.floatData.extend(actions)
+
+            # packed encoding, one blob instead of a repeated field
+            dtype = self.BOX_DTYPES[boxContainerPb.dtype]
+            boxContainerPb.rawData = np.ascontiguousarray(actions, dtype=dtype).tobytes()
 
             dataContainer.data.Pack(boxContainerPb)
 
@@ -333,7 +641,7 @@ class Ns3ZmqBridge(object):
             dataContainer.type = pb.Tuple
             tupleDataPb = pb.TupleDataContainer()
 
-            spaceList = list(self._action_space.spaces)
+            spaceList = list(spaceDesc.spaces)
             subDataList = []
             for subAction, subActSpaceType in zip(actions, spaceList):
                 subData = self._pack_data(subAction, subActSpaceType)
@@ -348,7 +656,7 @@ class Ns3ZmqBridge(object):
 
             subDataList = []
             for sName, subAction in actions.items():
-                subActSpaceType = self._action_space.spaces[sName]
+                subActSpaceType = spaceDesc.spaces[sName]
                 subData = self._pack_data(subAction, subActSpaceType)
                 subData.name = sName
                 subDataList.append(subData)
@@ -360,13 +668,15 @@ class Ns3ZmqBridge(object):
 
 
 class Ns3Env(gym.Env):
-    def __init__(self, stepTime=0, port=0, startSim=True, simSeed=0, simArgs={}, debug=False):
+    def __init__(self, stepTime=0, port=0, startSim=True, simSeed=0, simArgs={}, debug=False, shmZeroCopy=False):
         self.stepTime = stepTime
         self.port = port
         self.startSim = startSim
         self.simSeed = simSeed
         self.simArgs = simArgs
         self.debug = debug
+        # observations as read-only views on the shared-memory ring, see Ns3ShmChannel
+        self.shmZeroCopy = shmZeroCopy
 
         # Filled in reset function
         self.ns3ZmqBridge = None
@@ -377,7 +687,8 @@ class Ns3Env(gym.Env):
         self.state = None
         self.steps_beyond_done = None
 
-        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug)
+        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug,
+                                         self.shmZeroCopy)
         self.ns3ZmqBridge.initialize_env(self.stepTime)
         self.action_space = self.ns3ZmqBridge.get_action_space()
         self.observation_space = self.ns3ZmqBridge.get_observation_space()
@@ -395,6 +706,9 @@ class Ns3Env(gym.Env):
         reward = self.ns3ZmqBridge.get_reward()
         done = self.ns3ZmqBridge.is_game_over()
         extraInfo = self.ns3ZmqBridge.get_extra_info()
+        if self.ns3ZmqBridge.multiAgent:
+            # per-agent done flags, '__all__' ends the whole env
+            done = dict(self.ns3ZmqBridge.agentDone, __all__=done)
         return (obs, reward, done, extraInfo)
 
     def step(self, action):
@@ -407,13 +721,18 @@ class Ns3Env(gym.Env):
             obs = self.ns3ZmqBridge.get_obs()
             return obs
 
-        if self.ns3ZmqBridge:
-            self.ns3ZmqBridge.close()
-            self.ns3ZmqBridge = None
-
         self.envDirty = False
-        self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug)
-        self.ns3ZmqBridge.initialize_env(self.stepTime)
+        if self.ns3ZmqBridge and self.ns3ZmqBridge.forkServer:
+            # simulation runs as fork server, no need to relaunch it
+            self.ns3ZmqBridge.restart_episode(self.stepTime)
+        else:
+            if self.ns3ZmqBridge:
+                self.ns3ZmqBridge.close()
+                self.ns3ZmqBridge = None
+
+            self.ns3ZmqBridge = Ns3ZmqBridge(self.port, self.startSim, self.simSeed, self.simArgs, self.debug,
+                                             self.shmZeroCopy)
+            self.ns3ZmqBridge.initialize_env(self.stepTime)
         self.action_space = self.ns3ZmqBridge.get_action_space()
         self.observation_space = self.ns3ZmqBridge.get_observation_space()
         # get first observations
@@ -421,6 +740,18 @@ class Ns3Env(gym.Env):
         obs = self.ns3ZmqBridge.get_obs()
         return obs
 
+    def save_snapshot(self):
+        # simulation state at the current step, restore it any number of times
+        return self.ns3ZmqBridge.save_snapshot()
+
+    def restore_snapshot(self, snapshotId):
+        self.ns3ZmqBridge.restore_snapshot(snapshotId, self.stepTime)
+        self.envDirty = True
+        return self.get_state()
+
+    def release_snapshot(self, snapshotId):
+        self.ns3ZmqBridge.release_snapshot(snapshotId)
+
     def render(self, mode='human'):
         return
 
@@ -434,4 +765,202 @@ class Ns3Env(gym.Env):
             self.ns3ZmqBridge = None
 
         if self.viewer:
-            self.viewer.close()
\ No newline at end of file
+            self.viewer.close()
+
+
+class Ns3VecEnvWorker(Ns3ZmqBridge):
+    """Single simulation of Ns3VecEnv, talks through the ROUTER socket of the vector env"""
+    def __init__(self, socket, identity, initMsg):
+        self.socket = socket
+        self.identity = identity
+        self.shm = None
+        self.forkServer = False
+        self.payload = None
+        self._reset_episode_state()
+
+        # shared memory would need one more wait primitive per worker, stay on ZMQ
+        replyMsg = self._process_init(initMsg, attachShm=False)
+        self._send(replyMsg)
+
+    def _send(self, msg):
+        self.socket.send_multipart([self.identity, b'', msg])
+
+    def _recv(self):
+        # the vector env receives for all workers and hands over the message
+        msg = self.payload
+        self.payload = None
+        return msg
+
+
+class Ns3VecEnv(object):
+    """N simulations behind one socket, following gym's VectorEnv semantics.
+
+    The simulation script runs as a fork server (ForkServer and ForkWorkers
+    attributes of OpenGymInterface) keeping numEnvs episode processes alive,
+    all of them connected to the same port. Every step sends the actions to
+    all of them before collecting the states, so the simulations run in
+    parallel. A finished episode is reset automatically: the server forks
+    a replacement whose first observation is returned in place of the final
+    one, which is put into infos[i]['terminal_observation']. A simulation
+    that does not answer within self.timeout ms raises a RuntimeError.
+    """
+    def __init__(self, numEnvs, stepTime=0, port=0, startSim=True, simSeed=0, simArgs={}, debug=False):
+        self.num_envs = int(numEnvs)
+        self.stepTime = stepTime
+        self.ns3Process = None
+        self.closed = False
+        self.timeout = 10000  # ms
+
+        context = zmq.Context()
+        self.socket = context.socket(zmq.ROUTER)
+        port = int(port)
+        try:
+            if port == 0 and startSim:
+                port = self.socket.bind_to_random_port('tcp://*', min_port=5001, max_port=10000, max_tries=100)
+                print("Got new port for ns3gm interface: ", port)
+
+            elif port == 0 and not startSim:
+                print("Cannot use port %s to bind" % str(port) )
+                print("Please specify correct port" )
+                sys.exit()
+
+            else:
+                self.socket.bind ("tcp://*:%s" % str(port))
+
+        except Exception as e:
+            print("Cannot bind to tcp://*:%s as port is already in use" % str(port) )
+            print("Please specify different port or use 0 to get free port" )
+            sys.exit()
+        self.port = port
+
+        if startSim:
+            if simSeed == 0:
+                maxSeed = np.iinfo(np.uint32).max
+                simSeed = np.random.randint(0, maxSeed)
+            simArgs = dict(simArgs)
+            simArgs["--OpenGymInterface::ForkServer"] = "true"
+            simArgs["--OpenGymInterface::ForkWorkers"] = self.num_envs
+            self.ns3Process = start_sim_script(port, simSeed, simArgs, debug)
+        else:
+            print("Waiting for simulation script to connect on port: tcp://localhost:{}".format(port))
+            print('Please start ns-3 simulation script with --OpenGymInterface::ForkServer=true --OpenGymInterface::ForkWorkers={}'.format(self.num_envs))
+
+        self.workers = [None] * self.num_envs
+        self.slots = {}
+        self._rx_states(range(self.num_envs))
+
+        self.single_observation_space = self.workers[0].get_observation_space()
+        self.single_action_space = self.workers[0].get_action_space()
+        self.observation_space = batch_space(self.single_observation_space, self.num_envs)
+        self.action_space = batch_space(self.single_action_space, self.num_envs)
+        self.envDirty = False
+
+    def _recv_frames(self, pending):
+        # a crashed or stuck episode process would otherwise block us forever
+        if not self.socket.poll(self.timeout):
+            raise RuntimeError("No state from the simulations of slots %s within %d ms"
+                               % (sorted(pending), self.timeout))
+        return self.socket.recv_multipart()
+
+    def _rx_states(self, slots):
+        pending = set(slots)
+        while pending:
+            frames = self._recv_frames(pending)
+            identity = frames[0]
+            msg = frames[-1]
+
+            slot = self.slots.get(identity)
+            if slot is None:
+                # new episode process, takes over a free slot; its first state follows
+                free = [i for i in pending if self.workers[i] is None]
+                if not free:
+                    raise RuntimeError("Unexpected episode process: all %d slots are busy, "
+                                       "check that ForkWorkers matches numEnvs" % self.num_envs)
+                slot = min(free)
+                self.workers[slot] = Ns3VecEnvWorker(self.socket, identity, msg)
+                self.slots[identity] = slot
+                continue
+
+            worker = self.workers[slot]
+            worker.payload = msg
+            worker.rx_env_state()
+            pending.discard(slot)
+
+    def _release(self, slot):
+        worker = self.workers[slot]
+        del self.slots[worker.identity]
+        self.workers[slot] = None
+
+    def _stack(self, obs):
+        if isinstance(self.single_observation_space, (spaces.Box, spaces.Discrete)):
+            return np.stack([np.asarray(o) for o in obs])
+        return tuple(obs)
+
+    def reset(self):
+        if self.envDirty:
+            for slot, worker in enumerate(self.workers):
+                worker.finish_episode()
+                self._release(slot)
+            self._rx_states(range(self.num_envs))
+            self.envDirty = False
+
+        return self._stack([worker.get_obs() for worker in self.workers])
+
+    def step(self, actions):
+        self.envDirty = True
+        for slot, worker in enumerate(self.workers):
+            worker.send_actions(actions[slot])
+        self._rx_states(range(self.num_envs))
+
+        obs = []
+        rewards = np.zeros(self.num_envs, dtype=np.float32)
+        dones = np.zeros(self.num_envs, dtype=bool)
+        infos = []
+        doneSlots = []
+        for slot, worker in enumerate(self.workers):
+            obs.append(worker.get_obs())
+            rewards[slot] = worker.get_reward()
+            dones[slot] = worker.is_game_over()
+            info = {'info': worker.get_extra_info()}
+            if dones[slot]:
+                # worker already told its episode process to stop
+                info['terminal_observation'] = obs[slot]
+                doneSlots.append(slot)
+                self._release(slot)
+            infos.append(info)
+
+        if doneSlots:
+            self._rx_states(doneSlots)
+            for slot in doneSlots:
+                obs[slot] = self.workers[slot].get_obs()
+
+        return (self._stack(obs), rewards, dones, infos)
+
+    def get_random_action(self):
+        return self.action_space.sample()
+
+    def close(self):
+        if self.closed:
+            return
+        self.closed = True
+        try:
+            for slot, worker in enumerate(self.workers):
+                if worker:
+                    worker.finish_episode()
+                    self._release(slot)
+
+            # fork server refills every slot, reject the replacements to stop it
+            reply = pb.SimInitAck()
+            reply.done = True
+            reply.stopSimReq = True
+            replyMsg = reply.SerializeToString()
+            for i in range(self.num_envs):
+                if not self.socket.poll(self.timeout):
+                    break
+                frames = self.socket.recv_multipart()
+                self.socket.send_multipart([frames[0], b'', replyMsg])
+
+            if self.ns3Process:
+                self.ns3Process.kill()
+        except Exception as e:
+            pass
@@ -0,0 +1,264 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/string.h"
+#include "opengym_agent.h"
+#include "container.h"
+#include "spaces.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OpenGymAgent");
+
+NS_OBJECT_ENSURE_REGISTERED (OpenGymAgent);
+NS_OBJECT_ENSURE_REGISTERED (OpenGymLinearAgent);
+
+template <typename T>
+static bool
+AppendBoxData (Ptr<OpenGymDataContainer> obs, std::vector<float> &values)
+{
+  Ptr<OpenGymBoxContainer<T> > box = DynamicCast<OpenGymBoxContainer<T> > (obs);
+  if (!box) {
+    return false;
+  }
+  std::vector<T> data = box->GetData();
+  for (uint32_t i = 0; i < data.size(); i++) {
+    values.push_back(static_cast<float>(data[i]));
+  }
+  return true;
+}
+
+template <typename T>
+static Ptr<OpenGymDataContainer>
+CreateBoxAction (Ptr<OpenGymBoxSpace> space, const std::vector<float> &values)
+{
+  Ptr<OpenGymBoxContainer<T> > box = CreateObject<OpenGymBoxContainer<T> > (space->GetShape());
+  float low = space->GetLow();
+  float high = space->GetHigh();
+  for (uint32_t i = 0; i < values.size(); i++) {
+    float value = values[i];
+    // spaces built from per-element bounds report zero for both
+    if (low < high) {
+      value = std::min(std::max(value, low), high);
+    }
+    box->SetValue(i, static_cast<T>(value));
+  }
+  return box;
+}
+
+
+TypeId
+OpenGymAgent::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::OpenGymAgent")
+    .SetParent<Object> ()
+    .SetGroupName ("OpenGym")
+    ;
+  return tid;
+}
+
+OpenGymAgent::OpenGymAgent()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+OpenGymAgent::~OpenGymAgent ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+OpenGymAgent::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_obsSpace = 0;
+  m_actSpace = 0;
+}
+
+void
+OpenGymAgent::SetSpaces(Ptr<OpenGymSpace> obsSpace, Ptr<OpenGymSpace> actSpace)
+{
+  NS_LOG_FUNCTION (this << obsSpace << actSpace);
+  m_obsSpace = obsSpace;
+  m_actSpace = actSpace;
+}
+
+void
+OpenGymAgent::FlattenObservation(Ptr<OpenGymDataContainer> obs, std::vector<float> &values)
+{
+  if (!obs) {
+    return;
+  }
+  Ptr<OpenGymDiscreteContainer> discrete = DynamicCast<OpenGymDiscreteContainer> (obs);
+  if (discrete) {
+    values.push_back(discrete->GetValue());
+    return;
+  }
+  Ptr<OpenGymTupleContainer> tuple = DynamicCast<OpenGymTupleContainer> (obs);
+  if (tuple) {
+    for (uint32_t i = 0; tuple->Get(i); i++) {
+      FlattenObservation(tuple->Get(i), values);
+    }
+    return;
+  }
+  if (AppendBoxData<float>(obs, values) || AppendBoxData<double>(obs, values)
+      || AppendBoxData<int32_t>(obs, values) || AppendBoxData<uint32_t>(obs, values)) {
+    return;
+  }
+  NS_LOG_WARN("Observation container not supported by local agents, skipped");
+}
+
+
+TypeId
+OpenGymLinearAgent::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::OpenGymLinearAgent")
+    .SetParent<OpenGymAgent> ()
+    .SetGroupName ("OpenGym")
+    .AddConstructor<OpenGymLinearAgent> ()
+    .AddAttribute ("WeightsFile",
+                   "Text file with one line per output: the bias followed by the weights of all observation values",
+                   StringValue (""),
+                   MakeStringAccessor (&OpenGymLinearAgent::m_weightsFile),
+                   MakeStringChecker ())
+    ;
+  return tid;
+}
+
+OpenGymLinearAgent::OpenGymLinearAgent()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+OpenGymLinearAgent::~OpenGymLinearAgent ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+OpenGymLinearAgent::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  OpenGymAgent::DoDispose();
+}
+
+void
+OpenGymLinearAgent::SetWeights(const std::vector<float> &weights, const std::vector<float> &bias)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ABORT_MSG_IF (bias.empty() || weights.size() % bias.size() != 0,
+                   "Linear agent needs the same number of weights for every output");
+  m_weights = weights;
+  m_bias = bias;
+}
+
+void
+OpenGymLinearAgent::LoadWeights()
+{
+  NS_LOG_FUNCTION (this << m_weightsFile);
+  std::ifstream file(m_weightsFile.c_str());
+  NS_ABORT_MSG_IF (!file.is_open(), "Cannot open weights file " << m_weightsFile);
+
+  std::vector<float> weights;
+  std::vector<float> bias;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream values(line);
+    float value;
+    if (!(values >> value)) {
+      continue;
+    }
+    bias.push_back(value);
+    while (values >> value) {
+      weights.push_back(value);
+    }
+  }
+  SetWeights(weights, bias);
+}
+
+void
+OpenGymLinearAgent::SetSpaces(Ptr<OpenGymSpace> obsSpace, Ptr<OpenGymSpace> actSpace)
+{
+  NS_LOG_FUNCTION (this << obsSpace << actSpace);
+  OpenGymAgent::SetSpaces(obsSpace, actSpace);
+  if (!m_weightsFile.empty()) {
+    LoadWeights();
+  }
+
+  uint32_t outputs = 0;
+  Ptr<OpenGymDiscreteSpace> discrete = DynamicCast<OpenGymDiscreteSpace> (actSpace);
+  Ptr<OpenGymBoxSpace> box = DynamicCast<OpenGymBoxSpace> (actSpace);
+  if (discrete) {
+    outputs = discrete->GetN();
+  } else if (box) {
+    std::vector<uint32_t> shape = box->GetShape();
+    outputs = 1;
+    for (uint32_t i = 0; i < shape.size(); i++) {
+      outputs *= shape[i];
+    }
+  } else {
+    NS_FATAL_ERROR ("Linear agent supports Discrete and Box action spaces only");
+  }
+  NS_ABORT_MSG_IF (m_bias.size() != outputs,
+                   "Linear agent has " << m_bias.size() << " outputs, action space needs " << outputs);
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymLinearAgent::GetAction(Ptr<OpenGymDataContainer> obs, float reward, bool gameOver, const std::string &info)
+{
+  NS_LOG_FUNCTION (this << obs << reward << gameOver << info);
+  m_obs.clear();
+  FlattenObservation(obs, m_obs);
+
+  uint32_t inputs = m_weights.size() / m_bias.size();
+  NS_ABORT_MSG_IF (m_obs.size() != inputs,
+                   "Linear agent expects " << inputs << " observation values, got " << m_obs.size());
+
+  m_out.resize(m_bias.size());
+  for (uint32_t i = 0; i < m_bias.size(); i++) {
+    const float *row = &m_weights[i * inputs];
+    float sum = m_bias[i];
+    for (uint32_t j = 0; j < inputs; j++) {
+      sum += row[j] * m_obs[j];
+    }
+    m_out[i] = sum;
+  }
+
+  Ptr<OpenGymBoxSpace> box = DynamicCast<OpenGymBoxSpace> (m_actSpace);
+  if (!box) {
+    Ptr<OpenGymDiscreteContainer> action = CreateObject<OpenGymDiscreteContainer> (m_out.size());
+    action->SetValue(std::max_element(m_out.begin(), m_out.end()) - m_out.begin());
+    return action;
+  }
+
+  switch (box->GetDtype()) {
+    case ns3opengym::INT:
+      return CreateBoxAction<int32_t>(box, m_out);
+    case ns3opengym::UINT:
+      return CreateBoxAction<uint32_t>(box, m_out);
+    case ns3opengym::DOUBLE:
+      return CreateBoxAction<double>(box, m_out);
+    default:
+      return CreateBoxAction<float>(box, m_out);
+  }
+}
+
+} // namespace ns3
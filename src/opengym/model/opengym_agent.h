@@ -0,0 +1,97 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OPENGYM_AGENT_H
+#define OPENGYM_AGENT_H
+
+#include "ns3/object.h"
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class OpenGymSpace;
+class OpenGymDataContainer;
+
+/**
+ * Policy running inside the simulation process.
+ *
+ * An OpenGymInterface with a local agent never talks to Python: every
+ * NotifyCurrentState() hands the state straight to GetAction() and
+ * executes the returned action through the usual callbacks, e.g. to
+ * evaluate a trained policy at native simulation speed.
+ */
+class OpenGymAgent : public Object
+{
+public:
+  OpenGymAgent ();
+  virtual ~OpenGymAgent ();
+
+  static TypeId GetTypeId ();
+
+  // called once before the first step
+  virtual void SetSpaces(Ptr<OpenGymSpace> obsSpace, Ptr<OpenGymSpace> actSpace);
+  // null leaves the env alone for this step
+  virtual Ptr<OpenGymDataContainer> GetAction(Ptr<OpenGymDataContainer> obs, float reward, bool gameOver, const std::string &info) = 0;
+
+  // Box, Discrete and Tuple containers flattened into one vector
+  static void FlattenObservation(Ptr<OpenGymDataContainer> obs, std::vector<float> &values);
+
+protected:
+  // Inherited
+  virtual void DoDispose (void);
+
+  Ptr<OpenGymSpace> m_obsSpace;
+  Ptr<OpenGymSpace> m_actSpace;
+};
+
+
+/**
+ * Reference agent computing W * obs + b on the flattened observation.
+ * A Discrete action space takes the index of the largest output, a Box
+ * one gets the outputs (clipped to the bounds of the space) as values.
+ */
+class OpenGymLinearAgent : public OpenGymAgent
+{
+public:
+  OpenGymLinearAgent ();
+  virtual ~OpenGymLinearAgent ();
+
+  static TypeId GetTypeId ();
+
+  // weights row-major, one row of obs size per output
+  void SetWeights(const std::vector<float> &weights, const std::vector<float> &bias);
+
+  virtual void SetSpaces(Ptr<OpenGymSpace> obsSpace, Ptr<OpenGymSpace> actSpace);
+  virtual Ptr<OpenGymDataContainer> GetAction(Ptr<OpenGymDataContainer> obs, float reward, bool gameOver, const std::string &info);
+
+protected:
+  // Inherited
+  virtual void DoDispose (void);
+
+private:
+  void LoadWeights ();
+
+  std::string m_weightsFile;
+  std::vector<float> m_weights;
+  std::vector<float> m_bias;
+  std::vector<float> m_obs;
+  std::vector<float> m_out;
+};
+
+} // end of namespace ns3
+
+#endif /* OPENGYM_AGENT_H */
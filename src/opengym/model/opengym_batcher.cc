@@ -0,0 +1,209 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <limits>
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "opengym_batcher.h"
+#include "container.h"
+#include "spaces.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OpenGymEventBatcher");
+
+NS_OBJECT_ENSURE_REGISTERED (OpenGymEventBatcher);
+
+TypeId
+OpenGymEventBatcher::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::OpenGymEventBatcher")
+    .SetParent<Object> ()
+    .SetGroupName ("OpenGym")
+    .AddConstructor<OpenGymEventBatcher> ()
+    .AddAttribute ("FlushWhenFull",
+                   "Call the flush callback as soon as the ring is full, "
+                   "otherwise the oldest samples are overwritten until the next observation",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&OpenGymEventBatcher::m_flushWhenFull),
+                   MakeBooleanChecker ())
+    ;
+  return tid;
+}
+
+OpenGymEventBatcher::OpenGymEventBatcher()
+  : m_featureNum(1),
+    m_capacity(64),
+    m_flushWhenFull(true),
+    m_flushing(false),
+    m_head(0),
+    m_count(0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+OpenGymEventBatcher::OpenGymEventBatcher(uint32_t featureNum, uint32_t capacity)
+  : m_featureNum(featureNum),
+    m_capacity(capacity),
+    m_flushWhenFull(true),
+    m_flushing(false),
+    m_head(0),
+    m_count(0)
+{
+  NS_LOG_FUNCTION (this << featureNum << capacity);
+  NS_ABORT_MSG_IF (featureNum == 0 || capacity == 0, "Event batcher needs at least one feature and one row");
+}
+
+OpenGymEventBatcher::~OpenGymEventBatcher ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+OpenGymEventBatcher::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_flushCb.Nullify();
+  m_obs = 0;
+  m_samplesBox = 0;
+  m_countBox = 0;
+  m_minBox = 0;
+  m_maxBox = 0;
+  m_meanBox = 0;
+}
+
+void
+OpenGymEventBatcher::SetFlushCallback(Callback<void> cb)
+{
+  NS_LOG_FUNCTION (this);
+  m_flushCb = cb;
+}
+
+void
+OpenGymEventBatcher::Reset()
+{
+  NS_LOG_FUNCTION (this);
+  m_ring.assign(static_cast<size_t>(m_capacity) * m_featureNum, 0.0);
+  m_min.assign(m_featureNum, std::numeric_limits<double>::max());
+  m_max.assign(m_featureNum, std::numeric_limits<double>::lowest());
+  m_sum.assign(m_featureNum, 0.0);
+  m_head = 0;
+  m_count = 0;
+}
+
+void
+OpenGymEventBatcher::AddSample(const std::vector<double> &sample)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ABORT_MSG_IF (sample.size() != m_featureNum,
+                   "Sample has " << sample.size() << " values, batcher expects " << m_featureNum);
+  if (m_ring.empty()) {
+    Reset();
+  }
+
+  double *row = &m_ring[static_cast<size_t>(m_head) * m_featureNum];
+  for (uint32_t i = 0; i < m_featureNum; i++) {
+    double value = sample[i];
+    row[i] = value;
+    m_min[i] = std::min(m_min[i], value);
+    m_max[i] = std::max(m_max[i], value);
+    m_sum[i] += value;
+  }
+  m_head = (m_head + 1) % m_capacity;
+  m_count++;
+
+  // the env's notification takes the observation, which starts the next batch
+  if (m_count >= m_capacity && m_flushWhenFull && !m_flushCb.IsNull() && !m_flushing) {
+    m_flushing = true;
+    m_flushCb();
+    m_flushing = false;
+  }
+}
+
+uint64_t
+OpenGymEventBatcher::GetCount() const
+{
+  return m_count;
+}
+
+Ptr<OpenGymSpace>
+OpenGymEventBatcher::GetObservationSpace(float low, float high)
+{
+  NS_LOG_FUNCTION (this << low << high);
+  std::string dtype = TypeNameGet<double> ();
+  std::vector<uint32_t> samplesShape = {m_capacity, m_featureNum};
+  std::vector<uint32_t> statsShape = {m_featureNum,};
+  std::vector<uint32_t> countShape = {1,};
+  float countHigh = m_flushWhenFull ? m_capacity : std::numeric_limits<uint32_t>::max();
+
+  Ptr<OpenGymDictSpace> space = CreateObject<OpenGymDictSpace> ();
+  space->Add("samples", CreateObject<OpenGymBoxSpace> (low, high, samplesShape, dtype));
+  space->Add("count", CreateObject<OpenGymBoxSpace> (0, countHigh, countShape, TypeNameGet<uint64_t> ()));
+  space->Add("min", CreateObject<OpenGymBoxSpace> (low, high, statsShape, dtype));
+  space->Add("max", CreateObject<OpenGymBoxSpace> (low, high, statsShape, dtype));
+  space->Add("mean", CreateObject<OpenGymBoxSpace> (low, high, statsShape, dtype));
+  return space;
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymEventBatcher::GetObservation()
+{
+  NS_LOG_FUNCTION (this << m_count);
+  if (m_ring.empty()) {
+    Reset();
+  }
+  if (!m_obs) {
+    std::vector<uint32_t> samplesShape = {m_capacity, m_featureNum};
+    std::vector<uint32_t> statsShape = {m_featureNum,};
+    std::vector<uint32_t> countShape = {1,};
+    m_samplesBox = CreateObject<OpenGymBoxContainer<double> > (samplesShape);
+    m_countBox = CreateObject<OpenGymBoxContainer<uint64_t> > (countShape);
+    m_minBox = CreateObject<OpenGymBoxContainer<double> > (statsShape);
+    m_maxBox = CreateObject<OpenGymBoxContainer<double> > (statsShape);
+    m_meanBox = CreateObject<OpenGymBoxContainer<double> > (statsShape);
+    m_obs = CreateObject<OpenGymDictContainer> ();
+    m_obs->Add("samples", m_samplesBox);
+    m_obs->Add("count", m_countBox);
+    m_obs->Add("min", m_minBox);
+    m_obs->Add("max", m_maxBox);
+    m_obs->Add("mean", m_meanBox);
+  }
+
+  // oldest row first: after a wrap it is the one m_head points at
+  uint32_t rows = m_count < m_capacity ? m_count : m_capacity;
+  uint32_t first = m_count < m_capacity ? 0 : m_head;
+  uint32_t idx = 0;
+  for (uint32_t r = 0; r < m_capacity; r++) {
+    const double *row = &m_ring[static_cast<size_t>((first + r) % m_capacity) * m_featureNum];
+    for (uint32_t i = 0; i < m_featureNum; i++) {
+      m_samplesBox->SetValue(idx++, r < rows ? row[i] : 0.0);
+    }
+  }
+  m_countBox->SetValue(0, m_count);
+  for (uint32_t i = 0; i < m_featureNum; i++) {
+    bool empty = (m_count == 0);
+    m_minBox->SetValue(i, empty ? 0.0 : m_min[i]);
+    m_maxBox->SetValue(i, empty ? 0.0 : m_max[i]);
+    m_meanBox->SetValue(i, empty ? 0.0 : m_sum[i] / m_count);
+  }
+
+  Reset();
+  return m_obs;
+}
+
+} // namespace ns3
@@ -0,0 +1,92 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OPENGYM_BATCHER_H
+#define OPENGYM_BATCHER_H
+
+#include "ns3/object.h"
+#include "ns3/callback.h"
+#include <vector>
+
+namespace ns3 {
+
+class OpenGymSpace;
+class OpenGymDataContainer;
+class OpenGymDictContainer;
+template <typename T> class OpenGymBoxContainer;
+
+/**
+ * Aggregation stage for event-driven envs.
+ *
+ * Instead of notifying the agent on every event (e.g. every ACK), an env
+ * adds the per-event samples to a ring of capacity rows and notifies at
+ * its step boundary, or from the flush callback once the ring is full.
+ * The observation is a Dict of
+ *  - "samples": Box (capacity x features), oldest row first, unused rows zero
+ *  - "count": Box (1), samples added since the previous observation
+ *  - "min", "max", "mean": Box (features) over all those samples
+ * and taking it starts the next batch.
+ */
+class OpenGymEventBatcher : public Object
+{
+public:
+  OpenGymEventBatcher ();
+  OpenGymEventBatcher (uint32_t featureNum, uint32_t capacity);
+  virtual ~OpenGymEventBatcher ();
+
+  static TypeId GetTypeId ();
+
+  // typically OpenGymEnv::Notify, without it a full ring overwrites its oldest rows
+  void SetFlushCallback(Callback<void> cb);
+  void AddSample(const std::vector<double> &sample);
+  uint64_t GetCount() const;
+
+  Ptr<OpenGymSpace> GetObservationSpace(float low, float high);
+  Ptr<OpenGymDataContainer> GetObservation();
+
+protected:
+  // Inherited
+  virtual void DoDispose (void);
+
+private:
+  void Reset ();
+
+  uint32_t m_featureNum;
+  uint32_t m_capacity;
+  bool m_flushWhenFull;
+  Callback<void> m_flushCb;
+  bool m_flushing;
+
+  // ring of m_capacity rows, m_head is the next one to write
+  std::vector<double> m_ring;
+  uint32_t m_head;
+  uint64_t m_count;
+  std::vector<double> m_min;
+  std::vector<double> m_max;
+  std::vector<double> m_sum;
+
+  // refilled for every observation
+  Ptr<OpenGymDictContainer> m_obs;
+  Ptr<OpenGymBoxContainer<double> > m_samplesBox;
+  Ptr<OpenGymBoxContainer<uint64_t> > m_countBox;
+  Ptr<OpenGymBoxContainer<double> > m_minBox;
+  Ptr<OpenGymBoxContainer<double> > m_maxBox;
+  Ptr<OpenGymBoxContainer<double> > m_meanBox;
+};
+
+} // end of namespace ns3
+
+#endif /* OPENGYM_BATCHER_H */
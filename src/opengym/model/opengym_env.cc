@@ -21,10 +21,12 @@
 
 #include "ns3/log.h"
 #include "ns3/object.h"
+#include "ns3/abort.h"
 #include "opengym_env.h"
 #include "container.h"
 #include "spaces.h"
 #include "opengym_interface.h"
+#include "opengym_agent.h"
 
 namespace ns3 {
 
@@ -43,6 +45,8 @@ OpenGymEnv::GetTypeId (void)
 }
 
 OpenGymEnv::OpenGymEnv()
+  : m_multiAgent(false),
+    m_agentId(0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -78,12 +82,46 @@ OpenGymEnv::SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface)
   openGymInterface->SetExecuteActionsCb( MakeCallback (&OpenGymEnv::ExecuteActions, this) );
 }
 
+void
+OpenGymEnv::SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface, uint32_t agentId)
+{
+  NS_LOG_FUNCTION (this << agentId);
+  m_openGymInterface = openGymInterface;
+  m_multiAgent = true;
+  m_agentId = agentId;
+  openGymInterface->AddAgent(agentId, this);
+}
+
+uint32_t
+OpenGymEnv::GetAgentId() const
+{
+  return m_agentId;
+}
+
+void
+OpenGymEnv::SetLocalAgent(Ptr<OpenGymAgent> agent)
+{
+  NS_LOG_FUNCTION (this << agent);
+  NS_ABORT_MSG_IF (!m_openGymInterface, "Env has to be attached to an OpenGymInterface first");
+  if (m_multiAgent)
+  {
+    m_openGymInterface->SetLocalAgent(m_agentId, agent);
+    return;
+  }
+  m_openGymInterface->SetLocalAgent(agent);
+}
+
 void
 OpenGymEnv::Notify()
 {
   NS_LOG_FUNCTION (this);
   if (m_openGymInterface)
   {
+    if (m_multiAgent)
+    {
+      m_openGymInterface->NotifyAgent(m_agentId);
+      return;
+    }
     m_openGymInterface->Notify(this);
   }
 }
@@ -29,6 +29,7 @@ namespace ns3 {
 class OpenGymSpace;
 class OpenGymDataContainer;
 class OpenGymInterface;
+class OpenGymAgent;
 
 class OpenGymEnv : public Object
 {
@@ -49,6 +50,11 @@ public:
   virtual bool ExecuteActions(Ptr<OpenGymDataContainer> action) = 0;
 
   void SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface);
+  // multi-agent mode, several envs share one interface
+  void SetOpenGymInterface(Ptr<OpenGymInterface> openGymInterface, uint32_t agentId);
+  uint32_t GetAgentId() const;
+  // answer this env with a policy running in the simulation, see OpenGymInterface::SetLocalAgent
+  void SetLocalAgent(Ptr<OpenGymAgent> agent);
   void Notify();
   void NotifySimulationEnd();
 
@@ -60,6 +66,8 @@ protected:
 
   Ptr<OpenGymInterface> m_openGymInterface;
 private:
+  bool m_multiAgent;
+  uint32_t m_agentId;
 
 };
 
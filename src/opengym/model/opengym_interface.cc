@@ -19,13 +19,24 @@
  *
  */
 
+#include <sys/mman.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
 #include "ns3/log.h"
 #include "ns3/config.h"
 #include "ns3/simulator.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/rng-seed-manager.h"
 #include "opengym_interface.h"
+#include "opengym_shm.h"
 #include "opengym_env.h"
+#include "opengym_agent.h"
 #include "container.h"
 #include "spaces.h"
 #include "messages.pb.h"
@@ -36,6 +47,29 @@ NS_LOG_COMPONENT_DEFINE ("OpenGymInterface");
 
 NS_OBJECT_ENSURE_REGISTERED (OpenGymInterface);
 
+OpenGymStepStats::OpenGymStepStats ()
+  : step (0),
+    simTime (Seconds (0)),
+    events (0),
+    simWallTime (Seconds (0)),
+    serializeTime (Seconds (0)),
+    recvWaitTime (Seconds (0))
+{
+}
+
+namespace {
+
+Time
+WallTimeSince (std::chrono::steady_clock::time_point start)
+{
+  return NanoSeconds (std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now () - start).count ());
+}
+
+} // anonymous namespace
+
+// exit status of an episode process telling the fork server to quit
+static const int FORK_SERVER_SHUTDOWN = 3;
+
 
 TypeId
 OpenGymInterface::GetTypeId (void)
@@ -44,6 +78,60 @@ OpenGymInterface::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName ("OpenGym")
     .AddConstructor<OpenGymInterface> ()
+    .AddAttribute ("ShmTransport",
+                   "Exchange step messages over a shared-memory ring instead of ZMQ "
+                   "if the agent runs on the same host. ZMQ stays in use otherwise.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&OpenGymInterface::m_shmEnabled),
+                   MakeBooleanChecker ())
+    .AddAttribute ("ShmSlotNum",
+                   "Number of slots per direction of the shared-memory ring. "
+                   "Observations stay valid in the agent for ShmSlotNum-1 further steps.",
+                   UintegerValue (2),
+                   MakeUintegerAccessor (&OpenGymInterface::m_shmSlotNum),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("ShmSlotSize",
+                   "Size of a shared-memory slot in bytes, has to hold the whole message including Box data",
+                   UintegerValue (4 << 20),
+                   MakeUintegerAccessor (&OpenGymInterface::m_shmSlotSize),
+                   MakeUintegerChecker<uint32_t> (4096))
+    .AddAttribute ("ActionDelay",
+                   "Simulation time between publishing a state and applying the agent's action to it. "
+                   "Zero blocks the simulation until the action arrives, otherwise the simulation keeps "
+                   "running while the agent computes and waits only if the action is late.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&OpenGymInterface::m_actionDelay),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("ForkServer",
+                   "Serve episodes by a fork server started at the first NotifyCurrentState(), "
+                   "unless EnableForkServer() set an earlier checkpoint",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&OpenGymInterface::m_forkServer),
+                   MakeBooleanChecker ())
+    .AddAttribute ("ForkWorkers",
+                   "Number of episode processes the fork server keeps running at the same time, "
+                   "all of them connect to the same port (see Ns3VecEnv)",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&OpenGymInterface::m_forkWorkers),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxSnapshots",
+                   "Maximum number of snapshots the agent can hold at the same time",
+                   UintegerValue (64),
+                   MakeUintegerAccessor (&OpenGymInterface::m_maxSnapshots),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("StepStatsInterval",
+                   "Print a summary of the StepStats averaged over this many steps, zero disables it",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&OpenGymInterface::m_statsInterval),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddTraceSource ("EpisodeStart",
+                     "A new episode process was forked by the fork server, argument is the episode index",
+                     MakeTraceSourceAccessor (&OpenGymInterface::m_episodeStartTrace),
+                     "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("StepStats",
+                     "Wall time split of a step between simulation, serialization and waiting for the agent",
+                     MakeTraceSourceAccessor (&OpenGymInterface::m_stepStatsTrace),
+                     "ns3::OpenGymInterface::StepStatsTracedCallback")
     ;
   return tid;
 }
@@ -78,7 +166,12 @@ OpenGymInterface::Delete (void)
 }
 
 OpenGymInterface::OpenGymInterface(uint32_t port):
-  m_port(port), m_zmq_context(1), m_zmq_socket(m_zmq_context, ZMQ_REQ),
+  m_port(port), m_zmq_context(1),
+  m_shmEnabled(false), m_shmSlotNum(2), m_shmSlotSize(4 << 20),
+  m_actionDelay(Seconds (0)), m_replyPending(false),
+  m_forkServer(false), m_forkWorkers(1), m_forkChild(false), m_episode(0),
+  m_stepEventStart(0), m_statsInterval(0), m_statsSumSteps(0),
+  m_maxSnapshots(64), m_snapshotTable(0), m_snapshotResumed(false), m_restoredSnapshot(0),
   m_simEnd(false), m_stopEnvRequested(false), m_initSimMsgSent(false)
 {
   NS_LOG_FUNCTION (this);
@@ -93,6 +186,18 @@ void
 OpenGymInterface::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
+  m_shm = 0;
+  m_agentFlushEvent.Cancel ();
+  m_agents.clear ();
+  m_readyAgents.clear ();
+  m_localAgent = 0;
+  m_localAgents.clear ();
+  m_stateObs.clear ();
+  if (m_snapshotTable)
+    {
+      ::munmap (m_snapshotTable, m_maxSnapshots * sizeof (int32_t));
+      m_snapshotTable = 0;
+    }
 }
 
 void
@@ -160,6 +265,13 @@ OpenGymInterface::Init()
   }
   m_initSimMsgSent = true;
 
+  if (HasLocalAgent()) {
+    InitLocalAgents();
+    return;
+  }
+
+  // created only now, the fork server must not own a socket (and ZMQ I/O thread) while forking
+  m_zmq_socket = zmq::socket_t(m_zmq_context, ZMQ_REQ);
   std::string connectAddr = "tcp://localhost:" + std::to_string(m_port);
   zmq_connect ((void*)m_zmq_socket, connectAddr.c_str());
 
@@ -173,6 +285,8 @@ OpenGymInterface::Init()
   ns3opengym::SimInitMsg simInitMsg;
   simInitMsg.set_simprocessid(::getpid());
   simInitMsg.set_wafshellprocessid(::getppid());
+  simInitMsg.set_forkserver(m_forkChild);
+  simInitMsg.set_restoredsnapshot(m_restoredSnapshot);
 
   if (obsSpace) {
     ns3opengym::SpaceDescription spaceDesc;
@@ -186,36 +300,336 @@ OpenGymInterface::Init()
     simInitMsg.mutable_actspace()->CopyFrom(spaceDesc);
   }
 
+  for (std::map<uint32_t, Ptr<OpenGymEnv> >::iterator it = m_agents.begin(); it != m_agents.end(); ++it) {
+    ns3opengym::AgentSpaceDescription *agentDesc = simInitMsg.add_agents();
+    agentDesc->set_agentid(it->first);
+    Ptr<OpenGymSpace> agentObsSpace = it->second->GetObservationSpace();
+    if (agentObsSpace) {
+      agentDesc->mutable_obsspace()->CopyFrom(agentObsSpace->GetSpaceDescription());
+    }
+    Ptr<OpenGymSpace> agentActSpace = it->second->GetActionSpace();
+    if (agentActSpace) {
+      agentDesc->mutable_actspace()->CopyFrom(agentActSpace->GetSpaceDescription());
+    }
+  }
+
+  // offer shared memory, the agent attaches to it before sending the ack
+  Ptr<OpenGymShmChannel> shm;
+  if (m_shmEnabled) {
+    shm = Create<OpenGymShmChannel> ();
+    std::string shmName = "/ns3gym-" + std::to_string(::getpid()) + "-" + std::to_string(m_port);
+    if (shm->Create(shmName, m_shmSlotNum, m_shmSlotSize)) {
+      simInitMsg.set_shmname(shmName);
+    } else {
+      NS_LOG_UNCOND("Cannot create shared-memory segment, using ZMQ transport");
+      shm = 0;
+    }
+  }
+
   // send init msg to python
-  zmq::message_t request(simInitMsg.ByteSize());;
-  simInitMsg.SerializeToArray(request.data(), simInitMsg.ByteSize());
-  m_zmq_socket.send (request, zmq::send_flags::none);
+  SendMsg(simInitMsg);
 
   // receive init ack msg form python
   ns3opengym::SimInitAck simInitAck;
-  zmq::message_t reply;
-  (void) m_zmq_socket.recv (reply, zmq::recv_flags::none);
-  simInitAck.ParseFromArray(reply.data(), reply.size());
+  RecvMsg(simInitAck);
 
   bool done = simInitAck.done();
   NS_LOG_DEBUG("Sim Init Ack: " << done);
 
+  if (shm) {
+    // both sides have it mapped now, so nothing is left behind if one of them crashes
+    shm->Unlink();
+    if (simInitAck.shmattached()) {
+      NS_LOG_UNCOND("Using shared-memory transport: " << shm->GetName());
+      m_shm = shm;
+    } else {
+      NS_LOG_UNCOND("Agent did not attach to shared memory, using ZMQ transport");
+    }
+  }
+
   bool stopSim = simInitAck.stopsimreq();
   if (stopSim) {
     NS_LOG_DEBUG("---Stop requested: " << stopSim);
     m_stopEnvRequested = true;
     Simulator::Stop();
     Simulator::Destroy ();
-    std::exit(0);
+    // agent does not want another episode, let the fork server quit as well
+    std::exit(m_forkChild ? FORK_SERVER_SHUTDOWN : 0);
+  }
+
+  // waiting for the agent to connect is not part of any step
+  ResetStepStats();
+}
+
+void
+OpenGymInterface::EnableForkServer(Time checkpoint)
+{
+  NS_LOG_FUNCTION (this << checkpoint);
+  NS_ABORT_MSG_IF (m_initSimMsgSent, "Fork server has to be enabled before the first NotifyCurrentState()");
+  m_forkServer = true;
+  Simulator::Schedule (checkpoint, &OpenGymInterface::RunForkServer, this);
+}
+
+void
+OpenGymInterface::RunForkServer()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_forkChild) {
+    // episode process, server was started already
+    return;
+  }
+  NS_ABORT_MSG_IF (m_initSimMsgSent, "Fork server reached its checkpoint after the first NotifyCurrentState()");
+  NS_ABORT_MSG_IF (HasLocalAgent(), "Fork server serves episodes to a Python agent, not to a local one");
+
+  NS_LOG_UNCOND("Fork server process id: " << ::getpid() << ", serving episodes from t=" << Simulator::Now().GetSeconds()
+                << "s with " << m_forkWorkers << " worker(s)");
+  uint64_t baseRun = RngSeedManager::GetRun ();
+  uint32_t running = 0;
+  bool stopping = false;
+  int exitCode = 0;
+
+  while (true) {
+    while (!stopping && running < m_forkWorkers) {
+      // do not let the child print out buffered output for the second time
+      std::cout.flush();
+      std::cerr.flush();
+      std::fflush(NULL);
+
+      pid_t pid = ::fork();
+      NS_ABORT_MSG_IF (pid < 0, "Fork server cannot fork: " << std::strerror(errno));
+      if (pid == 0) {
+        // child runs the episode from the checkpoint on
+        m_forkChild = true;
+        RngSeedManager::SetRun (baseRun + m_episode);
+        m_episodeStartTrace (m_episode);
+        return;
+      }
+      running++;
+      m_episode++;
+    }
+
+    if (running == 0) {
+      break;
+    }
+
+    int status = 0;
+    pid_t pid = ::waitpid(-1, &status, 0);
+    if (pid < 0) {
+      NS_ABORT_MSG_IF (errno != EINTR, "Fork server cannot wait for episodes: " << std::strerror(errno));
+      continue;
+    }
+    running--;
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+      // episode finished, agent will reset
+      continue;
+    }
+
+    // do not start new episodes, wait for the remaining ones
+    stopping = true;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != FORK_SERVER_SHUTDOWN) {
+      NS_LOG_UNCOND("Episode process " << pid << " failed, stopping fork server");
+      exitCode = 1;
+    }
+  }
+
+  NS_LOG_UNCOND("Fork server served " << m_episode << " episodes");
+  Simulator::Stop();
+  Simulator::Destroy ();
+  std::exit(exitCode);
+}
+
+bool
+OpenGymInterface::ProcessSnapshotCmd(ns3opengym::EnvActMsg::SnapshotCmd cmd, uint64_t snapshotId)
+{
+  NS_LOG_FUNCTION (this << cmd << snapshotId);
+  ns3opengym::EnvStateMsg ackMsg;
+  if (cmd == ns3opengym::EnvActMsg::SaveSnapshot) {
+    ackMsg.set_snapshotid(SaveSnapshot());
+    if (m_snapshotResumed) {
+      m_snapshotResumed = false;
+      return true;
+    }
+  } else if (cmd == ns3opengym::EnvActMsg::RestoreSnapshot) {
+    // ids come from the agent, never signal anything else than our own snapshots
+    if (IsSnapshot(snapshotId)) {
+      RestoreSnapshot(snapshotId);
+    } else {
+      NS_LOG_WARN("Unknown snapshot " << snapshotId);
+    }
+  } else if (cmd == ns3opengym::EnvActMsg::ReleaseSnapshot) {
+    if (IsSnapshot(snapshotId) && ::kill(snapshotId, SIGTERM) == 0) {
+      ackMsg.set_snapshotid(snapshotId);
+    }
+  }
+  SendMsg(ackMsg);
+  return false;
+}
+
+uint64_t
+OpenGymInterface::SaveSnapshot()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_forkServer || !m_actionDelay.IsZero()) {
+    NS_LOG_WARN("Snapshots are not available with the fork server or a non-zero ActionDelay");
+    return 0;
+  }
+
+  if (!m_snapshotTable) {
+    void *addr = ::mmap(0, m_maxSnapshots * sizeof(int32_t), PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      NS_LOG_WARN("Cannot map snapshot table: " << std::strerror(errno));
+      return 0;
+    }
+    m_snapshotTable = static_cast<int32_t*>(addr);
+  }
+
+  // the frozen process must not miss a signal sent before it waits for it
+  sigset_t signals;
+  sigset_t oldMask;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGUSR1);
+  sigaddset(&signals, SIGTERM);
+  sigaddset(&signals, SIGCHLD);
+  sigprocmask(SIG_BLOCK, &signals, &oldMask);
+
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(NULL);
+
+  pid_t pid = ::fork();
+  if (pid == 0) {
+    // returns in a process resumed from the snapshot only
+    RunSnapshotHolder(oldMask);
+    return 0;
+  }
+  sigprocmask(SIG_SETMASK, &oldMask, 0);
+  if (pid < 0) {
+    NS_LOG_WARN("Cannot fork snapshot: " << std::strerror(errno));
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < m_maxSnapshots; i++) {
+    int32_t expected = 0;
+    if (__atomic_compare_exchange_n(&m_snapshotTable[i], &expected, pid, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      NS_LOG_DEBUG("Snapshot " << pid << " at t=" << Simulator::Now().GetSeconds() << "s");
+      return pid;
+    }
+  }
+  NS_LOG_WARN("All " << m_maxSnapshots << " snapshots in use, release some or increase MaxSnapshots");
+  ::kill(pid, SIGTERM);
+  return 0;
+}
+
+bool
+OpenGymInterface::IsSnapshot(uint64_t snapshotId) const
+{
+  if (!m_snapshotTable || snapshotId == 0) {
+    return false;
+  }
+  for (uint32_t i = 0; i < m_maxSnapshots; i++) {
+    if (static_cast<uint64_t>(__atomic_load_n(&m_snapshotTable[i], __ATOMIC_ACQUIRE)) == snapshotId) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+OpenGymInterface::RestoreSnapshot(uint64_t snapshotId)
+{
+  NS_LOG_FUNCTION (this << snapshotId);
+  ns3opengym::EnvStateMsg ackMsg;
+  ackMsg.set_snapshotid(snapshotId);
+  SendMsg(ackMsg);
+  // wake the snapshot only once the agent took the ack, so its init message cannot overtake it
+  ns3opengym::EnvActMsg confirmMsg;
+  RecvMsg(confirmMsg);
+  if (::kill(snapshotId, SIGUSR1) != 0) {
+    NS_LOG_ERROR("Cannot wake snapshot " << snapshotId << ": " << std::strerror(errno));
+  }
+
+  // the agent goes on with the process resumed from the snapshot
+  m_stopEnvRequested = true;
+  Simulator::Stop();
+  Simulator::Destroy ();
+  std::exit(0);
+}
+
+void
+OpenGymInterface::RunSnapshotHolder(const sigset_t &oldMask)
+{
+  NS_LOG_FUNCTION (this);
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGUSR1);
+  sigaddset(&signals, SIGTERM);
+  sigaddset(&signals, SIGCHLD);
+
+  while (true) {
+    int sig = 0;
+    if (sigwait(&signals, &sig) != 0) {
+      continue;
+    }
+
+    if (sig == SIGCHLD) {
+      // a process resumed from this snapshot finished
+      while (::waitpid(-1, 0, WNOHANG) > 0) {}
+      continue;
+    }
+
+    if (sig == SIGTERM) {
+      int32_t self = ::getpid();
+      for (uint32_t i = 0; i < m_maxSnapshots; i++) {
+        int32_t expected = self;
+        __atomic_compare_exchange_n(&m_snapshotTable[i], &expected, 0, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+      }
+      // neither destructors nor exit handlers, they would touch the parent's ZMQ context
+      ::_exit(0);
+    }
+
+    pid_t pid = ::fork();
+    if (pid == 0) {
+      sigprocmask(SIG_SETMASK, &oldMask, 0);
+      ResumeFromSnapshot(::getppid());
+      return;
+    }
+    if (pid < 0) {
+      NS_LOG_WARN("Cannot resume snapshot: " << std::strerror(errno));
+    }
   }
 }
 
+void
+OpenGymInterface::ResumeFromSnapshot(uint64_t snapshotId)
+{
+  NS_LOG_FUNCTION (this << snapshotId);
+  // the I/O thread of the inherited ZMQ context did not survive the fork and
+  // closing its socket would block forever, both are left behind on purpose
+  new zmq::socket_t (std::move (m_zmq_socket));
+  new zmq::context_t (std::move (m_zmq_context));
+  m_zmq_context = zmq::context_t (1);
+
+  m_shm = 0;
+  m_actMsgQueue.clear();
+  m_replyPending = false;
+  m_initSimMsgSent = false;
+  m_restoredSnapshot = snapshotId;
+  m_snapshotResumed = true;
+  NS_LOG_UNCOND("Resumed from snapshot " << snapshotId << " at t=" << Simulator::Now().GetSeconds() << "s");
+}
+
 void
 OpenGymInterface::NotifyCurrentState()
 {
   NS_LOG_FUNCTION (this);
 
   if (!m_initSimMsgSent) {
+    if (m_forkServer) {
+      // returns in the episode process only
+      RunForkServer();
+    }
     Init();
   }
 
@@ -223,66 +637,469 @@ OpenGymInterface::NotifyCurrentState()
     return;
   }
 
+  if (!m_agents.empty()) {
+    // explicit notification (and the simulation end) covers all agents
+    for (std::map<uint32_t, Ptr<OpenGymEnv> >::iterator it = m_agents.begin(); it != m_agents.end(); ++it) {
+      m_readyAgents.insert(it->first);
+    }
+    ExchangeAgentStates();
+    return;
+  }
+
+  if (m_localAgent) {
+    StepLocalAgent();
+    return;
+  }
+
   // collect current env state
   Ptr<OpenGymDataContainer> obsDataContainer = GetObservation();
   float reward = GetReward();
   bool isGameOver = IsGameOver();
   std::string extraInfo = GetExtraInfo();
 
-  ns3opengym::EnvStateMsg envStateMsg;
+  StatsClock::time_point serializeStart = StatsClock::now();
+  // reserve slot, so Box data can be written straight into shared memory
+  if (m_shm) {
+    m_shm->BeginRequest();
+  }
+
+  ns3opengym::EnvStateMsg &envStateMsg = m_envStateMsg;
+  m_stateObs.clear();
+  m_stateObs.push_back(obsDataContainer);
   // observation
-  ns3opengym::DataContainer obsDataContainerPbMsg;
   if (obsDataContainer) {
-    obsDataContainerPbMsg = obsDataContainer->GetDataContainerPbMsg();
-    envStateMsg.mutable_obsdata()->CopyFrom(obsDataContainerPbMsg);
+    obsDataContainer->FillDataContainerPbMsg(*envStateMsg.mutable_obsdata(), m_shm);
+  } else {
+    envStateMsg.clear_obsdata();
   }
   // reward
   envStateMsg.set_reward(reward);
   // game over
   envStateMsg.set_isgameover(false);
+  envStateMsg.set_reason(ns3opengym::EnvStateMsg::SimulationEnd);
   if (isGameOver)
   {
     envStateMsg.set_isgameover(true);
-    if (m_simEnd) {
-      envStateMsg.set_reason(ns3opengym::EnvStateMsg::SimulationEnd);
-    } else {
+    if (!m_simEnd) {
       envStateMsg.set_reason(ns3opengym::EnvStateMsg::GameOver);
     }
   }
 
   // extra info
   envStateMsg.set_info(extraInfo);
+  m_stepStats.serializeTime += WallTimeSince(serializeStart);
+
+  ExchangeStateMsg(envStateMsg);
+}
+
+void
+OpenGymInterface::ExchangeStateMsg(const ns3opengym::EnvStateMsg &envStateMsg)
+{
+  NS_LOG_FUNCTION (this);
+  // the end of an episode is always handled in lockstep
+  bool sync = m_actionDelay.IsZero() || envStateMsg.isgameover() || m_simEnd;
+
+  // REQ socket: reply to the previous state has to be in before sending the next one
+  if (m_replyPending) {
+    ReceiveActMsg();
+  }
 
   // send env state msg to python
-  zmq::message_t request(envStateMsg.ByteSize());;
-  envStateMsg.SerializeToArray(request.data(), envStateMsg.ByteSize());
-  m_zmq_socket.send (request, zmq::send_flags::none);
+  SendMsg(envStateMsg);
+  m_replyPending = true;
 
-  // receive act msg form python
-  ns3opengym::EnvActMsg envActMsg;
-  zmq::message_t reply;
-  (void) m_zmq_socket.recv (reply, zmq::recv_flags::none);
-  envActMsg.ParseFromArray(reply.data(), reply.size());
+  if (!sync) {
+    // keep simulating while the agent computes its action
+    Simulator::Schedule(m_actionDelay, &OpenGymInterface::ApplyActMsg, this);
+    FinishStepStats();
+    return;
+  }
 
+  while (!ReceiveActMsg()) {
+    // resumed from a snapshot taken at this step, the agent gets the same state again
+    Init();
+    if (m_shm) {
+      m_shm->BeginRequest();
+    }
+    // blobs in the old shared-memory segment are gone, fill the observations once more
+    for (uint32_t i = 0; i < m_stateObs.size(); i++) {
+      if (!m_stateObs[i]) {
+        continue;
+      }
+      ns3opengym::DataContainer *obsData = m_agents.empty() ?
+        m_envStateMsg.mutable_obsdata() : m_envStateMsg.mutable_agents(i)->mutable_obsdata();
+      m_stateObs[i]->FillDataContainerPbMsg(*obsData, m_shm);
+    }
+    SendMsg(envStateMsg);
+    m_replyPending = true;
+  }
+  FinishStepStats();
   if (m_simEnd) {
     // if sim end only rx ms and quit
+    m_actMsgQueue.clear();
     return;
   }
+  ApplyActMsg();
+}
 
-  bool stopSim = envActMsg.stopsimreq();
-  if (stopSim) {
-    NS_LOG_DEBUG("---Stop requested: " << stopSim);
-    m_stopEnvRequested = true;
-    Simulator::Stop();
-    Simulator::Destroy ();
-    std::exit(0);
+bool
+OpenGymInterface::ReceiveActMsg()
+{
+  NS_LOG_FUNCTION (this);
+  // receive act msg form python
+  m_actMsgQueue.push_back(ns3opengym::EnvActMsg());
+  ns3opengym::EnvActMsg &envActMsg = m_actMsgQueue.back();
+  while (true) {
+    RecvMsg(envActMsg);
+    m_replyPending = false;
+
+    if (m_simEnd) {
+      return true;
+    }
+
+    bool stopSim = envActMsg.stopsimreq();
+    if (stopSim) {
+      NS_LOG_DEBUG("---Stop requested: " << stopSim);
+      m_stopEnvRequested = true;
+      Simulator::Stop();
+      Simulator::Destroy ();
+      std::exit(0);
+    }
+
+    if (envActMsg.snapshotcmd() == ns3opengym::EnvActMsg::NoSnapshotCmd) {
+      return true;
+    }
+    // acked right away, the agent answers the state once more afterwards
+    if (ProcessSnapshotCmd(envActMsg.snapshotcmd(), envActMsg.snapshotid())) {
+      return false;
+    }
+  }
+}
+
+void
+OpenGymInterface::ApplyActMsg()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_actMsgQueue.empty()) {
+    // action is due, wait for the agent if it is late
+    NS_ASSERT (m_replyPending);
+    ReceiveActMsg();
+  }
+  ns3opengym::EnvActMsg envActMsg;
+  envActMsg.Swap(&m_actMsgQueue.front());
+  m_actMsgQueue.pop_front();
+
+  if (!m_agents.empty()) {
+    // agents without an action (e.g. first step after reset) are left alone
+    for (int i = 0; i < envActMsg.agents_size(); i++) {
+      const ns3opengym::AgentAct &agentAct = envActMsg.agents(i);
+      std::map<uint32_t, Ptr<OpenGymEnv> >::iterator it = m_agents.find(agentAct.agentid());
+      if (it == m_agents.end()) {
+        NS_LOG_WARN("Action for unknown agent " << agentAct.agentid());
+        continue;
+      }
+      Ptr<OpenGymDataContainer> actDataContainer = OpenGymDataContainer::CreateFromDataContainerPbMsg(agentAct.actdata());
+      it->second->ExecuteActions(actDataContainer);
+    }
+    return;
   }
 
   // first step after reset is called without actions, just to get current state
-  ns3opengym::DataContainer actDataContainerPbMsg = envActMsg.actdata();
-  Ptr<OpenGymDataContainer> actDataContainer = OpenGymDataContainer::CreateFromDataContainerPbMsg(actDataContainerPbMsg);
+  Ptr<OpenGymDataContainer> actDataContainer = OpenGymDataContainer::CreateFromDataContainerPbMsg(envActMsg.actdata());
   ExecuteActions(actDataContainer);
+}
+
+void
+OpenGymInterface::AddAgent(uint32_t agentId, Ptr<OpenGymEnv> agent)
+{
+  NS_LOG_FUNCTION (this << agentId << agent);
+  NS_ABORT_MSG_IF (m_initSimMsgSent, "Agents have to be added before the first notification");
+  NS_ABORT_MSG_IF (m_agents.find(agentId) != m_agents.end(), "Agent " << agentId << " already added");
+  m_agents[agentId] = agent;
+}
+
+void
+OpenGymInterface::NotifyAgent(uint32_t agentId)
+{
+  NS_LOG_FUNCTION (this << agentId);
+  NS_ASSERT_MSG (m_agents.find(agentId) != m_agents.end(), "Unknown agent " << agentId);
+  m_readyAgents.insert(agentId);
+  // let the other agents scheduled for this time stamp join the same round trip
+  if (!m_agentFlushEvent.IsRunning()) {
+    m_agentFlushEvent = Simulator::ScheduleNow(&OpenGymInterface::FlushAgents, this);
+  }
+}
+
+void
+OpenGymInterface::SetLocalAgent(Ptr<OpenGymAgent> agent)
+{
+  NS_LOG_FUNCTION (this << agent);
+  NS_ABORT_MSG_IF (m_initSimMsgSent, "Local agent has to be set before the first notification");
+  m_localAgent = agent;
+}
+
+void
+OpenGymInterface::SetLocalAgent(uint32_t agentId, Ptr<OpenGymAgent> agent)
+{
+  NS_LOG_FUNCTION (this << agentId << agent);
+  NS_ABORT_MSG_IF (m_initSimMsgSent, "Local agents have to be set before the first notification");
+  m_localAgents[agentId] = agent;
+}
+
+bool
+OpenGymInterface::HasLocalAgent() const
+{
+  return m_localAgent || !m_localAgents.empty();
+}
+
+void
+OpenGymInterface::InitLocalAgents()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_agents.empty()) {
+    NS_ABORT_MSG_IF (!m_localAgent, "Local agents are set per agent id, but no multi-agent env was added");
+    m_localAgent->SetSpaces(GetObservationSpace(), GetActionSpace());
+  } else {
+    NS_ABORT_MSG_IF (m_localAgent, "Multi-agent mode needs a local agent per agent id");
+    for (std::map<uint32_t, Ptr<OpenGymEnv> >::iterator it = m_agents.begin(); it != m_agents.end(); ++it) {
+      std::map<uint32_t, Ptr<OpenGymAgent> >::iterator local = m_localAgents.find(it->first);
+      NS_ABORT_MSG_IF (local == m_localAgents.end(), "Agent " << it->first << " has no local agent, "
+                       "local and Python agents cannot be mixed");
+      local->second->SetSpaces(it->second->GetObservationSpace(), it->second->GetActionSpace());
+    }
+  }
+  NS_LOG_UNCOND("Using local agent, no Python agent is needed");
+  ResetStepStats();
+}
+
+void
+OpenGymInterface::StepLocalAgent()
+{
+  NS_LOG_FUNCTION (this);
+  Ptr<OpenGymDataContainer> obs = GetObservation();
+  float reward = GetReward();
+  bool isGameOver = IsGameOver();
+  std::string extraInfo = GetExtraInfo();
+
+  StatsClock::time_point agentStart = StatsClock::now();
+  Ptr<OpenGymDataContainer> action = m_localAgent->GetAction(obs, reward, isGameOver, extraInfo);
+  m_stepStats.recvWaitTime += WallTimeSince(agentStart);
+  FinishStepStats();
+
+  if (isGameOver) {
+    if (!m_simEnd) {
+      m_stopEnvRequested = true;
+      Simulator::Stop();
+    }
+    return;
+  }
+  ExecuteLocalAction(0, action);
+}
+
+void
+OpenGymInterface::StepLocalAgents()
+{
+  NS_LOG_FUNCTION (this);
+  for (std::set<uint32_t>::iterator it = m_readyAgents.begin(); it != m_readyAgents.end(); ++it) {
+    Ptr<OpenGymEnv> agent = m_agents[*it];
+    Ptr<OpenGymDataContainer> obs = agent->GetObservation();
+    float reward = agent->GetReward();
+    bool isGameOver = agent->GetGameOver() || m_simEnd;
+    std::string extraInfo = agent->GetExtraInfo();
+
+    StatsClock::time_point agentStart = StatsClock::now();
+    Ptr<OpenGymDataContainer> action = m_localAgents[*it]->GetAction(obs, reward, isGameOver, extraInfo);
+    m_stepStats.recvWaitTime += WallTimeSince(agentStart);
+
+    if (!m_simEnd) {
+      ExecuteLocalAction(agent, action);
+    }
+  }
+  m_readyAgents.clear();
+  FinishStepStats();
+}
+
+void
+OpenGymInterface::ExecuteLocalAction(Ptr<OpenGymEnv> agent, Ptr<OpenGymDataContainer> action)
+{
+  NS_LOG_FUNCTION (this << agent << action);
+  if (!action) {
+    return;
+  }
+  if (!m_actionDelay.IsZero()) {
+    // ActionDelay models the inference time of the agent here
+    Simulator::Schedule(m_actionDelay, &OpenGymInterface::ApplyLocalAction, this, agent, action);
+    return;
+  }
+  ApplyLocalAction(agent, action);
+}
+
+void
+OpenGymInterface::ApplyLocalAction(Ptr<OpenGymEnv> agent, Ptr<OpenGymDataContainer> action)
+{
+  NS_LOG_FUNCTION (this << agent << action);
+  if (agent) {
+    agent->ExecuteActions(action);
+  } else {
+    ExecuteActions(action);
+  }
+}
+
+void
+OpenGymInterface::FlushAgents()
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_initSimMsgSent) {
+    // the very first state covers all agents
+    NotifyCurrentState();
+    return;
+  }
+  if (m_stopEnvRequested || m_readyAgents.empty()) {
+    return;
+  }
+  ExchangeAgentStates();
+}
+
+void
+OpenGymInterface::ExchangeAgentStates()
+{
+  NS_LOG_FUNCTION (this << m_readyAgents.size());
+  m_agentFlushEvent.Cancel();
+
+  if (!m_localAgents.empty()) {
+    StepLocalAgents();
+    return;
+  }
+
+  // agents are asked for their state while filling the message, that part is simulation
+  Time collectTime = Seconds(0);
+  StatsClock::time_point serializeStart = StatsClock::now();
+  if (m_shm) {
+    m_shm->BeginRequest();
+  }
+
+  ns3opengym::EnvStateMsg &envStateMsg = m_envStateMsg;
+  m_stateObs.clear();
+  int idx = 0;
+  for (std::set<uint32_t>::iterator it = m_readyAgents.begin(); it != m_readyAgents.end(); ++it) {
+    Ptr<OpenGymEnv> agent = m_agents[*it];
+    ns3opengym::AgentState *agentState = OpenGymReuseElement(envStateMsg.mutable_agents(), idx++);
+    agentState->set_agentid(*it);
+
+    StatsClock::time_point collectStart = StatsClock::now();
+    Ptr<OpenGymDataContainer> obsDataContainer = agent->GetObservation();
+    float reward = agent->GetReward();
+    bool isGameOver = agent->GetGameOver() || m_simEnd;
+    std::string extraInfo = agent->GetExtraInfo();
+    collectTime += WallTimeSince(collectStart);
+
+    m_stateObs.push_back(obsDataContainer);
+    if (obsDataContainer) {
+      obsDataContainer->FillDataContainerPbMsg(*agentState->mutable_obsdata(), m_shm);
+    } else {
+      agentState->clear_obsdata();
+    }
+    agentState->set_reward(reward);
+    agentState->set_isgameover(isGameOver);
+    agentState->set_info(extraInfo);
+  }
+  OpenGymTrimElements(envStateMsg.mutable_agents(), idx);
+  m_readyAgents.clear();
+
+  // whole env ends with the simulation only, agents report their own game over
+  envStateMsg.set_isgameover(m_simEnd);
+  envStateMsg.set_reason(ns3opengym::EnvStateMsg::SimulationEnd);
+  m_stepStats.serializeTime += WallTimeSince(serializeStart) - collectTime;
+
+  ExchangeStateMsg(envStateMsg);
+}
+
+void
+OpenGymInterface::SendMsg(const google::protobuf::MessageLite &msg)
+{
+  NS_LOG_FUNCTION (this);
+  StatsClock::time_point start = StatsClock::now();
+  if (m_shm) {
+    m_shm->SendRequest(msg);
+  } else {
+    zmq::message_t request(msg.ByteSizeLong());
+    msg.SerializeWithCachedSizesToArray(static_cast<uint8_t*>(request.data()));
+    m_zmq_socket.send (request, zmq::send_flags::none);
+  }
+  m_stepStats.serializeTime += WallTimeSince(start);
+}
+
+void
+OpenGymInterface::RecvMsg(google::protobuf::MessageLite &msg)
+{
+  NS_LOG_FUNCTION (this);
+  StatsClock::time_point start = StatsClock::now();
+  if (m_shm) {
+    m_shm->ReceiveReply(msg);
+  } else {
+    zmq::message_t reply;
+    (void) m_zmq_socket.recv (reply, zmq::recv_flags::none);
+    msg.ParseFromArray(reply.data(), reply.size());
+  }
+  m_stepStats.recvWaitTime += WallTimeSince(start);
+}
 
+void
+OpenGymInterface::ResetStepStats()
+{
+  NS_LOG_FUNCTION (this);
+  m_stepStart = StatsClock::now();
+  m_stepSimStart = Simulator::Now();
+  m_stepEventStart = Simulator::GetEventCount();
+  m_stepStats.serializeTime = Seconds(0);
+  m_stepStats.recvWaitTime = Seconds(0);
+}
+
+void
+OpenGymInterface::FinishStepStats()
+{
+  NS_LOG_FUNCTION (this);
+  Time wallTime = WallTimeSince(m_stepStart);
+  m_stepStats.simTime = Simulator::Now() - m_stepSimStart;
+  m_stepStats.events = Simulator::GetEventCount() - m_stepEventStart;
+  m_stepStats.simWallTime = wallTime - m_stepStats.serializeTime - m_stepStats.recvWaitTime;
+  m_stepStatsTrace(m_stepStats);
+
+  if (m_statsInterval) {
+    m_statsSum.simTime += m_stepStats.simTime;
+    m_statsSum.events += m_stepStats.events;
+    m_statsSum.simWallTime += m_stepStats.simWallTime;
+    m_statsSum.serializeTime += m_stepStats.serializeTime;
+    m_statsSum.recvWaitTime += m_stepStats.recvWaitTime;
+    if (++m_statsSumSteps >= m_statsInterval) {
+      PrintStepStatsSummary();
+    }
+  }
+
+  m_stepStats.step++;
+  ResetStepStats();
+}
+
+void
+OpenGymInterface::PrintStepStatsSummary()
+{
+  NS_LOG_FUNCTION (this);
+  double steps = m_statsSumSteps;
+  double simWall = m_statsSum.simWallTime.GetSeconds();
+  double serialize = m_statsSum.serializeTime.GetSeconds();
+  double recvWait = m_statsSum.recvWaitTime.GetSeconds();
+  double total = simWall + serialize + recvWait;
+  if (total <= 0) {
+    total = 1;
+  }
+  NS_LOG_UNCOND("OpenGym steps " << m_stepStats.step + 1 - m_statsSumSteps << "-" << m_stepStats.step
+                << ", per step: sim time " << m_statsSum.simTime.GetSeconds() / steps << "s"
+                << ", events " << m_statsSum.events / steps
+                << ", sim wall " << simWall / steps * 1e6 << "us (" << 100 * simWall / total << "%)"
+                << ", serialize " << serialize / steps * 1e6 << "us (" << 100 * serialize / total << "%)"
+                << ", recv wait " << recvWait / steps * 1e6 << "us (" << 100 * recvWait / total << "%)");
+  m_statsSum = OpenGymStepStats();
+  m_statsSumSteps = 0;
 }
 
 void
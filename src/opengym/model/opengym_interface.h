@@ -23,13 +23,48 @@
 #define OPENGYM_INTERFACE_H
 
 #include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+#include "ns3/event-id.h"
+#include "messages.pb.h"
 #include <zmq.hpp>
+#include <deque>
+#include <map>
+#include <set>
+#include <vector>
+#include <chrono>
+#include <signal.h>
+
+namespace google {
+namespace protobuf {
+class MessageLite;
+}
+}
 
 namespace ns3 {
 
 class OpenGymSpace;
 class OpenGymDataContainer;
 class OpenGymEnv;
+class OpenGymShmChannel;
+class OpenGymAgent;
+
+/**
+ * Where the wall time of one step went. A step ends when the agent's reply
+ * to a state is in (or, with a non-zero ActionDelay, when the state was
+ * sent) and covers everything since the end of the previous one.
+ */
+struct OpenGymStepStats
+{
+  OpenGymStepStats ();
+
+  uint64_t step;        //!< index of the step, counted from the first state
+  Time simTime;         //!< simulation time advanced during the step
+  uint64_t events;      //!< events executed during the step
+  Time simWallTime;     //!< wall time in the simulation, i.e. events, collecting state and executing actions
+  Time serializeTime;   //!< wall time spent encoding the state and handing it to the transport
+  Time recvWaitTime;    //!< wall time waiting for the agent, inference of a local agent included
+};
 
 class OpenGymInterface : public Object
 {
@@ -41,12 +76,37 @@ public:
 
   static TypeId GetTypeId ();
 
+  /**
+   * TracedCallback signature for step statistics.
+   *
+   * \param [in] stats Timing of the step just finished.
+   */
+  typedef void (* StepStatsTracedCallback)(const OpenGymStepStats &stats);
+
   void Init();
   void NotifyCurrentState();
   void WaitForStop();
 
   void NotifySimulationEnd();
 
+  /**
+   * Serve episodes by forking the simulation at the checkpoint time.
+   *
+   * The process reaching the checkpoint becomes a fork server: it forks
+   * ForkWorkers children which run the episodes and talk to the agent,
+   * and forks a new one as soon as a child exits. Everything built before
+   * the checkpoint (topology, installed applications) is thus set up once,
+   * a reset costs a fork instead of a relaunch of the simulation script.
+   * The child bumps the RngSeedManager run number by the episode index and
+   * fires the EpisodeStart trace, use it to re-assign streams of random
+   * variables created before the checkpoint.
+   *
+   * Has to be called before the first NotifyCurrentState(). Setting the
+   * ForkServer attribute instead starts the server at the first
+   * NotifyCurrentState().
+   */
+  void EnableForkServer(Time checkpoint = Seconds (0));
+
   Ptr<OpenGymSpace> GetActionSpace();
   Ptr<OpenGymSpace> GetObservationSpace();
   Ptr<OpenGymDataContainer> GetObservation();
@@ -65,6 +125,24 @@ public:
 
   void Notify(Ptr<OpenGymEnv> entity);
 
+  /**
+   * Multi-agent mode: every agent is an OpenGymEnv with its own spaces,
+   * addressed by agentId in the messages. Agents notifying at the same
+   * simulation time share one round trip with the Python side.
+   */
+  void AddAgent(uint32_t agentId, Ptr<OpenGymEnv> agent);
+  void NotifyAgent(uint32_t agentId);
+
+  /**
+   * Answer the states with a policy running in this process instead of a
+   * Python agent, nothing is sent over ZMQ then. In multi-agent mode every
+   * agent needs its own local policy. A game over stops the simulation,
+   * the same as an agent closing the env would. Has to be set before the
+   * first notification.
+   */
+  void SetLocalAgent(Ptr<OpenGymAgent> agent);
+  void SetLocalAgent(uint32_t agentId, Ptr<OpenGymAgent> agent);
+
 protected:
   // Inherited
   virtual void DoInitialize (void);
@@ -74,10 +152,93 @@ private:
   static Ptr<OpenGymInterface> *DoGet (uint32_t port=5555);
   static void Delete (void);
 
+  void RunForkServer ();
+
+  /*
+   * Snapshots are saved, restored and released on commands of the agent
+   * sent instead of an action. Saving forks a frozen copy of the process,
+   * so the event queue, nodes, packets and RNG streams are all preserved
+   * copy-on-write. The frozen process waits for signals: SIGUSR1 forks a
+   * process which resumes from the snapshot, reconnects to the agent and
+   * sends the state of that step again, SIGTERM releases it. The snapshot
+   * id is the pid of the frozen process. Needs a zero ActionDelay and
+   * does not work together with the fork server.
+   */
+  bool ProcessSnapshotCmd (ns3opengym::EnvActMsg::SnapshotCmd cmd, uint64_t snapshotId);
+  uint64_t SaveSnapshot ();
+  void RestoreSnapshot (uint64_t snapshotId);
+  bool IsSnapshot (uint64_t snapshotId) const;
+  void RunSnapshotHolder (const sigset_t &oldMask);
+  void ResumeFromSnapshot (uint64_t snapshotId);
+
+  bool HasLocalAgent () const;
+  void InitLocalAgents ();
+  void StepLocalAgent ();
+  void StepLocalAgents ();
+  void ExecuteLocalAction (Ptr<OpenGymEnv> agent, Ptr<OpenGymDataContainer> action);
+  void ApplyLocalAction (Ptr<OpenGymEnv> agent, Ptr<OpenGymDataContainer> action);
+
+  void FlushAgents ();
+  void ExchangeAgentStates ();
+  void ExchangeStateMsg (const ns3opengym::EnvStateMsg &envStateMsg);
+  bool ReceiveActMsg ();
+  void ApplyActMsg ();
+
+  void SendMsg (const google::protobuf::MessageLite &msg);
+  void RecvMsg (google::protobuf::MessageLite &msg);
+
+  void ResetStepStats ();
+  void FinishStepStats ();
+  void PrintStepStatsSummary ();
+
   uint32_t m_port;
   zmq::context_t m_zmq_context;
   zmq::socket_t m_zmq_socket;
 
+  bool m_shmEnabled;
+  uint32_t m_shmSlotNum;
+  uint32_t m_shmSlotSize;
+  Ptr<OpenGymShmChannel> m_shm;
+
+  Time m_actionDelay;
+  bool m_replyPending;
+  std::deque<ns3opengym::EnvActMsg> m_actMsgQueue;
+  // refilled every step, keeps the buffers of the previous one
+  ns3opengym::EnvStateMsg m_envStateMsg;
+  // observations in m_envStateMsg, a snapshot may have to send them again
+  std::vector<Ptr<OpenGymDataContainer> > m_stateObs;
+
+  bool m_forkServer;
+  uint32_t m_forkWorkers;
+  bool m_forkChild;
+  uint32_t m_episode;
+  TracedCallback<uint32_t> m_episodeStartTrace;
+
+  // serialization and recv wait are clocked around their code paths,
+  // the rest of the wall time of a step is charged to the simulation
+  typedef std::chrono::steady_clock StatsClock;
+  StatsClock::time_point m_stepStart;
+  Time m_stepSimStart;
+  uint64_t m_stepEventStart;
+  OpenGymStepStats m_stepStats;
+  uint32_t m_statsInterval;
+  OpenGymStepStats m_statsSum;
+  uint32_t m_statsSumSteps;
+  TracedCallback<const OpenGymStepStats &> m_stepStatsTrace;
+
+  uint32_t m_maxSnapshots;
+  // pids of the frozen processes, shared by all processes branched off this one
+  int32_t *m_snapshotTable;
+  bool m_snapshotResumed;
+  uint64_t m_restoredSnapshot;
+
+  std::map<uint32_t, Ptr<OpenGymEnv> > m_agents;
+  std::set<uint32_t> m_readyAgents;
+  EventId m_agentFlushEvent;
+
+  Ptr<OpenGymAgent> m_localAgent;
+  std::map<uint32_t, Ptr<OpenGymAgent> > m_localAgents;
+
   bool m_simEnd;
   bool m_stopEnvRequested;
   bool m_initSimMsgSent;
@@ -0,0 +1,300 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <climits>
+#include <cstring>
+#include <google/protobuf/message_lite.h>
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "opengym_shm.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OpenGymShmChannel");
+
+namespace {
+
+const uint32_t SHM_MAGIC = 0x4733534e; // "NS3G"
+const uint32_t SHM_VERSION = 1;
+
+// segment header, every counter lives on its own cache line
+const uint32_t SHM_MAGIC_OFFSET = 0;
+const uint32_t SHM_VERSION_OFFSET = 4;
+const uint32_t SHM_SLOT_NUM_OFFSET = 8;
+const uint32_t SHM_SLOT_SIZE_OFFSET = 12;
+const uint32_t SHM_REQ_WRITE_OFFSET = 64;
+const uint32_t SHM_REQ_READ_OFFSET = 128;
+const uint32_t SHM_REP_WRITE_OFFSET = 192;
+const uint32_t SHM_REP_READ_OFFSET = 256;
+const uint32_t SHM_HEADER_SIZE = 4096;
+
+// slot header: offset and size of the serialized message within the slot
+const uint32_t SLOT_MSG_OFFSET = 0;
+const uint32_t SLOT_MSG_SIZE = 4;
+const uint32_t SLOT_HEADER_SIZE = 64;
+
+const uint32_t SHM_ALIGN = 64;
+const uint32_t SPIN_NUM = 1000;
+
+inline uint64_t
+Align (uint64_t value, uint64_t align)
+{
+  return (value + align - 1) & ~(align - 1);
+}
+
+inline uint32_t
+LoadAcquire (uint32_t *addr)
+{
+  return __atomic_load_n (addr, __ATOMIC_ACQUIRE);
+}
+
+inline void
+StoreRelease (uint32_t *addr, uint32_t value)
+{
+  __atomic_store_n (addr, value, __ATOMIC_RELEASE);
+}
+
+} // anonymous namespace
+
+OpenGymShmChannel::OpenGymShmChannel ()
+  : m_fd (-1),
+    m_base (0),
+    m_size (0),
+    m_slotNum (0),
+    m_slotSize (0),
+    m_currentSlot (0),
+    m_currentUsed (0),
+    m_linked (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+OpenGymShmChannel::~OpenGymShmChannel ()
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+}
+
+bool
+OpenGymShmChannel::Create (std::string name, uint32_t slotNum, uint32_t slotSize)
+{
+  NS_LOG_FUNCTION (this << name << slotNum << slotSize);
+  NS_ASSERT (m_base == 0);
+  NS_ASSERT (slotNum > 0);
+
+  m_name = name;
+  m_slotNum = slotNum;
+  m_slotSize = Align (slotSize, SHM_ALIGN);
+  m_size = SHM_HEADER_SIZE + 2 * static_cast<uint64_t> (m_slotNum) * m_slotSize;
+
+  m_fd = shm_open (m_name.c_str (), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (m_fd < 0)
+    {
+      NS_LOG_WARN ("Cannot create shared-memory segment " << m_name << ": " << std::strerror (errno));
+      return false;
+    }
+  m_linked = true;
+
+  if (ftruncate (m_fd, m_size) != 0)
+    {
+      NS_LOG_WARN ("Cannot resize shared-memory segment " << m_name << ": " << std::strerror (errno));
+      Close ();
+      return false;
+    }
+
+  void *addr = mmap (0, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (addr == MAP_FAILED)
+    {
+      NS_LOG_WARN ("Cannot map shared-memory segment " << m_name << ": " << std::strerror (errno));
+      Close ();
+      return false;
+    }
+  m_base = static_cast<uint8_t*> (addr);
+
+  std::memset (m_base, 0, SHM_HEADER_SIZE);
+  *reinterpret_cast<uint32_t*> (m_base + SHM_VERSION_OFFSET) = SHM_VERSION;
+  *reinterpret_cast<uint32_t*> (m_base + SHM_SLOT_NUM_OFFSET) = m_slotNum;
+  *reinterpret_cast<uint32_t*> (m_base + SHM_SLOT_SIZE_OFFSET) = m_slotSize;
+
+  m_request.write = reinterpret_cast<uint32_t*> (m_base + SHM_REQ_WRITE_OFFSET);
+  m_request.read = reinterpret_cast<uint32_t*> (m_base + SHM_REQ_READ_OFFSET);
+  m_request.slots = m_base + SHM_HEADER_SIZE;
+  m_reply.write = reinterpret_cast<uint32_t*> (m_base + SHM_REP_WRITE_OFFSET);
+  m_reply.read = reinterpret_cast<uint32_t*> (m_base + SHM_REP_READ_OFFSET);
+  m_reply.slots = m_request.slots + static_cast<uint64_t> (m_slotNum) * m_slotSize;
+
+  // publish the magic last, the agent refuses to attach to a half-initialized segment
+  StoreRelease (reinterpret_cast<uint32_t*> (m_base + SHM_MAGIC_OFFSET), SHM_MAGIC);
+  return true;
+}
+
+void
+OpenGymShmChannel::Unlink ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_linked)
+    {
+      shm_unlink (m_name.c_str ());
+      m_linked = false;
+    }
+}
+
+void
+OpenGymShmChannel::Close ()
+{
+  NS_LOG_FUNCTION (this);
+  Unlink ();
+  if (m_base)
+    {
+      munmap (m_base, m_size);
+      m_base = 0;
+    }
+  if (m_fd >= 0)
+    {
+      close (m_fd);
+      m_fd = -1;
+    }
+  m_currentSlot = 0;
+}
+
+std::string
+OpenGymShmChannel::GetName () const
+{
+  return m_name;
+}
+
+uint8_t*
+OpenGymShmChannel::GetSlot (const Ring &ring, uint32_t idx) const
+{
+  return ring.slots + static_cast<uint64_t> (idx % m_slotNum) * m_slotSize;
+}
+
+void
+OpenGymShmChannel::Wait (uint32_t *addr, uint32_t value)
+{
+  for (uint32_t i = 0; i < SPIN_NUM; ++i)
+    {
+      if (LoadAcquire (addr) != value)
+        {
+          return;
+        }
+    }
+  while (LoadAcquire (addr) == value)
+    {
+      // returns immediately with EAGAIN if the counter already moved on
+      syscall (SYS_futex, addr, FUTEX_WAIT, value, NULL, NULL, 0);
+    }
+}
+
+void
+OpenGymShmChannel::Wake (uint32_t *addr)
+{
+  syscall (SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+void
+OpenGymShmChannel::BeginRequest ()
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_base);
+  if (m_currentSlot)
+    {
+      // slot already reserved by a previous call
+      return;
+    }
+
+  uint32_t write = *m_request.write;
+  uint32_t read = LoadAcquire (m_request.read);
+  while (write - read >= m_slotNum)
+    {
+      Wait (m_request.read, read);
+      read = LoadAcquire (m_request.read);
+    }
+
+  m_currentSlot = GetSlot (m_request, write);
+  m_currentUsed = SLOT_HEADER_SIZE;
+}
+
+uint8_t*
+OpenGymShmChannel::AllocateBlob (uint64_t size, uint64_t &offset)
+{
+  NS_LOG_FUNCTION (this << size);
+  if (!m_currentSlot)
+    {
+      return 0;
+    }
+
+  uint64_t start = Align (m_currentUsed, SHM_ALIGN);
+  if (start + size > m_slotSize)
+    {
+      NS_LOG_WARN ("Blob of " << size << " bytes does not fit into shared-memory slot, consider increasing ShmSlotSize");
+      return 0;
+    }
+
+  m_currentUsed = start + size;
+  offset = (m_currentSlot - m_base) + start;
+  return m_currentSlot + start;
+}
+
+void
+OpenGymShmChannel::SendRequest (const google::protobuf::MessageLite &msg)
+{
+  NS_LOG_FUNCTION (this);
+  BeginRequest ();
+
+  uint64_t msgOffset = Align (m_currentUsed, 8);
+  uint64_t msgSize = msg.ByteSizeLong ();
+  if (msgOffset + msgSize > m_slotSize)
+    {
+      NS_FATAL_ERROR ("Message of " << msgSize << " bytes does not fit into shared-memory slot of "
+                      << m_slotSize << " bytes, increase ShmSlotSize");
+    }
+
+  msg.SerializeWithCachedSizesToArray (m_currentSlot + msgOffset);
+  *reinterpret_cast<uint32_t*> (m_currentSlot + SLOT_MSG_OFFSET) = msgOffset;
+  *reinterpret_cast<uint32_t*> (m_currentSlot + SLOT_MSG_SIZE) = msgSize;
+  m_currentSlot = 0;
+
+  StoreRelease (m_request.write, *m_request.write + 1);
+  Wake (m_request.write);
+}
+
+void
+OpenGymShmChannel::ReceiveReply (google::protobuf::MessageLite &msg)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_base);
+
+  uint32_t read = *m_reply.read;
+  Wait (m_reply.write, read);
+
+  uint8_t *slot = GetSlot (m_reply, read);
+  uint32_t msgOffset = *reinterpret_cast<uint32_t*> (slot + SLOT_MSG_OFFSET);
+  uint32_t msgSize = *reinterpret_cast<uint32_t*> (slot + SLOT_MSG_SIZE);
+  NS_ABORT_MSG_IF (msgOffset + static_cast<uint64_t> (msgSize) > m_slotSize, "Corrupted shared-memory reply slot");
+  msg.ParseFromArray (slot + msgOffset, msgSize);
+
+  StoreRelease (m_reply.read, read + 1);
+  Wake (m_reply.read);
+}
+
+} // namespace ns3
@@ -0,0 +1,97 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OPENGYM_SHM_H
+#define OPENGYM_SHM_H
+
+#include "ns3/simple-ref-count.h"
+#include <string>
+#include <stdint.h>
+
+namespace google {
+namespace protobuf {
+class MessageLite;
+}
+}
+
+namespace ns3 {
+
+/**
+ * Shared-memory transport between the simulation and the Python agent.
+ *
+ * The segment holds a header followed by two rings of fixed-size slots:
+ * requests (simulation -> agent) and replies (agent -> simulation).
+ * Every ring has a write and a read counter, each on its own cache line,
+ * which double as futex words, so the waiting side sleeps in the kernel
+ * until the other side bumps the counter.
+ *
+ * A request slot contains a small slot header, then the raw data of Box
+ * containers (each blob 64-byte aligned, addressed by its offset from the
+ * start of the segment) and finally the serialized protobuf message.
+ * The agent maps the blobs directly into numpy arrays, so Box data is
+ * written exactly once.
+ *
+ * Layout has to be kept in sync with Ns3ShmChannel in ns3env.py.
+ */
+class OpenGymShmChannel : public SimpleRefCount<OpenGymShmChannel>
+{
+public:
+  OpenGymShmChannel ();
+  ~OpenGymShmChannel ();
+
+  bool Create (std::string name, uint32_t slotNum, uint32_t slotSize);
+  void Unlink ();
+  void Close ();
+  std::string GetName () const;
+
+  // simulation -> agent
+  void BeginRequest ();
+  uint8_t* AllocateBlob (uint64_t size, uint64_t &offset);
+  void SendRequest (const google::protobuf::MessageLite &msg);
+
+  // agent -> simulation
+  void ReceiveReply (google::protobuf::MessageLite &msg);
+
+private:
+  struct Ring
+  {
+    uint32_t *write;
+    uint32_t *read;
+    uint8_t *slots;
+  };
+
+  uint8_t* GetSlot (const Ring &ring, uint32_t idx) const;
+  static void Wait (uint32_t *addr, uint32_t value);
+  static void Wake (uint32_t *addr);
+
+  std::string m_name;
+  int m_fd;
+  uint8_t *m_base;
+  uint64_t m_size;
+  uint32_t m_slotNum;
+  uint32_t m_slotSize;
+
+  Ring m_request;
+  Ring m_reply;
+
+  uint8_t *m_currentSlot;
+  uint64_t m_currentUsed;
+  bool m_linked;
+};
+
+} // end of namespace ns3
+
+#endif /* OPENGYM_SHM_H */
@@ -212,6 +212,13 @@ OpenGymBoxSpace::GetShape()
   return m_shape;
 }
 
+ns3opengym::Dtype
+OpenGymBoxSpace::GetDtype()
+{
+  NS_LOG_FUNCTION (this);
+  return m_dtype;
+}
+
 ns3opengym::SpaceDescription
 OpenGymBoxSpace::GetSpaceDescription()
 {
@@ -87,6 +87,7 @@ public:
   float GetLow();
   float GetHigh();
   std::vector<uint32_t> GetShape();
+  ns3opengym::Dtype GetDtype();
 
   virtual void Print(std::ostream& where) const;
   friend std::ostream& operator<< (std::ostream& os, const Ptr<OpenGymBoxSpace> space)
@@ -1,55 +1,600 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 
-// Include a header file from your module to test.
-//#include "ns3/opengym.h"
-
-// An essential include is test.h
 #include "ns3/test.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include "ns3/container.h"
+#include "ns3/spaces.h"
+#include "ns3/opengym_env.h"
+#include "ns3/opengym_agent.h"
+#include "ns3/opengym_interface.h"
+#include "ns3/opengym_batcher.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+
+#include <vector>
 
 // Do not put your test classes in namespace ns3.  You may find it useful
 // to use the using directive to access the ns3 namespace directly
 using namespace ns3;
 
-// This is an example TestCase.
-class OpengymTestCase1 : public TestCase
+/**
+ * \brief Check that Box containers survive the encoding of their data
+ *
+ * Every dtype is filled into a protobuf message, as packed raw bytes or
+ * as repeated fields depending on the OpenGymPackedBox global, then
+ * decoded with CreateFromDataContainerPbMsg.
+ */
+class OpenGymBoxRoundTripTestCase : public TestCase
+{
+public:
+  /**
+   * \brief Constructor
+   *
+   * \param packed the value of the OpenGymPackedBox global
+   */
+  OpenGymBoxRoundTripTestCase (bool packed);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Encode and decode a Box
+   *
+   * \tparam T the type of the values of the Box
+   * \tparam U the type of the values of the decoded Box
+   * \param data the values
+   * \param dtype the expected dtype of the message
+   */
+  template <typename T, typename U>
+  void RoundTrip (const std::vector<T> &data, ns3opengym::Dtype dtype);
+
+  bool m_packed;  //!< Value of the OpenGymPackedBox global
+};
+
+OpenGymBoxRoundTripTestCase::OpenGymBoxRoundTripTestCase (bool packed)
+  : TestCase (std::string ("Check Box data round-trips ") + (packed ? "packed" : "in repeated fields")),
+    m_packed (packed)
+{
+}
+
+template <typename T, typename U>
+void
+OpenGymBoxRoundTripTestCase::RoundTrip (const std::vector<T> &data, ns3opengym::Dtype dtype)
+{
+  std::vector<uint32_t> shape = {2, static_cast<uint32_t> (data.size () / 2)};
+  Ptr<OpenGymBoxContainer<T> > box = CreateObject<OpenGymBoxContainer<T> > (shape);
+  box->SetData (data);
+  ns3opengym::DataContainer msg = box->GetDataContainerPbMsg ();
+
+  NS_TEST_ASSERT_MSG_EQ (msg.type (), ns3opengym::Box, "Wrong container type");
+  ns3opengym::BoxDataContainer boxMsg;
+  NS_TEST_ASSERT_MSG_EQ (msg.data ().UnpackTo (&boxMsg), true, "Cannot unpack the Box message");
+  NS_TEST_ASSERT_MSG_EQ (boxMsg.dtype (), dtype, "Wrong dtype");
+  NS_TEST_ASSERT_MSG_EQ (boxMsg.shape_size (), 2, "Wrong shape");
+  NS_TEST_ASSERT_MSG_EQ (boxMsg.shape (1), data.size () / 2, "Wrong shape");
+  uint32_t repeated = boxMsg.intdata_size () + boxMsg.uintdata_size ()
+    + boxMsg.floatdata_size () + boxMsg.doubledata_size ();
+  if (m_packed)
+    {
+      NS_TEST_ASSERT_MSG_EQ (boxMsg.rawdata ().size (), data.size () * sizeof (U), "Wrong raw data size");
+      NS_TEST_ASSERT_MSG_EQ (repeated, 0, "Packed Box also filled repeated fields");
+    }
+  else
+    {
+      NS_TEST_ASSERT_MSG_EQ (boxMsg.rawdata ().empty (), true, "Unpacked Box filled raw data");
+      NS_TEST_ASSERT_MSG_EQ (repeated, data.size (), "Wrong number of repeated values");
+    }
+
+  Ptr<OpenGymBoxContainer<U> > decoded =
+    DynamicCast<OpenGymBoxContainer<U> > (OpenGymDataContainer::CreateFromDataContainerPbMsg (msg));
+  NS_TEST_ASSERT_MSG_NE (decoded, 0, "Decoded container is not a Box of the dtype");
+  std::vector<U> values = decoded->GetData ();
+  NS_TEST_ASSERT_MSG_EQ (values.size (), data.size (), "Wrong number of decoded values");
+  for (uint32_t i = 0; i < data.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (values[i], static_cast<U> (data[i]), "Value " << i << " changed");
+    }
+}
+
+void
+OpenGymBoxRoundTripTestCase::DoRun (void)
+{
+  Config::SetGlobal ("OpenGymPackedBox", BooleanValue (m_packed));
+
+  RoundTrip<int32_t, int32_t> ({-2147483647 - 1, -1, 0, 1, 65536, 2147483647}, ns3opengym::INT);
+  RoundTrip<uint32_t, uint32_t> ({0, 1, 255, 65536, 2147483648u, 4294967295u}, ns3opengym::UINT);
+  RoundTrip<float, float> ({-1.5f, 0.0f, 1e-30f, 3.25f, 1e30f, 0.1f}, ns3opengym::FLOAT);
+  RoundTrip<double, double> ({-1.5, 0.0, 1e-300, 3.25, 1e300, 0.1}, ns3opengym::DOUBLE);
+  // the other integer types travel as 32-bit values
+  RoundTrip<int8_t, int32_t> ({-128, -1, 0, 127}, ns3opengym::INT);
+  RoundTrip<uint64_t, uint32_t> ({0, 1, 4294967295u, 7}, ns3opengym::UINT);
+  // an empty Box has no raw data, and decodes as empty
+  RoundTrip<float, float> ({}, ns3opengym::FLOAT);
+
+  Config::SetGlobal ("OpenGymPackedBox", BooleanValue (true));
+}
+
+/**
+ * \brief Check that messages refilled across steps carry no stale elements
+ *
+ * Observations are filled into the same messages at every step, whose
+ * elements are reused through OpenGymReuseElement and dropped through
+ * OpenGymTrimElements when the observation gets smaller.
+ */
+class OpenGymReuseElementsTestCase : public TestCase
+{
+public:
+  OpenGymReuseElementsTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Fill a container into a message and decode it
+   *
+   * \param container the container
+   * \param msg the message, kept across calls
+   * \returns the decoded container
+   */
+  Ptr<OpenGymDataContainer> Step (Ptr<OpenGymDataContainer> container,
+                                  ns3opengym::DataContainer &msg);
+};
+
+OpenGymReuseElementsTestCase::OpenGymReuseElementsTestCase ()
+  : TestCase ("Check refilled messages drop the elements of earlier steps")
+{
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymReuseElementsTestCase::Step (Ptr<OpenGymDataContainer> container,
+                                    ns3opengym::DataContainer &msg)
+{
+  container->FillDataContainerPbMsg (msg, 0);
+  return OpenGymDataContainer::CreateFromDataContainerPbMsg (msg);
+}
+
+void
+OpenGymReuseElementsTestCase::DoRun (void)
+{
+  // the helpers keep the first elements and drop the others
+  ns3opengym::TupleDataContainer tupleMsg;
+  google::protobuf::RepeatedPtrField<ns3opengym::DataContainer> *elements = tupleMsg.mutable_element ();
+  std::vector<ns3opengym::DataContainer *> first;
+  for (int i = 0; i < 3; i++)
+    {
+      first.push_back (OpenGymReuseElement (elements, i));
+      first.back ()->set_name ("element");
+    }
+  OpenGymTrimElements (elements, 3);
+  NS_TEST_ASSERT_MSG_EQ (elements->size (), 3, "Wrong number of elements");
+  NS_TEST_ASSERT_MSG_EQ (OpenGymReuseElement (elements, 0), first[0], "First element not reused");
+  OpenGymTrimElements (elements, 1);
+  NS_TEST_ASSERT_MSG_EQ (elements->size (), 1, "Elements not trimmed");
+  NS_TEST_ASSERT_MSG_EQ (&elements->Get (0), first[0], "Trimmed the wrong elements");
+  NS_TEST_ASSERT_MSG_EQ (elements->Get (0).name (), "element", "Reused element lost its content");
+  OpenGymReuseElement (elements, 1);
+  NS_TEST_ASSERT_MSG_EQ (elements->size (), 2, "Elements not grown again");
+
+  ns3opengym::DataContainer msg;
+
+  // a tuple of three, then a tuple of one, in the same message
+  Ptr<OpenGymTupleContainer> tuple = CreateObject<OpenGymTupleContainer> ();
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      Ptr<OpenGymDiscreteContainer> discrete = CreateObject<OpenGymDiscreteContainer> (10);
+      discrete->SetValue (i + 1);
+      tuple->Add (discrete);
+    }
+  Ptr<OpenGymTupleContainer> decodedTuple = DynamicCast<OpenGymTupleContainer> (Step (tuple, msg));
+  NS_TEST_ASSERT_MSG_NE (decodedTuple, 0, "Not decoded as a tuple");
+  NS_TEST_ASSERT_MSG_NE (decodedTuple->Get (2), 0, "Tuple lost an element");
+  Ptr<OpenGymTupleContainer> smallTuple = CreateObject<OpenGymTupleContainer> ();
+  Ptr<OpenGymDiscreteContainer> discrete = CreateObject<OpenGymDiscreteContainer> (10);
+  discrete->SetValue (7);
+  smallTuple->Add (discrete);
+  decodedTuple = DynamicCast<OpenGymTupleContainer> (Step (smallTuple, msg));
+  NS_TEST_ASSERT_MSG_NE (decodedTuple, 0, "Not decoded as a tuple");
+  NS_TEST_ASSERT_MSG_EQ (DynamicCast<OpenGymDiscreteContainer> (decodedTuple->Get (0))->GetValue (), 7,
+                         "Wrong tuple element");
+  NS_TEST_ASSERT_MSG_EQ (decodedTuple->Get (1), 0, "Stale tuple element");
+
+  // a dict of three, then a dict of one, in the same message
+  Ptr<OpenGymDictContainer> dict = CreateObject<OpenGymDictContainer> ();
+  dict->Add ("a", tuple);
+  dict->Add ("b", CreateObject<OpenGymDiscreteContainer> (10));
+  dict->Add ("c", CreateObject<OpenGymBoxContainer<float> > (std::vector<uint32_t> {1}));
+  Ptr<OpenGymDictContainer> decodedDict = DynamicCast<OpenGymDictContainer> (Step (dict, msg));
+  NS_TEST_ASSERT_MSG_NE (decodedDict, 0, "Not decoded as a dict");
+  NS_TEST_ASSERT_MSG_NE (decodedDict->Get ("c"), 0, "Dict lost an element");
+  Ptr<OpenGymDictContainer> smallDict = CreateObject<OpenGymDictContainer> ();
+  smallDict->Add ("b", discrete);
+  decodedDict = DynamicCast<OpenGymDictContainer> (Step (smallDict, msg));
+  NS_TEST_ASSERT_MSG_NE (decodedDict, 0, "Not decoded as a dict");
+  NS_TEST_ASSERT_MSG_EQ (DynamicCast<OpenGymDiscreteContainer> (decodedDict->Get ("b"))->GetValue (), 7,
+                         "Wrong dict element");
+  NS_TEST_ASSERT_MSG_EQ (decodedDict->Get ("a"), 0, "Stale dict element");
+  NS_TEST_ASSERT_MSG_EQ (decodedDict->Get ("c"), 0, "Stale dict element");
+
+  // a long-lived dict whose box and tuple elements are refilled
+  Ptr<OpenGymBoxContainer<double> > box = CreateObject<OpenGymBoxContainer<double> > (std::vector<uint32_t> {4});
+  Ptr<OpenGymTupleContainer> inner = CreateObject<OpenGymTupleContainer> ();
+  inner->Add (box);
+  Ptr<OpenGymDictContainer> obs = CreateObject<OpenGymDictContainer> ();
+  obs->Add ("box", box);
+  obs->Add ("tuple", inner);
+  for (uint32_t step = 4; step > 0; step--)
+    {
+      box->Clear ();
+      for (uint32_t i = 0; i < step; i++)
+        {
+          box->AddValue (step * 10 + i);
+        }
+      decodedDict = DynamicCast<OpenGymDictContainer> (Step (obs, msg));
+      NS_TEST_ASSERT_MSG_NE (decodedDict, 0, "Not decoded as a dict");
+      Ptr<OpenGymTupleContainer> decodedInner = DynamicCast<OpenGymTupleContainer> (decodedDict->Get ("tuple"));
+      NS_TEST_ASSERT_MSG_NE (decodedInner, 0, "Lost the nested tuple");
+      NS_TEST_ASSERT_MSG_EQ (decodedInner->Get (1), 0, "Stale nested tuple element");
+      Ptr<OpenGymBoxContainer<double> > boxes[] = {
+        DynamicCast<OpenGymBoxContainer<double> > (decodedDict->Get ("box")),
+        DynamicCast<OpenGymBoxContainer<double> > (decodedInner->Get (0))
+      };
+      for (uint32_t j = 0; j < 2; j++)
+        {
+          NS_TEST_ASSERT_MSG_NE (boxes[j], 0, "Lost a box");
+          std::vector<double> values = boxes[j]->GetData ();
+          NS_TEST_ASSERT_MSG_EQ (values.size (), step, "Stale box values at step " << step);
+          for (uint32_t i = 0; i < step; i++)
+            {
+              NS_TEST_EXPECT_MSG_EQ (values[i], step * 10 + i, "Wrong box value at step " << step);
+            }
+        }
+    }
+}
+
+/**
+ * \brief Env of the local agent test
+ *
+ * Observes {step, 1} at every step and records the actions; the game is
+ * over at a given step.
+ */
+class OpenGymTestEnv : public OpenGymEnv
+{
+public:
+  /**
+   * \brief Constructor
+   *
+   * \param gameOverStep the step the game is over at, 0 for never
+   */
+  OpenGymTestEnv (uint32_t gameOverStep);
+
+  virtual Ptr<OpenGymSpace> GetActionSpace ();
+  virtual Ptr<OpenGymSpace> GetObservationSpace ();
+  virtual bool GetGameOver ();
+  virtual Ptr<OpenGymDataContainer> GetObservation ();
+  virtual float GetReward ();
+  virtual std::string GetExtraInfo ();
+  virtual bool ExecuteActions (Ptr<OpenGymDataContainer> action);
+
+  /// Count a step and notify the interface
+  void Step (void);
+
+  uint32_t m_gameOverStep;          //!< Step the game is over at
+  uint32_t m_step;                  //!< Current step
+  std::vector<uint32_t> m_actions;  //!< Actions executed so far
+};
+
+OpenGymTestEnv::OpenGymTestEnv (uint32_t gameOverStep)
+  : m_gameOverStep (gameOverStep),
+    m_step (0)
+{
+}
+
+Ptr<OpenGymSpace>
+OpenGymTestEnv::GetActionSpace ()
+{
+  return CreateObject<OpenGymDiscreteSpace> (2);
+}
+
+Ptr<OpenGymSpace>
+OpenGymTestEnv::GetObservationSpace ()
+{
+  return CreateObject<OpenGymBoxSpace> (0, 100, std::vector<uint32_t> {2}, TypeNameGet<float> ());
+}
+
+bool
+OpenGymTestEnv::GetGameOver ()
+{
+  return m_step == m_gameOverStep;
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymTestEnv::GetObservation ()
+{
+  Ptr<OpenGymBoxContainer<float> > box = CreateObject<OpenGymBoxContainer<float> > (std::vector<uint32_t> {2});
+  box->AddValue (m_step);
+  box->AddValue (1);
+  return box;
+}
+
+float
+OpenGymTestEnv::GetReward ()
+{
+  return m_step;
+}
+
+std::string
+OpenGymTestEnv::GetExtraInfo ()
+{
+  return "";
+}
+
+bool
+OpenGymTestEnv::ExecuteActions (Ptr<OpenGymDataContainer> action)
+{
+  Ptr<OpenGymDiscreteContainer> discrete = DynamicCast<OpenGymDiscreteContainer> (action);
+  m_actions.push_back (discrete ? discrete->GetValue () : 99);
+  return true;
+}
+
+void
+OpenGymTestEnv::Step (void)
+{
+  m_step++;
+  Notify ();
+}
+
+/**
+ * \brief Linear agent counting its calls
+ */
+class OpenGymCountingAgent : public OpenGymLinearAgent
+{
+public:
+  OpenGymCountingAgent ();
+
+  virtual void SetSpaces (Ptr<OpenGymSpace> obsSpace, Ptr<OpenGymSpace> actSpace);
+  virtual Ptr<OpenGymDataContainer> GetAction (Ptr<OpenGymDataContainer> obs, float reward,
+                                               bool gameOver, const std::string &info);
+
+  uint32_t m_setSpaces;              //!< Number of SetSpaces calls
+  std::vector<float> m_rewards;      //!< Rewards of the GetAction calls
+  std::vector<bool> m_gameOver;      //!< Game over flags of the GetAction calls
+};
+
+OpenGymCountingAgent::OpenGymCountingAgent ()
+  : m_setSpaces (0)
+{
+}
+
+void
+OpenGymCountingAgent::SetSpaces (Ptr<OpenGymSpace> obsSpace, Ptr<OpenGymSpace> actSpace)
+{
+  m_setSpaces++;
+  OpenGymLinearAgent::SetSpaces (obsSpace, actSpace);
+}
+
+Ptr<OpenGymDataContainer>
+OpenGymCountingAgent::GetAction (Ptr<OpenGymDataContainer> obs, float reward,
+                                 bool gameOver, const std::string &info)
+{
+  m_rewards.push_back (reward);
+  m_gameOver.push_back (gameOver);
+  return OpenGymLinearAgent::GetAction (obs, reward, gameOver, info);
+}
+
+/**
+ * \brief Check that a local agent answers the env within the simulation
+ */
+class OpenGymLocalAgentTestCase : public TestCase
 {
 public:
-  OpengymTestCase1 ();
-  virtual ~OpengymTestCase1 ();
+  OpenGymLocalAgentTestCase ();
 
 private:
   virtual void DoRun (void);
+
+  /**
+   * \brief Run an env notified every second for nine seconds
+   *
+   * \param gameOverStep the step the game is over at, 0 for never
+   * \param actions the expected actions
+   * \param stopTime the expected time the simulation stops at
+   */
+  void RunEnv (uint32_t gameOverStep, const std::vector<uint32_t> &actions, Time stopTime);
 };
 
-// Add some help text to this case to describe what it is intended to test
-OpengymTestCase1::OpengymTestCase1 ()
-  : TestCase ("Opengym test case (does nothing)")
+OpenGymLocalAgentTestCase::OpenGymLocalAgentTestCase ()
+  : TestCase ("Check a local agent steps the env without a Python agent")
 {
 }
 
-// This destructor does nothing but we include it as a reminder that
-// the test case should clean up after itself
-OpengymTestCase1::~OpengymTestCase1 ()
+void
+OpenGymLocalAgentTestCase::RunEnv (uint32_t gameOverStep, const std::vector<uint32_t> &actions, Time stopTime)
 {
+  Ptr<OpenGymInterface> iface = CreateObject<OpenGymInterface> (5555);
+  Ptr<OpenGymTestEnv> env = CreateObject<OpenGymTestEnv> (gameOverStep);
+  env->SetOpenGymInterface (iface);
+  // action 1 once the step is above 2.5
+  Ptr<OpenGymCountingAgent> agent = CreateObject<OpenGymCountingAgent> ();
+  agent->SetWeights ({0, 2.5, 1, 0}, {0, 0});
+  env->SetLocalAgent (agent);
+
+  for (uint32_t i = 1; i < 10; i++)
+    {
+      Simulator::Schedule (Seconds (i), &OpenGymTestEnv::Step, env);
+    }
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), stopTime, "Simulation stopped at the wrong time");
+  env->NotifySimulationEnd ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (agent->m_setSpaces, 1, "Spaces not set once");
+  // every action but the game over one, plus the simulation end if
+  // the game was not over before
+  uint32_t steps = actions.size () + 1;
+  NS_TEST_ASSERT_MSG_EQ (agent->m_rewards.size (), steps, "Wrong number of agent steps");
+  for (uint32_t i = 0; i < steps; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (agent->m_rewards[i], static_cast<float> (i < actions.size () ? i + 1 : env->m_step),
+                             "Wrong reward at step " << i);
+      NS_TEST_EXPECT_MSG_EQ (agent->m_gameOver[i], (i + 1 == steps), "Wrong game over at step " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (env->m_actions.size (), actions.size (), "Wrong number of actions");
+  for (uint32_t i = 0; i < actions.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (env->m_actions[i], actions[i], "Wrong action at step " << i);
+    }
+  iface->Dispose ();
 }
 
-//
-// This method is the pure virtual method from class TestCase that every
-// TestCase must implement
-//
 void
-OpengymTestCase1::DoRun (void)
+OpenGymLocalAgentTestCase::DoRun (void)
 {
-  // A wide variety of test macros are available in src/core/test.h
-  NS_TEST_ASSERT_MSG_EQ (true, true, "true doesn't equal true for some reason");
-  // Use this one for floating point comparisons
-  NS_TEST_ASSERT_MSG_EQ_TOL (0.01, 0.01, 0.001, "Numbers are not equal within tolerance");
+  // the game over at step 4 stops the simulation
+  RunEnv (4, {0, 0, 1}, Seconds (4));
+  // the simulation end is the last step otherwise
+  RunEnv (0, {0, 0, 1, 1, 1, 1, 1, 1, 1}, Seconds (9));
+
+  // Box actions are clipped to the bounds of the space
+  Ptr<OpenGymLinearAgent> agent = CreateObject<OpenGymLinearAgent> ();
+  agent->SetWeights ({1, 0, 0, 1}, {0, 0.5});
+  Ptr<OpenGymBoxSpace> obsSpace =
+    CreateObject<OpenGymBoxSpace> (-10, 10, std::vector<uint32_t> {2}, TypeNameGet<float> ());
+  Ptr<OpenGymBoxSpace> actSpace =
+    CreateObject<OpenGymBoxSpace> (-1, 1, std::vector<uint32_t> {2}, TypeNameGet<double> ());
+  agent->SetSpaces (obsSpace, actSpace);
+  Ptr<OpenGymBoxContainer<float> > obs = CreateObject<OpenGymBoxContainer<float> > (std::vector<uint32_t> {2});
+  obs->AddValue (3);
+  obs->AddValue (-0.75);
+  Ptr<OpenGymBoxContainer<double> > action =
+    DynamicCast<OpenGymBoxContainer<double> > (agent->GetAction (obs, 0, false, ""));
+  NS_TEST_ASSERT_MSG_NE (action, 0, "Box action not of the dtype of the space");
+  NS_TEST_EXPECT_MSG_EQ (action->GetValue (0), 1, "Action not clipped");
+  NS_TEST_EXPECT_MSG_EQ (action->GetValue (1), -0.25, "Wrong action");
 }
 
-// The TestSuite class names the TestSuite, identifies what type of TestSuite,
-// and enables the TestCases to be run.  Typically, only the constructor for
-// this class must be defined
-//
+/**
+ * \brief Check the order and the statistics of batched samples
+ *
+ * A full batch is flushed through the callback, which takes the
+ * observation and so starts the next batch; without flushes, the ring
+ * keeps the latest samples, oldest first.
+ */
+class OpenGymBatcherTestCase : public TestCase
+{
+public:
+  OpenGymBatcherTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /// Flush callback: take the observation of the batcher
+  void Flush (void);
+
+  /**
+   * \brief Check an observation of the batcher
+   *
+   * \param obs the observation
+   * \param first the first sample of the batch
+   * \param last the last sample of the batch
+   * \param count the number of samples of the batch
+   */
+  void CheckBatch (Ptr<OpenGymDataContainer> obs, uint32_t first, uint32_t last, uint64_t count);
+
+  Ptr<OpenGymEventBatcher> m_batcher;  //!< Batcher under test
+  uint32_t m_flushes;                  //!< Number of flushes
+};
+
+OpenGymBatcherTestCase::OpenGymBatcherTestCase ()
+  : TestCase ("Check the batcher flushes full batches oldest sample first"),
+    m_flushes (0)
+{
+}
+
+void
+OpenGymBatcherTestCase::Flush (void)
+{
+  m_flushes++;
+  // the observation is refilled by the next call, check it right away
+  CheckBatch (m_batcher->GetObservation (), 1, 4, 4);
+}
+
+void
+OpenGymBatcherTestCase::CheckBatch (Ptr<OpenGymDataContainer> obs, uint32_t first, uint32_t last, uint64_t count)
+{
+  // sample k is {k, -10 k}
+  Ptr<OpenGymDictContainer> dict = DynamicCast<OpenGymDictContainer> (obs);
+  NS_TEST_ASSERT_MSG_NE (dict, 0, "Observation is not a dict");
+  Ptr<OpenGymBoxContainer<double> > samples = DynamicCast<OpenGymBoxContainer<double> > (dict->Get ("samples"));
+  Ptr<OpenGymBoxContainer<uint64_t> > countBox = DynamicCast<OpenGymBoxContainer<uint64_t> > (dict->Get ("count"));
+  Ptr<OpenGymBoxContainer<double> > min = DynamicCast<OpenGymBoxContainer<double> > (dict->Get ("min"));
+  Ptr<OpenGymBoxContainer<double> > max = DynamicCast<OpenGymBoxContainer<double> > (dict->Get ("max"));
+  Ptr<OpenGymBoxContainer<double> > mean = DynamicCast<OpenGymBoxContainer<double> > (dict->Get ("mean"));
+  NS_TEST_ASSERT_MSG_NE (samples, 0, "No samples");
+  NS_TEST_ASSERT_MSG_NE (countBox, 0, "No count");
+  NS_TEST_ASSERT_MSG_NE (min, 0, "No min");
+  NS_TEST_ASSERT_MSG_NE (max, 0, "No max");
+  NS_TEST_ASSERT_MSG_NE (mean, 0, "No mean");
+
+  std::vector<double> data = samples->GetData ();
+  NS_TEST_ASSERT_MSG_EQ (data.size (), 4 * 2, "Samples not of the capacity");
+  uint32_t rows = last - first + 1;
+  for (uint32_t r = 0; r < 4; r++)
+    {
+      double k = (r < rows) ? first + r : 0;
+      NS_TEST_EXPECT_MSG_EQ (data[2 * r], k, "Wrong sample in row " << r);
+      NS_TEST_EXPECT_MSG_EQ (data[2 * r + 1], -10 * k, "Wrong sample in row " << r);
+    }
+  NS_TEST_EXPECT_MSG_EQ (countBox->GetValue (0), count, "Wrong count");
+
+  // the statistics cover all the samples of the batch, also overwritten ones
+  uint32_t begin = last - count + 1;
+  NS_TEST_EXPECT_MSG_EQ (min->GetValue (0), begin, "Wrong min");
+  NS_TEST_EXPECT_MSG_EQ (min->GetValue (1), -10.0 * last, "Wrong min");
+  NS_TEST_EXPECT_MSG_EQ (max->GetValue (0), last, "Wrong max");
+  NS_TEST_EXPECT_MSG_EQ (max->GetValue (1), -10.0 * begin, "Wrong max");
+  NS_TEST_EXPECT_MSG_EQ_TOL (mean->GetValue (0), (begin + last) / 2.0, 1e-9, "Wrong mean");
+  NS_TEST_EXPECT_MSG_EQ_TOL (mean->GetValue (1), -5.0 * (begin + last), 1e-9, "Wrong mean");
+}
+
+void
+OpenGymBatcherTestCase::DoRun (void)
+{
+  m_batcher = CreateObject<OpenGymEventBatcher> (2, 4);
+  m_batcher->SetFlushCallback (MakeCallback (&OpenGymBatcherTestCase::Flush, this));
+  for (uint32_t k = 1; k <= 4; k++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_flushes, 0, "Flushed before the batch is full");
+      m_batcher->AddSample ({1.0 * k, -10.0 * k});
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_flushes, 1, "Full batch not flushed");
+  NS_TEST_ASSERT_MSG_EQ (m_batcher->GetCount (), 0, "Flush did not start a new batch");
+
+  // a partial batch is padded with zeros
+  m_batcher->AddSample ({5, -50});
+  m_batcher->AddSample ({6, -60});
+  CheckBatch (m_batcher->GetObservation (), 5, 6, 2);
+  NS_TEST_ASSERT_MSG_EQ (m_flushes, 1, "Partial batch flushed");
+  m_batcher->Dispose ();
+
+  // without flushes the ring wraps around
+  m_batcher = CreateObject<OpenGymEventBatcher> (2, 4);
+  m_batcher->SetAttribute ("FlushWhenFull", BooleanValue (false));
+  m_batcher->SetFlushCallback (MakeCallback (&OpenGymBatcherTestCase::Flush, this));
+  for (uint32_t k = 1; k <= 6; k++)
+    {
+      m_batcher->AddSample ({1.0 * k, -10.0 * k});
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_flushes, 1, "Flushed although FlushWhenFull is false");
+  NS_TEST_ASSERT_MSG_EQ (m_batcher->GetCount (), 6, "Wrong number of samples");
+  CheckBatch (m_batcher->GetObservation (), 3, 6, 6);
+  m_batcher->Dispose ();
+  m_batcher = 0;
+}
+
+/**
+ * \brief TestSuite for the opengym module
+ */
 class OpengymTestSuite : public TestSuite
 {
 public:
@@ -59,10 +604,12 @@ public:
 OpengymTestSuite::OpengymTestSuite ()
   : TestSuite ("opengym", UNIT)
 {
-  // TestDuration for TestCase can be QUICK, EXTENSIVE or TAKES_FOREVER
-  AddTestCase (new OpengymTestCase1, TestCase::QUICK);
+  AddTestCase (new OpenGymBoxRoundTripTestCase (true), TestCase::QUICK);
+  AddTestCase (new OpenGymBoxRoundTripTestCase (false), TestCase::QUICK);
+  AddTestCase (new OpenGymReuseElementsTestCase, TestCase::QUICK);
+  AddTestCase (new OpenGymLocalAgentTestCase, TestCase::QUICK);
+  AddTestCase (new OpenGymBatcherTestCase, TestCase::QUICK);
 }
 
 // Do not forget to allocate an instance of this TestSuite
 static OpengymTestSuite opengymTestSuite;
-
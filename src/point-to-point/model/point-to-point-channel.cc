@@ -22,12 +22,14 @@
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/log.h"
+#include "ns3/rollback.h"
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PointToPointChannel");
 
 NS_OBJECT_ENSURE_REGISTERED (PointToPointChannel);
+NS_ROLLBACK_SUPPORTED (PointToPointChannel);
 
 TypeId 
 PointToPointChannel::GetTypeId (void)
@@ -57,7 +59,8 @@ PointToPointChannel::PointToPointChannel()
   :
     Channel (),
     m_delay (Seconds (0.)),
-    m_nDevices (0)
+    m_nDevices (0),
+    m_crossThread (false)
 {
   NS_LOG_FUNCTION_NOARGS ();
 }
@@ -97,6 +100,17 @@ PointToPointChannel::TransmitStart (
 
   uint32_t wire = src == m_link[0].m_src ? 0 : 1;
 
+  if (m_crossThread)
+    {
+      // the receiver may be run by another thread: neither the packet
+      // nor the reference counts of the receiver are shared, and like
+      // PointToPointRemoteChannel, no animation trace is fired
+      Simulator::ScheduleWithContext (m_link[wire].m_dstNodeId,
+                                      txTime + m_delay, &PointToPointNetDevice::Receive,
+                                      PeekPointer (m_link[wire].m_dst), p->DeepCopy ());
+      return true;
+    }
+
   Simulator::ScheduleWithContext (m_link[wire].m_dst->GetNode ()->GetId (),
                                   txTime + m_delay, &PointToPointNetDevice::Receive,
                                   m_link[wire].m_dst, p->Copy ());
@@ -106,6 +120,22 @@ PointToPointChannel::TransmitStart (
   return true;
 }
 
+bool
+PointToPointChannel::SetCrossThread (bool crossThread)
+{
+  NS_LOG_FUNCTION (this << crossThread);
+  if (crossThread)
+    {
+      NS_ASSERT (m_nDevices == N_DEVICES);
+      for (std::size_t i = 0; i < N_DEVICES; i++)
+        {
+          m_link[i].m_dstNodeId = m_link[i].m_dst->GetNode ()->GetId ();
+        }
+    }
+  m_crossThread = crossThread;
+  return true;
+}
+
 std::size_t
 PointToPointChannel::GetNDevices (void) const
 {
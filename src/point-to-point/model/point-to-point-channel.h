@@ -100,6 +100,9 @@ public:
    */
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
 
+  // inherited from ns3::Channel
+  virtual bool SetCrossThread (bool crossThread);
+
 protected:
   /**
    * \brief Get the delay associated with this channel
@@ -151,6 +154,7 @@ private:
 
   Time          m_delay;    //!< Propagation delay
   std::size_t        m_nDevices; //!< Devices of this channel
+  bool          m_crossThread; //!< Receivers may be run by other threads
 
   /**
    * The trace source for the packet transmission animation events that the 
@@ -194,11 +198,12 @@ public:
     /** \brief Create the link, it will be in INITIALIZING state
      *
      */
-    Link() : m_state (INITIALIZING), m_src (0), m_dst (0) {}
+    Link() : m_state (INITIALIZING), m_src (0), m_dst (0), m_dstNodeId (0) {}
 
     WireState                  m_state; //!< State of the link
     Ptr<PointToPointNetDevice> m_src;   //!< First NetDevice
     Ptr<PointToPointNetDevice> m_dst;   //!< Second NetDevice
+    uint32_t                   m_dstNodeId; //!< Node id of m_dst, set once m_crossThread
   };
 
   Link    m_link[N_DEVICES]; //!< Link model
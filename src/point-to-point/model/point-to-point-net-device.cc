@@ -25,6 +25,7 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 #include "ns3/pointer.h"
+#include "ns3/rollback.h"
 #include "point-to-point-net-device.h"
 #include "point-to-point-channel.h"
 #include "ppp-header.h"
@@ -34,6 +35,7 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("PointToPointNetDevice");
 
 NS_OBJECT_ENSURE_REGISTERED (PointToPointNetDevice);
+NS_ROLLBACK_SUPPORTED (PointToPointNetDevice);
 
 TypeId 
 PointToPointNetDevice::GetTypeId (void)
@@ -274,6 +276,7 @@ PointToPointNetDevice::TransmitComplete (void)
   // next packet.
   //
   NS_ASSERT_MSG (m_txMachineState == BUSY, "Must be BUSY if transmitting");
+  SaveState ();
   m_txMachineState = READY;
 
   NS_ASSERT_MSG (m_currentPkt != 0, "PointToPointNetDevice::TransmitComplete(): m_currentPkt zero");
@@ -296,6 +299,27 @@ PointToPointNetDevice::TransmitComplete (void)
   TransmitStart (p);
 }
 
+void
+PointToPointNetDevice::SaveState (void)
+{
+  if (!Rollback::IsEnabled ())
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  m_queue->SaveState ();
+  Rollback::Save (MakeBoundCallback (&PointToPointNetDevice::RestoreState,
+                                     Ptr<PointToPointNetDevice> (this), m_txMachineState, m_currentPkt));
+}
+
+void
+PointToPointNetDevice::RestoreState (Ptr<PointToPointNetDevice> device, TxMachineState state, Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (device << state << packet);
+  device->m_txMachineState = state;
+  device->m_currentPkt = packet;
+}
+
 bool
 PointToPointNetDevice::Attach (Ptr<PointToPointChannel> ch)
 {
@@ -344,6 +368,13 @@ PointToPointNetDevice::Receive (Ptr<Packet> packet)
     }
   else 
     {
+      if (Rollback::IsEnabled ())
+        {
+          // the upper layers change the packet, which the event must keep
+          // in case it runs again
+          packet = packet->Copy ();
+        }
+
       // 
       // Hit the trace hooks.  All of these hooks are in the same place in this 
       // device because it is so simple, but this is not usually the case in
@@ -523,6 +554,12 @@ PointToPointNetDevice::Send (
       return false;
     }
 
+  if (Rollback::IsEnabled ())
+    {
+      // the caller keeps the packet in case the event runs again
+      packet = packet->Copy ();
+    }
+
   //
   // Stick a point to point protocol header on the packet in preparation for
   // shoving it out the door.
@@ -534,6 +571,7 @@ PointToPointNetDevice::Send (
   //
   // We should enqueue and dequeue the packet to hit the tracing hooks.
   //
+  SaveState ();
   if (m_queue->Enqueue (packet))
     {
       //
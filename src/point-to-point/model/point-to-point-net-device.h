@@ -58,6 +58,10 @@ class ErrorModel;
  * Key parameters or objects that can be specified for this device 
  * include a queue, data rate, and interframe transmission gap (the 
  * propagation delay is set in the PointToPointChannel).
+ *
+ * The device saves its state with Rollback, so that optimistic
+ * simulators may run its events ahead; the decisions of the receive
+ * ErrorModel are not rolled back.
  */
 class PointToPointNetDevice : public NetDevice
 {
@@ -295,6 +299,21 @@ private:
    */
   TxMachineState m_txMachineState;
 
+  /**
+   * If the current event may be rolled back, save the queue and the
+   * transmit state machine before they change.
+   */
+  void SaveState (void);
+
+  /**
+   * Restore the transmit state machine saved by SaveState.
+   *
+   * \param device the device
+   * \param state the state of the transmit state machine
+   * \param packet the packet being transmitted
+   */
+  static void RestoreState (Ptr<PointToPointNetDevice> device, TxMachineState state, Ptr<Packet> packet);
+
   /**
    * The data rate that the Net Device uses to simulate packet transmission
    * timing.
@@ -24,6 +24,15 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/optimistic-simulator-impl.h"
+#include "ns3/node-container.h"
+#include "ns3/rollback.h"
+#include "ns3/config.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include <vector>
 
 using namespace ns3;
 
@@ -94,6 +103,188 @@ PointToPointTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \brief Test the rollback of the PointToPoint model
+ *
+ * It runs a ring of nodes linked by PointToPointChannels with the
+ * OptimisticSimulatorImpl, and checks that the nodes receive the same
+ * packets as with the DefaultSimulatorImpl.
+ */
+class PointToPointRollbackTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointRollbackTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  /**
+   * \brief Per node counters, restored on rollback
+   */
+  struct State
+  {
+    uint64_t count;   //!< Packets received
+    uint64_t sum;     //!< Hash of the packets received
+    /**
+     * \brief Inequality, needed to bind a State to a Callback
+     *
+     * \param o the other state
+     * \returns true if the states differ
+     */
+    bool operator != (const State &o) const
+    {
+      return count != o.count || sum != o.sum;
+    }
+  };
+
+  /**
+   * \brief Build the ring and run it
+   *
+   * \param simulatorType the simulator implementation
+   * \returns the state of every node at the end of the simulation
+   */
+  std::vector<State> RunRing (std::string simulatorType);
+
+  /**
+   * \brief Receive a packet, and forward it on the other device
+   *
+   * \param dev the device
+   * \param p the packet
+   * \param protocol the protocol number
+   * \param from the sender
+   * \returns true
+   */
+  bool Receive (Ptr<NetDevice> dev, Ptr<const Packet> p, uint16_t protocol, const Address &from);
+
+  /**
+   * \brief Send a packet on every device of a node, every 20 us or so
+   *
+   * \param node the node
+   * \param seq the number of packets generated so far
+   */
+  void Generate (Ptr<Node> node, uint32_t seq);
+
+  /**
+   * \brief Undo the changes of an event to the state of a node
+   *
+   * \param node the node id
+   * \param state the state before the event
+   */
+  void Restore (uint32_t node, State state);
+
+  std::vector<State> m_state;   //!< The state of every node
+  uint64_t m_rollbacks;         //!< Events rolled back by the last run
+};
+
+static const uint32_t P2P_RING_NODES = 8;
+
+PointToPointRollbackTest::PointToPointRollbackTest ()
+  : TestCase ("PointToPoint rollback")
+{
+}
+
+void
+PointToPointRollbackTest::Restore (uint32_t node, State state)
+{
+  m_state[node] = state;
+}
+
+bool
+PointToPointRollbackTest::Receive (Ptr<NetDevice> dev, Ptr<const Packet> p, uint16_t protocol, const Address &from)
+{
+  uint32_t node = dev->GetNode ()->GetId ();
+  if (Rollback::IsEnabled ())
+    {
+      Rollback::Save (MakeCallback (&PointToPointRollbackTest::Restore, this).TwoBind (node, m_state[node]));
+    }
+  uint8_t data[2];
+  p->CopyData (data, 2);
+  uint64_t x = Simulator::Now ().GetTimeStep () * 1000003 + p->GetSize () * 7919 + data[0] * 31 + data[1];
+  x ^= x >> 31;
+  x *= 0x9e3779b97f4a7c15ULL;
+  x ^= x >> 29;
+  m_state[node].count++;
+  m_state[node].sum += x;
+
+  // the first byte counts the hops
+  if (data[0] < 3)
+    {
+      data[0]++;
+      Ptr<Node> n = dev->GetNode ();
+      Ptr<NetDevice> out = n->GetDevice ((dev->GetIfIndex () + 1) % n->GetNDevices ());
+      out->Send (Create<Packet> (data, p->GetSize () < 2 ? 2 : p->GetSize ()), out->GetBroadcast (), 0x800);
+    }
+  return true;
+}
+
+void
+PointToPointRollbackTest::Generate (Ptr<Node> node, uint32_t seq)
+{
+  for (uint32_t d = 0; d < node->GetNDevices (); d++)
+    {
+      uint8_t data[2] = { 0, static_cast<uint8_t> (node->GetId () * 7 + seq + d) };
+      node->GetDevice (d)->Send (Create<Packet> (data, 2), node->GetDevice (d)->GetBroadcast (), 0x800);
+    }
+  Simulator::Schedule (MicroSeconds (20 + node->GetId () % 5),
+                       &PointToPointRollbackTest::Generate, this, node, seq + 1);
+}
+
+std::vector<PointToPointRollbackTest::State>
+PointToPointRollbackTest::RunRing (std::string simulatorType)
+{
+  Config::SetGlobal ("SimulatorImplementationType", StringValue (simulatorType));
+  m_state.assign (P2P_RING_NODES, State {0, 0});
+
+  NodeContainer nodes;
+  nodes.Create (P2P_RING_NODES);
+  PointToPointHelper helper;
+  helper.SetDeviceAttribute ("DataRate", StringValue ("100Mbps"));
+  for (uint32_t i = 0; i < P2P_RING_NODES; i++)
+    {
+      helper.SetChannelAttribute ("Delay", TimeValue (MicroSeconds (10 + i % 3 * 5)));
+      NetDeviceContainer devices = helper.Install (nodes.Get (i), nodes.Get ((i + 1) % P2P_RING_NODES));
+      for (uint32_t k = 0; k < devices.GetN (); k++)
+        {
+          devices.Get (k)->SetReceiveCallback (MakeCallback (&PointToPointRollbackTest::Receive, this));
+        }
+    }
+  for (uint32_t i = 0; i < P2P_RING_NODES; i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &PointToPointRollbackTest::Generate,
+                                      this, nodes.Get (i), 0);
+    }
+  Simulator::Stop (MilliSeconds (2));
+  Simulator::Run ();
+  Ptr<OptimisticSimulatorImpl> impl = DynamicCast<OptimisticSimulatorImpl> (Simulator::GetImplementation ());
+  m_rollbacks = impl == 0 ? 0 : impl->GetRollbackCount ();
+  Simulator::Destroy ();
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::DefaultSimulatorImpl"));
+  return m_state;
+}
+
+void
+PointToPointRollbackTest::DoRun (void)
+{
+  Config::SetDefault ("ns3::OptimisticSimulatorImpl::MaxThreads", UintegerValue (4));
+  std::vector<State> expected = RunRing ("ns3::DefaultSimulatorImpl");
+  std::vector<State> got = RunRing ("ns3::OptimisticSimulatorImpl");
+
+  // the devices and channels support Rollback, so the partitions ran ahead
+  NS_TEST_ASSERT_MSG_GT (m_rollbacks, 0, "No event rolled back");
+  NS_TEST_ASSERT_MSG_GT (expected[0].count, 0, "No packet received");
+  for (uint32_t i = 0; i < P2P_RING_NODES; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (got[i].count, expected[i].count, "Node " << i << " received other packets");
+      NS_TEST_EXPECT_MSG_EQ (got[i].sum, expected[i].sum, "Node " << i << " received other packets");
+    }
+}
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -110,6 +301,7 @@ PointToPointTestSuite::PointToPointTestSuite ()
   : TestSuite ("devices-point-to-point", UNIT)
 {
   AddTestCase (new PointToPointTest, TestCase::QUICK);
+  AddTestCase (new PointToPointRollbackTest, TestCase::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
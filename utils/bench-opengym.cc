@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the per-step overhead of OpenGymInterface.
+// It runs the environment of the opengym example (Box observation,
+// Discrete action) against a dummy agent answering from a thread of the
+// same process, so no Python is involved and the time split reported by
+// the StepStats trace source shows what the interface itself costs.
+// With --localAgent the states are answered by an OpenGymLinearAgent
+// instead, which gives the baseline without any IPC.
+// Sample usage:  ./waf --run 'bench-opengym --steps=10000 --obsSize=1000'
+
+#include "ns3/core-module.h"
+#include "ns3/opengym-module.h"
+#include <zmq.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace ns3;
+
+namespace {
+
+uint32_t g_obsSize = 5;
+uint32_t g_eventsPerStep = 0;
+Ptr<UniformRandomVariable> g_rng;
+Ptr<OpenGymBoxContainer<float> > g_obs;
+
+OpenGymStepStats g_sum;
+uint64_t g_steps = 0;
+
+Ptr<OpenGymSpace>
+GetObservationSpace (void)
+{
+  std::vector<uint32_t> shape = {g_obsSize,};
+  return CreateObject<OpenGymBoxSpace> (0.0, 10.0, shape, TypeNameGet<float> ());
+}
+
+Ptr<OpenGymSpace>
+GetActionSpace (void)
+{
+  return CreateObject<OpenGymDiscreteSpace> (g_obsSize);
+}
+
+bool
+GetGameOver (void)
+{
+  return false;
+}
+
+Ptr<OpenGymDataContainer>
+GetObservation (void)
+{
+  for (uint32_t i = 0; i < g_obsSize; i++)
+    {
+      g_obs->SetValue (i, g_rng->GetValue (0.0, 10.0));
+    }
+  return g_obs;
+}
+
+float
+GetReward (void)
+{
+  return 1.0;
+}
+
+std::string
+GetExtraInfo (void)
+{
+  return "";
+}
+
+bool
+ExecuteActions (Ptr<OpenGymDataContainer> action)
+{
+  return true;
+}
+
+void
+DummyEvent (void)
+{
+}
+
+void
+ScheduleNextStateRead (Time envStepTime, Ptr<OpenGymInterface> openGym)
+{
+  Simulator::Schedule (envStepTime, &ScheduleNextStateRead, envStepTime, openGym);
+  // some load for the simulation between two steps
+  for (uint32_t i = 0; i < g_eventsPerStep; i++)
+    {
+      Simulator::Schedule (envStepTime * (i + 1) / (g_eventsPerStep + 1), &DummyEvent);
+    }
+  openGym->NotifyCurrentState ();
+}
+
+void
+StepStats (const OpenGymStepStats &stats)
+{
+  g_sum.simTime += stats.simTime;
+  g_sum.events += stats.events;
+  g_sum.simWallTime += stats.simWallTime;
+  g_sum.serializeTime += stats.serializeTime;
+  g_sum.recvWaitTime += stats.recvWaitTime;
+  g_steps++;
+}
+
+/**
+ * Agent answering every state with the same action, just like the
+ * Python side would do, until the simulation ends.
+ */
+void
+RunDummyAgent (zmq::context_t *context, uint32_t port)
+{
+  zmq::socket_t socket (*context, ZMQ_REP);
+  socket.bind ("tcp://*:" + std::to_string (port));
+
+  zmq::message_t request;
+  (void) socket.recv (request, zmq::recv_flags::none);
+  ns3opengym::SimInitAck initAck;
+  initAck.set_done (true);
+  std::string data = initAck.SerializeAsString ();
+  socket.send (zmq::buffer (data.data (), data.size ()), zmq::send_flags::none);
+
+  ns3opengym::DiscreteDataContainer action;
+  action.set_data (0);
+  ns3opengym::EnvActMsg actMsg;
+  actMsg.mutable_actdata ()->set_type (ns3opengym::Discrete);
+  actMsg.mutable_actdata ()->mutable_data ()->PackFrom (action);
+  std::string actData = actMsg.SerializeAsString ();
+
+  ns3opengym::EnvStateMsg stateMsg;
+  while (true)
+    {
+      (void) socket.recv (request, zmq::recv_flags::none);
+      stateMsg.ParseFromArray (request.data (), request.size ());
+      socket.send (zmq::buffer (actData.data (), actData.size ()), zmq::send_flags::none);
+      if (stateMsg.isgameover ())
+        {
+          break;
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main (int argc, char *argv[])
+{
+  uint32_t steps = 10000;
+  uint32_t port = 5599;
+  double envStepTime = 0.1;
+  bool localAgent = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("steps", "number of steps to run (default 10000)", steps);
+  cmd.AddValue ("obsSize", "number of float values in the observation (default 5)", g_obsSize);
+  cmd.AddValue ("eventsPerStep", "number of extra events executed between two steps (default 0)", g_eventsPerStep);
+  cmd.AddValue ("envStepTime", "simulation time between two steps in seconds (default 0.1)", envStepTime);
+  cmd.AddValue ("port", "port of the dummy agent (default 5599)", port);
+  cmd.AddValue ("localAgent", "answer with a local linear agent instead of the dummy one (default false)", localAgent);
+  cmd.Parse (argc, argv);
+
+  g_rng = CreateObject<UniformRandomVariable> ();
+  std::vector<uint32_t> shape = {g_obsSize,};
+  g_obs = CreateObject<OpenGymBoxContainer<float> > (shape);
+
+  zmq::context_t agentContext (1);
+  std::thread agent;
+  Ptr<OpenGymInterface> openGym = CreateObject<OpenGymInterface> (port);
+  if (localAgent)
+    {
+      Ptr<OpenGymLinearAgent> linear = CreateObject<OpenGymLinearAgent> ();
+      linear->SetWeights (std::vector<float> (g_obsSize * g_obsSize, 0.1), std::vector<float> (g_obsSize, 0.0));
+      openGym->SetLocalAgent (linear);
+    }
+  else
+    {
+      agent = std::thread (&RunDummyAgent, &agentContext, port);
+    }
+
+  openGym->SetGetActionSpaceCb (MakeCallback (&GetActionSpace));
+  openGym->SetGetObservationSpaceCb (MakeCallback (&GetObservationSpace));
+  openGym->SetGetGameOverCb (MakeCallback (&GetGameOver));
+  openGym->SetGetObservationCb (MakeCallback (&GetObservation));
+  openGym->SetGetRewardCb (MakeCallback (&GetReward));
+  openGym->SetGetExtraInfoCb (MakeCallback (&GetExtraInfo));
+  openGym->SetExecuteActionsCb (MakeCallback (&ExecuteActions));
+  openGym->TraceConnectWithoutContext ("StepStats", MakeCallback (&StepStats));
+
+  // the state sent at the stop time is the last step
+  Time stepTime = Seconds (envStepTime);
+  Simulator::Schedule (Seconds (0.0), &ScheduleNextStateRead, stepTime, openGym);
+  Simulator::Stop (stepTime * (steps - 1) + NanoSeconds (1));
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  Simulator::Run ();
+  openGym->NotifySimulationEnd ();
+  double total = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+  Simulator::Destroy ();
+  if (agent.joinable ())
+    {
+      agent.join ();
+    }
+
+  double n = g_steps ? g_steps : 1;
+  std::cout << std::fixed << std::setprecision (2)
+            << "steps:            " << g_steps << std::endl
+            << "total:            " << total << " s, " << g_steps / total << " steps/s" << std::endl
+            << "events per step:  " << g_sum.events / n << std::endl
+            << "sim wall:         " << g_sum.simWallTime.GetNanoSeconds () / n / 1000 << " us/step" << std::endl
+            << "serialize:        " << g_sum.serializeTime.GetNanoSeconds () / n / 1000 << " us/step" << std::endl
+            << "agent wait:       " << g_sum.recvWaitTime.GetNanoSeconds () / n / 1000 << " us/step" << std::endl;
+  return 0;
+}
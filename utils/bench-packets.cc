@@ -25,6 +25,7 @@
 #include "ns3/command-line.h"
 #include "ns3/system-wall-clock-ms.h"
 #include "ns3/packet.h"
+#include "ns3/buffer.h"
 #include "ns3/packet-metadata.h"
 #include <iostream>
 #include <sstream>
@@ -328,6 +329,30 @@ benchByteTags (uint32_t n)
     }
 }
 
+static void
+benchItems (uint32_t n)
+{
+  BenchHeader<25> ipv4;
+  BenchHeader<8> udp;
+
+  for (uint32_t i = 0; i < n; i++) {
+    Ptr<Packet> p = Create<Packet> (2000);
+    p->AddHeader (udp);
+    p->AddHeader (ipv4);
+    Ptr<Packet> frag = p->CreateFragment (0, 1000);
+
+    // walk the metadata, as Packet::Print does
+    uint32_t items = 0;
+    PacketMetadata::ItemIterator j = frag->BeginItem ();
+    while (j.HasNext ())
+      {
+        j.Next ();
+        items++;
+      }
+    NS_ASSERT_MSG (items == 0 || items == 3, "Unexpected number of items " << items);
+  }
+}
+
 static uint64_t
 runBenchOneIteration (void (*bench) (uint32_t), uint32_t n)
 {
@@ -362,12 +387,14 @@ int main (int argc, char *argv[])
   uint32_t n = 0;
   uint32_t minIterations = 1;
   bool enablePrinting = false;
+  bool enableJournal = false;
 
   CommandLine cmd;
   cmd.Usage ("Benchmark Packet class");
   cmd.AddValue ("n", "number of iterations", n);
   cmd.AddValue ("min-iterations", "number of subiterations to minimize iteration time over", minIterations);
   cmd.AddValue ("enable-printing", "enable packet printing", enablePrinting);
+  cmd.AddValue ("enable-journal", "enable packet printing, with the metadata journal", enableJournal);
   cmd.Parse (argc, argv);
 
   if (n == 0)
@@ -376,6 +403,14 @@ int main (int argc, char *argv[])
         "by command-line argument --n=(number of packets)" << std::endl;
       exit (1);
     }
+  if (enableJournal)
+    {
+      Packet::EnableJournaledPrinting ();
+    }
+  else if (enablePrinting)
+    {
+      Packet::EnablePrinting ();
+    }
   std::cout << "Running bench-packets with n=" << n << std::endl;
   std::cout << "All tests begin by adding UDP and IPv4 headers." << std::endl;
 
@@ -385,6 +420,11 @@ int main (int argc, char *argv[])
   runBench (&benchD, n, minIterations, "Intermixed add/remove headers and tags");
   runBench (&benchFragment, n, minIterations, "Fragmentation and concatenation");
   runBench (&benchByteTags, n, minIterations, "Benchmark byte tags");
+  runBench (&benchItems, n, minIterations, "Fragment and iterate metadata items");
+
+  std::cout << "Buffer pool: ";
+  Buffer::GetPoolStatistics ().Print (std::cout);
+  std::cout << std::endl;
 
   return 0;
 }
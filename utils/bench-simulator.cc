@@ -51,7 +51,8 @@ public:
   Bench (const uint32_t population, const uint32_t total)
     : m_population (population),
       m_total (total),
-      m_count (0)
+      m_count (0),
+      m_removeRatio (0)
   {
   }
 
@@ -82,16 +83,31 @@ public:
     m_total = total;
   }
 
+  /**
+   * Set the fraction of events which also restart a timer
+   * \param ratio the fraction, between 0 and 1
+   */
+  void SetRemoveRatio (double ratio)
+  {
+    m_removeRatio = ratio;
+    m_coin = CreateObject<UniformRandomVariable> ();
+  }
+
   /// Run function
   void RunBench (void);
 private:
   /// callback function
   void Cb (void);
+  /// timer callback function, only runs if the timer was not restarted
+  void Timeout (void);
 
   Ptr<RandomVariableStream> m_rand; ///< random variable
   uint32_t m_population; ///< population
   uint32_t m_total; ///< total
   uint32_t m_count; ///< count 
+  double m_removeRatio; ///< fraction of events restarting the timer
+  Ptr<UniformRandomVariable> m_coin; ///< draws which events restart the timer
+  EventId m_timer; ///< pending timer
 };
 
 void
@@ -142,21 +158,64 @@ Bench::Cb (void)
   Time after = NanoSeconds (m_rand->GetValue ());
   Simulator::Schedule (after, &Bench::Cb, this);
   ++m_count;
+
+  // like a retransmission timer: remove the pending timeout and schedule
+  // a new one, far behind the events of the hold model
+  if (m_removeRatio > 0 && m_coin->GetValue () < m_removeRatio)
+    {
+      Simulator::Remove (m_timer);
+      m_timer = Simulator::Schedule (after * 100, &Bench::Timeout, this);
+    }
+}
+
+void
+Bench::Timeout (void)
+{
 }
 
 
 Ptr<RandomVariableStream>
-GetRandomStream (std::string filename)
+GetRandomStream (std::string filename, std::string dist)
 {
   Ptr<RandomVariableStream> stream = 0;
 
-  if (filename == "")
+  // all distributions have a mean of 100 ns
+  if (filename == "" && dist == "unif")
+    {
+      LOGME ("using uniform distribution");
+      Ptr<UniformRandomVariable> urv = CreateObject<UniformRandomVariable> ();
+      urv->SetAttribute ("Min", DoubleValue (0));
+      urv->SetAttribute ("Max", DoubleValue (200));
+      stream = urv;
+    }
+  else if (filename == "" && dist == "tri")
+    {
+      LOGME ("using triangular distribution");
+      Ptr<TriangularRandomVariable> trv = CreateObject<TriangularRandomVariable> ();
+      trv->SetAttribute ("Min", DoubleValue (0));
+      trv->SetAttribute ("Mean", DoubleValue (100));
+      trv->SetAttribute ("Max", DoubleValue (150));
+      stream = trv;
+    }
+  else if (filename == "" && dist == "pareto")
+    {
+      LOGME ("using pareto distribution");
+      Ptr<ParetoRandomVariable> prv = CreateObject<ParetoRandomVariable> ();
+      prv->SetAttribute ("Scale", DoubleValue (50));
+      prv->SetAttribute ("Shape", DoubleValue (2));
+      stream = prv;
+    }
+  else if (filename == "" && dist == "exp")
     {
       LOGME ("using default exponential distribution");
       Ptr<ExponentialRandomVariable> erv = CreateObject<ExponentialRandomVariable> ();
       erv->SetAttribute ("Mean", DoubleValue (100));
       stream = erv;
     }
+  else if (filename == "")
+    {
+      NS_FATAL_ERROR ("Unknown distribution \"" << dist << "\", use exp, unif, tri or pareto");
+    }
   else
     {
       std::istream *input;
@@ -205,6 +264,8 @@ int main (int argc, char *argv[])
 
   bool schedCal  = false;
   bool schedHeap = false;
+  bool schedDary = false;
+  bool schedLadder = false;
   bool schedList = false;
   bool schedMap  = true;
 
@@ -212,18 +273,25 @@ int main (int argc, char *argv[])
   uint32_t total = 1000000;
   uint32_t runs  =       1;
   std::string filename = "";
+  std::string dist = "exp";
+  double removeRatio = 0;
+  bool noPool = false;
 
   CommandLine cmd;
   cmd.Usage ("Benchmark the simulator scheduler.\n"
              "\n"
              "Event intervals are taken from one of:\n"
              "  an exponential distribution, with mean 100 ns,\n"
+             "  a uniform, triangular or pareto one, with the same mean,\n"
+             "    given by the --dist=\"unif|tri|pareto\" argument,\n"
              "  an ascii file, given by the --file=\"<filename>\" argument,\n"
              "  or standard input, by the argument --file=\"-\"\n"
              "In the case of either --file form, the input is expected\n"
              "to be ascii, giving the relative event times in ns.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
+  cmd.AddValue ("dary",  "use DaryHeapScheduler",         schedDary);
+  cmd.AddValue ("ladder", "use LadderScheduler",          schedLadder);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
   cmd.AddValue ("debug", "enable debugging output",       g_debug);
@@ -231,7 +299,10 @@ int main (int argc, char *argv[])
   cmd.AddValue ("total", "total number of events to run (default 1E6)", total);
   cmd.AddValue ("runs",  "number of runs (default 1)",    runs);
   cmd.AddValue ("file",  "file of relative event times",  filename);
+  cmd.AddValue ("dist",  "distribution of event times: exp, unif, tri or pareto (default exp)", dist);
+  cmd.AddValue ("remove", "fraction of events which also remove and reschedule a timer (default 0)", removeRatio);
   cmd.AddValue ("prec",  "printed output precision",      g_fwidth);
+  cmd.AddValue ("nopool", "allocate events with plain new instead of the EventImpl free lists", noPool);
   cmd.Parse (argc, argv);
   g_me = cmd.GetName () + ": ";
   g_fwidth += 6;  // 5 extra chars in '2.000002e+07 ': . e+0 _
@@ -249,7 +320,16 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::ListScheduler");
     }
+  if (schedDary)
+    {
+      factory.SetTypeId ("ns3::DaryHeapScheduler");
+    }
+  if (schedLadder)
+    {
+      factory.SetTypeId ("ns3::LadderScheduler");
+    }
   Simulator::SetScheduler (factory);
+  EventImpl::SetPoolEnabled (!noPool);
 
   LOGME (std::setprecision (g_fwidth - 6));
   DEB ("debugging is ON");
@@ -258,9 +338,12 @@ int main (int argc, char *argv[])
   LOGME ("population: " << pop);
   LOGME ("total events: " << total);
   LOGME ("runs: " << runs);
+  LOGME ("event pool: " << (noPool ? "off" : "on"));
+  LOGME ("remove ratio: " << removeRatio);
 
   Bench *bench = new Bench (pop, total);
-  bench->SetRandomStream (GetRandomStream (filename));
+  bench->SetRandomStream (GetRandomStream (filename, dist));
+  bench->SetRemoveRatio (removeRatio);
 
   // table header
   LOG ("");